@@ -0,0 +1,94 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/binary_filter/lz4_serialization_filter_registration.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/modules/serialization.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    // Compression ratio observed for the messages of one action. This is used
+    // to stop compressing messages which turn out to be incompressible.
+    struct lz4_compression_state
+    {
+        constexpr lz4_compression_state() noexcept
+          : ratio(0)
+          , skipped(0)
+        {
+        }
+
+        // average size of the compressed data relative to the size of the
+        // original data (in 1/1024th), zero if nothing was compressed yet
+        std::atomic<std::uint32_t> ratio;
+
+        // number of messages sent uncompressed since the last attempt
+        std::atomic<std::uint32_t> skipped;
+    };
+
+    struct HPX_LIBRARY_EXPORT lz4_serialization_filter
+      : public serialization::binary_filter
+    {
+        lz4_serialization_filter(bool compress = false,
+            serialization::binary_filter* next_filter = nullptr);
+
+        // messages smaller than the threshold (in bytes) are not compressed
+        void set_threshold(std::size_t threshold) noexcept
+        {
+            threshold_ = threshold;
+        }
+
+        // use the given state to track the compression ratio, this allows
+        // to separately decide for each action whether to compress
+        void set_state(lz4_compression_state* state) noexcept
+        {
+            state_ = state;
+        }
+
+        void load(void* dst, std::size_t dst_count) override;
+        void save(void const* src, std::size_t src_count) override;
+        bool flush(
+            void* dst, std::size_t dst_count, std::size_t& written) override;
+
+        void set_max_length(std::size_t size) override;
+        std::size_t init_data(void const* buffer, std::size_t size,
+            std::size_t buffer_size) override;
+
+    private:
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive& ar, const unsigned int)
+        {
+        }
+
+        HPX_SERIALIZATION_POLYMORPHIC(lz4_serialization_filter, override);
+
+        bool compress_message() const noexcept;
+
+        std::vector<char> buffer_;
+        std::size_t current_;
+        std::size_t threshold_;
+        lz4_compression_state* state_;
+    };
+}    // namespace hpx::plugins::compression
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
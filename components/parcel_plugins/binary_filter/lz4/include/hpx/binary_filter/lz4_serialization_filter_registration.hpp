@@ -0,0 +1,59 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+
+#include <hpx/parcelset_base/traits/action_serialization_filter.hpp>
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+// Messages of the given action smaller than the given threshold (in bytes) are
+// sent uncompressed, all others are compressed as long as this saves enough
+// space.
+#define HPX_ACTION_USES_LZ4_COMPRESSION_THRESHOLD(action, threshold)           \
+    namespace hpx::traits {                                                    \
+        template <>                                                            \
+        struct action_serialization_filter</**/ action>                        \
+        {                                                                      \
+            /* Note that the caller is responsible for deleting the filter */  \
+            /* instance returned from this function */                         \
+            static serialization::binary_filter* call()                        \
+            {                                                                  \
+                using hpx::plugins::compression::lz4_serialization_filter;     \
+                auto* filter = static_cast<lz4_serialization_filter*>(         \
+                    hpx::create_binary_filter(                                 \
+                        "lz4_serialization_filter", true));                    \
+                if (filter != nullptr)                                         \
+                {                                                              \
+                    /* track the compression ratio for this action */          \
+                    static hpx::plugins::compression::lz4_compression_state    \
+                        state;                                                 \
+                    filter->set_state(&state);                                 \
+                    if ((threshold) != static_cast<std::size_t>(-1))           \
+                        filter->set_threshold(threshold);                      \
+                }                                                              \
+                return filter;                                                 \
+            }                                                                  \
+        };                                                                     \
+    }
+
+// Use the threshold configured by
+// hpx.plugins.lz4_serialization_filter.threshold
+#define HPX_ACTION_USES_LZ4_COMPRESSION(action)                                \
+    HPX_ACTION_USES_LZ4_COMPRESSION_THRESHOLD(                                 \
+        action, static_cast<std::size_t>(-1))
+
+#else
+
+#define HPX_ACTION_USES_LZ4_COMPRESSION_THRESHOLD(action, threshold)
+#define HPX_ACTION_USES_LZ4_COMPRESSION(action)
+
+#endif
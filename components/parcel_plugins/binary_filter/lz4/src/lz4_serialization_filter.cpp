@@ -0,0 +1,347 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/binary_filter/lz4_serialization_filter.hpp>
+#include <hpx/components_base/component_startup_shutdown.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include <lz4.h>
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.lz4_serialization_filter]
+    //      ...
+    //      threshold = 1024
+    //      acceleration = 1
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::lz4_serialization_filter>
+    {
+        static constexpr char const* call() noexcept
+        {
+            // messages smaller than 'threshold' bytes are not compressed,
+            // 'acceleration' trades compression ratio for speed (see
+            // LZ4_compress_fast)
+            return "threshold = ${HPX_LZ4_COMPRESSION_THRESHOLD:1024}\n"
+                   "acceleration = ${HPX_LZ4_COMPRESSION_ACCELERATION:1}";
+        }
+    };
+}    // namespace hpx::traits
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::lz4_serialization_filter,
+    lz4_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace detail {
+
+        // the first byte of the data written by the filter tells whether the
+        // remaining data is compressed
+        enum lz4_message_type : char
+        {
+            stored = 0,
+            compressed = 1
+        };
+
+        // stop compressing messages of an action if the compressed size
+        // exceeds this ratio (in 1/1024th), but try again every so often
+        constexpr std::uint32_t max_compression_ratio = 896;
+        constexpr std::uint32_t probe_interval = 16;
+
+        struct lz4_settings
+        {
+            std::size_t threshold;
+            int acceleration;
+        };
+
+        lz4_settings const& get_settings()
+        {
+            static lz4_settings const settings = {
+                hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                    "hpx.plugins.lz4_serialization_filter.threshold",
+                    std::size_t(1024))),
+                (std::max)(hpx::util::from_string<int>(hpx::get_config_entry(
+                               "hpx.plugins.lz4_serialization_filter."
+                               "acceleration",
+                               std::size_t(1))),
+                    1)};
+            return settings;
+        }
+
+        // used for the messages of actions which do not have their own state
+        lz4_compression_state default_state;
+
+        // performance counter data
+        std::atomic<std::int64_t> bytes_saved(0);
+        std::atomic<std::int64_t> compression_time(0);
+        std::atomic<std::int64_t> uncompressed_messages(0);
+
+        std::int64_t get_counter_value(
+            std::atomic<std::int64_t>& counter, bool reset)
+        {
+            return reset ? counter.exchange(0, std::memory_order_relaxed) :
+                           counter.load(std::memory_order_relaxed);
+        }
+
+        void update_compression_ratio(lz4_compression_state& state,
+            std::size_t size, std::size_t compressed_size) noexcept
+        {
+            auto const ratio = static_cast<std::uint32_t>(
+                (std::min)(compressed_size * 1024 / size, std::size_t(2048)));
+
+            std::uint32_t const average =
+                state.ratio.load(std::memory_order_relaxed);
+            state.ratio.store(average == 0 ? ratio : (3 * average + ratio) / 4,
+                std::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void startup()
+        {
+            using namespace hpx::performance_counters;
+
+            install_counter_type("/compression/lz4/count/bytes-saved",
+                [](bool reset) {
+                    return get_counter_value(bytes_saved, reset);
+                },
+                "returns the number of bytes saved by compressing parcel "
+                "data using LZ4",
+                "", counter_type::monotonically_increasing);
+
+            install_counter_type("/compression/lz4/count/uncompressed-messages",
+                [](bool reset) {
+                    return get_counter_value(uncompressed_messages, reset);
+                },
+                "returns the number of messages sent uncompressed because "
+                "those were too small or turned out to be incompressible",
+                "", counter_type::monotonically_increasing);
+
+            install_counter_type("/compression/lz4/time/compression",
+                [](bool reset) {
+                    return get_counter_value(compression_time, reset);
+                },
+                "returns the overall time spent compressing parcel data "
+                "using LZ4",
+                "ns", counter_type::monotonically_increasing);
+        }
+
+        bool get_startup(
+            hpx::startup_function_type& startup_func, bool& pre_startup)
+        {
+            startup_func = startup;    // function to run during startup
+            pre_startup = true;        // run 'startup' as pre-startup function
+            return true;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    lz4_serialization_filter::lz4_serialization_filter(bool compress,
+        serialization::binary_filter* /* next_filter */)
+      : current_(0)
+      , threshold_(compress ? detail::get_settings().threshold : 0)
+      , state_(&detail::default_state)
+    {
+    }
+
+    void lz4_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t lz4_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        char const* src = static_cast<char const*>(buffer);
+        if (size == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::init_data",
+                "archive data bstream is too short");
+        }
+
+        buffer_.resize(buffer_size);
+        if (src[0] == detail::stored)
+        {
+            if (size - 1 < buffer_size)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "lz4_serialization_filter::init_data",
+                    "archive data bstream is too short");
+            }
+            std::memcpy(buffer_.data(), src + 1, buffer_size);
+        }
+        else
+        {
+            int const decompressed = LZ4_decompress_safe(src + 1,
+                buffer_.data(), static_cast<int>(size - 1),
+                static_cast<int>(buffer_size));
+
+            if (decompressed < 0 ||
+                static_cast<std::size_t>(decompressed) != buffer_size)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "lz4_serialization_filter::init_data",
+                    "decompression failure, corrupted archive data");
+            }
+        }
+
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::save(void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(
+            src_begin, src_begin + src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Compress messages as long as this saves enough space, otherwise compress
+    // only every probe_interval'th message to detect changes in the data.
+    bool lz4_serialization_filter::compress_message() const noexcept
+    {
+        if (buffer_.size() < threshold_ ||
+            buffer_.size() > static_cast<std::size_t>(LZ4_MAX_INPUT_SIZE))
+        {
+            return false;
+        }
+
+        if (state_->ratio.load(std::memory_order_relaxed) <=
+            detail::max_compression_ratio)
+        {
+            return true;
+        }
+
+        if (state_->skipped.fetch_add(1, std::memory_order_relaxed) + 1 <
+            detail::probe_interval)
+        {
+            return false;
+        }
+
+        state_->skipped.store(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool lz4_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        // make sure we have enough memory for both, compressed and stored data
+        std::size_t const size = buffer_.size();
+        std::size_t const needed =
+            size > static_cast<std::size_t>(LZ4_MAX_INPUT_SIZE) ?
+            size + 1 :
+            (std::max)(static_cast<std::size_t>(
+                           LZ4_compressBound(static_cast<int>(size))),
+                size) +
+                1;
+
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        char* dst_begin = static_cast<char*>(dst);
+        if (compress_message())
+        {
+            hpx::chrono::high_resolution_timer const timer;
+
+            int const compressed_size = LZ4_compress_fast(buffer_.data(),
+                dst_begin + 1, static_cast<int>(size),
+                static_cast<int>((std::min)(dst_count - 1,
+                    static_cast<std::size_t>(
+                        (std::numeric_limits<int>::max)()))),
+                detail::get_settings().acceleration);
+
+            detail::compression_time.fetch_add(timer.elapsed_nanoseconds(),
+                std::memory_order_relaxed);
+
+            if (compressed_size <= 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "lz4_serialization_filter::flush",
+                    "compression failure, flushing did not reach end of data");
+                return false;
+            }
+
+            auto const compressed = static_cast<std::size_t>(compressed_size);
+            detail::update_compression_ratio(*state_, size, compressed);
+
+            if (compressed < size)
+            {
+                dst_begin[0] = detail::compressed;
+                written = compressed + 1;
+
+                detail::bytes_saved.fetch_add(
+                    static_cast<std::int64_t>(size - compressed),
+                    std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        // send the data as is
+        dst_begin[0] = detail::stored;
+        std::memcpy(dst_begin + 1, buffer_.data(), size);
+        written = size + 1;
+
+        detail::uncompressed_messages.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+///////////////////////////////////////////////////////////////////////////////
+// Register a startup function which will be called as a HPX-thread during
+// runtime startup. We use this function to register our performance counter
+// types.
+HPX_REGISTER_STARTUP_MODULE_DYNAMIC(
+    hpx::plugins::compression::detail::get_startup)
+
+#endif
@@ -18,6 +18,7 @@
 #include <hpx/parcel_coalescing/message_buffer.hpp>
 #include <hpx/parcelset_base/policies/message_handler.hpp>
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -56,6 +57,8 @@ namespace hpx::plugins::parcel {
         std::int64_t get_messages_count(bool reset);
         std::int64_t get_parcels_per_message_count(bool reset);
         std::int64_t get_average_time_between_parcels(bool reset);
+        std::int64_t get_max_parcels_per_message(bool reset);
+        std::int64_t get_flush_interval(bool reset);
         std::vector<std::int64_t> get_time_between_parcels_histogram(
             bool reset);
         void get_time_between_parcels_histogram_creator(
@@ -74,12 +77,21 @@ namespace hpx::plugins::parcel {
 
         void update_num_messages();
         void update_interval();
+        void update_adaptive();
+        void update_latency_target();
+
+        void record_arrival(std::int64_t time_since_last_parcel);
+        void record_flush(std::int64_t now);
+        void adapt_parameters();
 
     private:
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
         std::size_t num_coalesced_parcels_;
         std::size_t interval_;
+        std::size_t max_coalesced_parcels_;
+        std::size_t latency_target_;
+        bool adaptive_;
         detail::message_buffer buffer_;
         util::pool_timer timer_;
         bool stopped_;
@@ -106,6 +118,17 @@ namespace hpx::plugins::parcel {
         std::int64_t histogram_min_boundary_;
         std::int64_t histogram_max_boundary_;
         std::int64_t histogram_num_buckets_;
+
+        // data used to adapt the number of coalesced parcels and the flush
+        // interval to the parcel arrival rate, the arrival times are collected
+        // in buckets of power-of-two sizes (in nanoseconds)
+        static constexpr std::size_t num_arrival_buckets = 40;
+
+        std::array<std::size_t, num_arrival_buckets> arrival_buckets_;
+        std::size_t num_arrivals_;
+        std::int64_t first_parcel_time_;
+        std::int64_t flush_delays_;
+        std::size_t num_flushes_;
     };
 }    // namespace hpx::plugins::parcel
 
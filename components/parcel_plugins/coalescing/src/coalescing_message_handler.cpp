@@ -23,6 +23,7 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -42,6 +43,11 @@ namespace hpx::traits {
     //      num_messages = 50
     //      interval = 100
     //
+    // If 'adaptive' is enabled, the number of coalesced parcels and the flush
+    // interval (in microseconds) are tuned at runtime such that parcels are
+    // not delayed by more than 'latency_target' microseconds. 'num_messages'
+    // is the upper limit for the number of coalesced parcels in this case.
+    //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
     {
@@ -49,7 +55,9 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "latency_target = 100";
         }
     };
 }    // namespace hpx::traits
@@ -84,13 +92,47 @@ namespace hpx::plugins::parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        std::size_t get_latency_target(std::size_t latency_target)
+        {
+            return (std::max)(hpx::util::from_string<std::size_t>(
+                                  hpx::get_config_entry(
+                                      "hpx.plugins.coalescing_message_handler."
+                                      "latency_target",
+                                      latency_target)),
+                std::size_t(1));
+        }
+
+        // index of the power-of-two sized bucket the given time falls into
+        std::size_t get_arrival_bucket(
+            std::int64_t time, std::size_t num_buckets)
+        {
+            std::size_t bucket = 0;
+            while (time > 1 && bucket != num_buckets - 1)
+            {
+                time >>= 1;
+                ++bucket;
+            }
+            return bucket;
+        }
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        num_coalesced_parcels_ =
-            detail::get_num_messages(num_coalesced_parcels_);
+        max_coalesced_parcels_ =
+            detail::get_num_messages(max_coalesced_parcels_);
+        if (!adaptive_ || num_coalesced_parcels_ > max_coalesced_parcels_)
+        {
+            num_coalesced_parcels_ = max_coalesced_parcels_;
+        }
     }
 
     void coalescing_message_handler::update_interval()
@@ -99,12 +141,45 @@ namespace hpx::plugins::parcel {
         interval_ = detail::get_interval(interval_);
     }
 
+    void coalescing_message_handler::update_adaptive()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        bool const adaptive = detail::get_adaptive();
+        if (adaptive == adaptive_)
+            return;
+
+        adaptive_ = adaptive;
+
+        // start over using the configured values
+        num_coalesced_parcels_ = max_coalesced_parcels_;
+        interval_ =
+            adaptive_ ? latency_target_ : detail::get_interval(interval_);
+
+        arrival_buckets_.fill(0);
+        num_arrivals_ = 0;
+        flush_delays_ = 0;
+        num_flushes_ = 0;
+    }
+
+    void coalescing_message_handler::update_latency_target()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        latency_target_ = detail::get_latency_target(latency_target_);
+        if (adaptive_)
+        {
+            interval_ = (std::min)(interval_, latency_target_);
+        }
+    }
+
     coalescing_message_handler::coalescing_message_handler(
         char const* action_name, parcelset::parcelport* pp, std::size_t num,
         std::size_t interval)
       : pp_(pp)
       , num_coalesced_parcels_(detail::get_num_messages(num))
       , interval_(detail::get_interval(interval))
+      , max_coalesced_parcels_(num_coalesced_parcels_)
+      , latency_target_(detail::get_latency_target(interval_))
+      , adaptive_(detail::get_adaptive())
       , buffer_(num_coalesced_parcels_)
       , timer_(hpx::bind_back(&coalescing_message_handler::timer_flush, this),
             hpx::bind_back(&coalescing_message_handler::flush_terminate, this),
@@ -124,7 +199,16 @@ namespace hpx::plugins::parcel {
       , histogram_min_boundary_(-1)
       , histogram_max_boundary_(-1)
       , histogram_num_buckets_(-1)
+      , arrival_buckets_()
+      , num_arrivals_(0)
+      , first_parcel_time_(0)
+      , flush_delays_(0)
+      , num_flushes_(0)
     {
+        // the flush interval is tuned starting from the latency target
+        if (adaptive_)
+            interval_ = latency_target_;
+
         // register performance counter functions
         coalescing_counter_registry::instance().register_action(action_name,
             hpx::bind_front(
@@ -139,7 +223,11 @@ namespace hpx::plugins::parcel {
                 this),
             hpx::bind_front(&coalescing_message_handler::
                                 get_time_between_parcels_histogram_creator,
-                this));
+                this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_max_parcels_per_message, this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_flush_interval, this));
 
         // register parameter update callbacks
         set_config_entry_callback(
@@ -148,6 +236,13 @@ namespace hpx::plugins::parcel {
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             hpx::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.adaptive",
+            hpx::bind(&coalescing_message_handler::update_adaptive, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.latency_target",
+            hpx::bind(
+                &coalescing_message_handler::update_latency_target, this));
     }
 
     void coalescing_message_handler::put_parcel(parcelset::locality const& dest,
@@ -165,6 +260,9 @@ namespace hpx::plugins::parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        if (adaptive_)
+            record_arrival(time_since_last_parcel);
+
         std::chrono::microseconds interval(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
@@ -181,6 +279,10 @@ namespace hpx::plugins::parcel {
             return;
         }
 
+        // remember when the first parcel of the next message was buffered
+        if (buffer_.empty())
+            first_parcel_time_ = parcel_time;
+
         detail::message_buffer::message_buffer_append_state s =
             buffer_.append(dest, HPX_MOVE(p), HPX_MOVE(f));
 
@@ -272,6 +374,9 @@ namespace hpx::plugins::parcel {
         if (buffer_.empty())
             return false;
 
+        if (adaptive_)
+            record_flush(hpx::chrono::high_resolution_clock::now());
+
         detail::message_buffer buff(num_coalesced_parcels_);
         std::swap(buff, buffer_);
 
@@ -284,6 +389,91 @@ namespace hpx::plugins::parcel {
         return true;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The adaptive mode chooses the number of coalesced parcels such that a
+    // message is expected to fill up within the latency target, based on the
+    // median time between parcels. The flush interval bounds the delay of
+    // messages that do not fill up, it is shortened if the measured delays
+    // (including the timer overheads) exceed the latency target.
+    void coalescing_message_handler::record_arrival(
+        std::int64_t time_since_last_parcel)
+    {
+        // number of parcels after which the parameters are re-evaluated
+        constexpr std::size_t adaptation_window = 64;
+
+        ++arrival_buckets_[detail::get_arrival_bucket(
+            time_since_last_parcel, num_arrival_buckets)];
+
+        if (++num_arrivals_ >= adaptation_window)
+            adapt_parameters();
+    }
+
+    void coalescing_message_handler::record_flush(std::int64_t now)
+    {
+        HPX_ASSERT(now >= first_parcel_time_);
+        flush_delays_ += now - first_parcel_time_;
+        ++num_flushes_;
+    }
+
+    void coalescing_message_handler::adapt_parameters()
+    {
+        // find the bucket holding the median of the times between parcels
+        std::size_t const half = (num_arrivals_ + 1) / 2;
+        std::size_t count = 0;
+        std::size_t bucket = 0;
+        for (/**/; bucket != num_arrival_buckets - 1; ++bucket)
+        {
+            count += arrival_buckets_[bucket];
+            if (count >= half)
+                break;
+        }
+
+        // use the center of the bucket [2^bucket, 2^(bucket+1))
+        std::int64_t const time_between_parcels =
+            bucket == 0 ? 1 : std::int64_t(3) << (bucket - 1);
+        std::int64_t const latency_target =
+            static_cast<std::int64_t>(latency_target_) * 1000;    // [ns]
+
+        // the first parcel in a message waits for all others to arrive
+        std::size_t const num_parcels = (std::min)(
+            static_cast<std::size_t>(
+                1 + latency_target / time_between_parcels),
+            max_coalesced_parcels_);
+
+        // smooth out the changes to avoid oscillations
+        num_coalesced_parcels_ =
+            (std::max)((num_coalesced_parcels_ + num_parcels + 1) / 2,
+                std::size_t(1));
+
+        if (num_flushes_ != 0)
+        {
+            std::int64_t const delay =
+                flush_delays_ / static_cast<std::int64_t>(num_flushes_);
+            if (delay > latency_target)
+            {
+                interval_ = (std::max)(
+                    static_cast<std::size_t>(
+                        static_cast<std::int64_t>(interval_) * latency_target /
+                        delay),
+                    std::size_t(1));
+            }
+            else if (interval_ < latency_target_)
+            {
+                // move back towards the latency target
+                interval_ += (latency_target_ - interval_ + 1) / 2;
+            }
+            else
+            {
+                interval_ = latency_target_;
+            }
+        }
+
+        arrival_buckets_.fill(0);
+        num_arrivals_ = 0;
+        flush_delays_ = 0;
+        num_flushes_ = 0;
+    }
+
     // performance counter values
     std::int64_t coalescing_message_handler::get_average_time_between_parcels(
         bool reset)
@@ -358,6 +548,20 @@ namespace hpx::plugins::parcel {
         return num_parcels / num_messages;
     }
 
+    std::int64_t coalescing_message_handler::get_max_parcels_per_message(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(num_coalesced_parcels_);
+    }
+
+    std::int64_t coalescing_message_handler::get_flush_interval(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(interval_) * 1000;    // [ns]
+    }
+
     std::int64_t coalescing_message_handler::get_messages_count(bool reset)
     {
         std::unique_lock<mutex_type> l(mtx_);
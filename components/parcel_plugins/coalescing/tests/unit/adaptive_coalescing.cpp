@@ -0,0 +1,128 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the adaptive coalescing message handler tunes the number of
+// parcels per message to the rate at which parcels are sent: parcels sent
+// far apart are not held back waiting for others, while bursts of parcels
+// are packed into larger messages.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/actions.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// the parameters are re-evaluated after this many parcels
+constexpr std::size_t adaptation_window = 64;
+
+// upper limit for the number of parcels per message
+constexpr std::int64_t max_parcels_per_message = 50;
+
+std::atomic<std::size_t> received(0);
+
+void receive()
+{
+    ++received;
+}
+HPX_DECLARE_PLAIN_ACTION(receive, receive_action)
+HPX_ACTION_USES_MESSAGE_COALESCING(receive_action)
+HPX_PLAIN_ACTION(receive, receive_action)
+
+std::size_t get_received()
+{
+    return received.load();
+}
+HPX_PLAIN_ACTION(get_received, get_received_action)
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_parcels_per_message()
+{
+    hpx::performance_counters::performance_counter c(
+        "/coalescing{locality#0/total}/count/"
+        "max-parcels-per-message@receive_action");
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+void wait_for_parcels(hpx::id_type const& id, std::size_t count)
+{
+    while (hpx::async(get_received_action(), id).get() != count)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::vector<hpx::id_type> const localities = hpx::find_remote_localities();
+    HPX_TEST(!localities.empty());
+
+    // the parameters are tuned per action, only one destination is used
+    hpx::id_type const& id = localities.front();
+    std::size_t sent = 0;
+
+    // parcels sent far apart (compared to the latency target of 100us) should
+    // not wait for others to arrive
+    for (std::size_t i = 0; i != 4 * adaptation_window; ++i)
+    {
+        hpx::post(receive_action(), id);
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    sent += 4 * adaptation_window;
+    wait_for_parcels(id, sent);
+
+    std::int64_t const slow = get_parcels_per_message();
+    HPX_TEST_LT(slow, max_parcels_per_message);
+    HPX_TEST_LTE(std::int64_t(1), slow);
+
+    // bursts of parcels should be coalesced into larger messages
+    for (std::size_t i = 0; i != 8 * adaptation_window; ++i)
+    {
+        hpx::post(receive_action(), id);
+    }
+    sent += 8 * adaptation_window;
+    wait_for_parcels(id, sent);
+
+    std::int64_t const fast = get_parcels_per_message();
+    HPX_TEST_LT(slow, fast);
+    HPX_TEST_LTE(fast, max_parcels_per_message);
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // explicitly enable message handlers (parcel coalescing) with the
+    // adaptive parameters
+    std::vector<std::string> const cfg = {"hpx.parcel.message_handlers=1",
+        "hpx.plugins.coalescing_message_handler.adaptive=1",
+        "hpx.plugins.coalescing_message_handler.num_messages=" +
+            std::to_string(max_parcels_per_message),
+        "hpx.plugins.coalescing_message_handler.latency_target=100"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
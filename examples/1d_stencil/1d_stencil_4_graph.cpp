@@ -0,0 +1,292 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This example builds on example four. Instead of building the same
+// dependency tree using hpx::dataflow for every time step, the tree for a
+// couple of time steps is recorded once as a task graph, which is then
+// launched repeatedly. Both variants are run and their execution time per
+// time step is reported, which shows the overhead saved by replaying the
+// task graph. Use a small number of points per partition (--nx) to make
+// the overhead visible.
+
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/format.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Command-line variables
+bool header = true;    // print csv heading
+double k = 0.5;        // heat transfer coefficient
+double dt = 1.;        // time step
+double dx = 1.;        // grid spacing
+
+inline std::size_t idx(std::size_t i, int dir, std::size_t size)
+{
+    if (i == 0 && dir == -1)
+        return size - 1;
+    if (i == size - 1 && dir == +1)
+        return 0;
+
+    return i + dir;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// All partitions are allocated up front, every time step writes its results
+// into the buffers which were read by the time step before.
+using partition_data = std::vector<double>;
+using space = std::vector<partition_data>;
+
+struct stepper
+{
+    stepper(std::size_t np, std::size_t nx)
+      : U(2, space(np, partition_data(nx)))
+    {
+    }
+
+    void init()
+    {
+        // Initial conditions: f(0, i) = i
+        std::size_t const np = U[0].size();
+        for (std::size_t i = 0; i != np; ++i)
+        {
+            partition_data& p = U[0][i];
+            std::size_t const nx = p.size();
+            for (std::size_t j = 0; j != nx; ++j)
+            {
+                p[j] = static_cast<double>(i * nx + j);
+            }
+        }
+    }
+
+    // Our operator
+    static double heat(double left, double middle, double right)
+    {
+        return middle + (k * dt / (dx * dx)) * (left - 2 * middle + right);
+    }
+
+    // The partitioned operator, it invokes the heat operator above on all
+    // elements of partition 'i' for time step 't'.
+    void heat_part(std::size_t t, std::size_t i)
+    {
+        space const& current = U[t % 2];
+        std::size_t const np = current.size();
+
+        partition_data const& left = current[idx(i, -1, np)];
+        partition_data const& middle = current[i];
+        partition_data const& right = current[idx(i, +1, np)];
+        partition_data& next = U[(t + 1) % 2][i];
+
+        std::size_t const size = middle.size();
+
+        next[0] = heat(left[size - 1], middle[0], middle[1]);
+
+        for (std::size_t j = 1; j != size - 1; ++j)
+        {
+            next[j] = heat(middle[j - 1], middle[j], middle[j + 1]);
+        }
+
+        next[size - 1] = heat(middle[size - 2], middle[size - 1], right[0]);
+    }
+
+    // Build the dependency tree for all time steps using hpx::dataflow.
+    void do_work_dataflow(std::size_t nt)
+    {
+        std::size_t const np = U[0].size();
+
+        std::vector<hpx::shared_future<void>> current(
+            np, hpx::make_ready_future());
+        std::vector<hpx::shared_future<void>> next(np);
+
+        for (std::size_t t = 0; t != nt; ++t)
+        {
+            for (std::size_t i = 0; i != np; ++i)
+            {
+                next[i] = hpx::dataflow(
+                    hpx::launch::async,
+                    [this, t, i](auto&&...) { heat_part(t, i); },
+                    current[idx(i, -1, np)], current[i],
+                    current[idx(i, +1, np)]);
+            }
+            std::swap(current, next);
+        }
+
+        hpx::wait_all(current);
+    }
+
+    // Record the dependency tree for 'ns' time steps once and launch it
+    // repeatedly. As the buffers are used alternately, 'ns' has to be even.
+    void do_work_graph(std::size_t nt, std::size_t ns)
+    {
+        namespace ex = hpx::execution::experimental;
+
+        std::size_t const np = U[0].size();
+
+        ex::task_graph g;
+        std::vector<ex::task_graph::node> current;
+        std::vector<ex::task_graph::node> next;
+
+        for (std::size_t t = 0; t != ns; ++t)
+        {
+            next.clear();
+            for (std::size_t i = 0; i != np; ++i)
+            {
+                auto f = [this, t, i]() { heat_part(t, i); };
+                if (t == 0)
+                {
+                    next.push_back(g.add_node(f));
+                }
+                else
+                {
+                    next.push_back(g.add_node(f,
+                        {current[idx(i, -1, np)], current[i],
+                            current[idx(i, +1, np)]}));
+                }
+            }
+            std::swap(current, next);
+        }
+
+        ex::task_graph_executable graph = g.instantiate();
+
+        auto exec = hpx::execution::par.executor();
+        for (std::size_t t = 0; t != nt; t += ns)
+        {
+            graph.launch(exec).get();
+        }
+    }
+
+    std::vector<space> U;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void print_time_results(char const* method, std::uint64_t num_os_threads,
+    std::uint64_t elapsed, std::uint64_t nx, std::uint64_t np,
+    std::uint64_t nt)
+{
+    if (header)
+    {
+        std::cout << "Method,OS_Threads,Execution_Time_sec,"
+                     "Time_per_Step_us,Points_per_Partition,Partitions,"
+                     "Time_Steps\n"
+                  << std::flush;
+        header = false;
+    }
+
+    hpx::util::format_to(std::cout, "{}, {}, {:.14g}, {:.14g}, {}, {}, {}\n",
+        method, num_os_threads, elapsed / 1e9,
+        static_cast<double>(elapsed) / 1e3 / nt, nx, np, nt)
+        << std::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t np = vm["np"].as<std::uint64_t>();    // Number of partitions.
+    std::uint64_t nx =
+        vm["nx"].as<std::uint64_t>();    // Number of grid points.
+    std::uint64_t nt = vm["nt"].as<std::uint64_t>();    // Number of steps.
+    std::uint64_t ns =
+        vm["ns"].as<std::uint64_t>();    // Number of steps per graph.
+
+    if (vm.count("no-header"))
+        header = false;
+
+    if (nx < 2 || ns == 0 || ns % 2 != 0 || nt % ns != 0)
+    {
+        std::cerr << "1d_stencil_4_graph: --nx must be at least 2, --ns must "
+                     "be even, and --nt must be a multiple of --ns\n";
+        return hpx::local::finalize();
+    }
+
+    std::uint64_t const os_thread_count = hpx::get_os_thread_count();
+
+    stepper dataflow_step(np, nx);
+    dataflow_step.init();
+    {
+        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+        dataflow_step.do_work_dataflow(nt);
+        std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now() - t;
+
+        print_time_results("dataflow", os_thread_count, elapsed, nx, np, nt);
+    }
+
+    stepper graph_step(np, nx);
+    graph_step.init();
+    {
+        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+        graph_step.do_work_graph(nt, ns);
+        std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now() - t;
+
+        print_time_results("task_graph", os_thread_count, elapsed, nx, np, nt);
+    }
+
+    // both variants have to produce the same solution
+    if (dataflow_step.U[nt % 2] != graph_step.U[nt % 2])
+    {
+        std::cerr << "1d_stencil_4_graph: the results of both variants "
+                     "differ\n";
+    }
+
+    // Print the final solution
+    if (vm.count("results"))
+    {
+        for (std::size_t i = 0; i != np; ++i)
+        {
+            std::cout << "U[" << i << "] = {";
+            for (std::size_t j = 0; j != nx; ++j)
+            {
+                if (j != 0)
+                    std::cout << ", ";
+                std::cout << graph_step.U[nt % 2][i][j];
+            }
+            std::cout << "}\n";
+        }
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    // Configure application-specific options.
+    options_description desc_commandline;
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("results", "print generated results (default: false)")
+        ("nx", value<std::uint64_t>()->default_value(10),
+         "Local x dimension (of each partition)")
+        ("nt", value<std::uint64_t>()->default_value(100),
+         "Number of time steps")
+        ("ns", value<std::uint64_t>()->default_value(10),
+         "Number of time steps recorded in the task graph (must be even)")
+        ("np", value<std::uint64_t>()->default_value(10),
+         "Number of partitions")
+        ("k", value<double>(&k)->default_value(0.5),
+         "Heat transfer coefficient (default: 0.5)")
+        ("dt", value<double>(&dt)->default_value(1.0),
+         "Timestep unit (default: 1.0[s])")
+        ("dx", value<double>(&dx)->default_value(1.0),
+         "Local x dimension")
+        ( "no-header", "do not print out the csv header row")
+    ;
+    // clang-format on
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
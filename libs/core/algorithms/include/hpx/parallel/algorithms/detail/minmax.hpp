@@ -0,0 +1,275 @@
+//  Copyright (c) 2014-2016 Hartmut Kaiser
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/is_value_proxy.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel {
+
+    template <typename T>
+    using minmax_element_result = hpx::parallel::util::min_max_result<T>;
+}    // namespace hpx::parallel
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // find the first smallest element
+    template <typename ExPolicy>
+    struct sequential_min_element_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_min_element_t<ExPolicy>>
+    {
+    private:
+        template <typename ExPolicy_, typename FwdIter, typename Sent,
+            typename F, typename Proj>
+        friend constexpr FwdIter tag_fallback_invoke(sequential_min_element_t,
+            ExPolicy_&& policy, FwdIter first, Sent last, F const& f,
+            Proj const& proj)
+        {
+            if (first == last)
+                return first;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            auto smallest = first;
+
+            element_type value = HPX_INVOKE(proj, *smallest);
+            util::loop(HPX_FORWARD(ExPolicy_, policy), ++first, last,
+                [&](FwdIter const& curr) -> void {
+                    element_type curr_value = HPX_INVOKE(proj, *curr);
+                    if (HPX_INVOKE(f, curr_value, value))
+                    {
+                        smallest = curr;
+                        value = HPX_MOVE(curr_value);
+                    }
+                });
+
+            return smallest;
+        }
+
+        template <typename FwdIter, typename F, typename Proj>
+        friend constexpr FwdIter tag_fallback_invoke(sequential_min_element_t,
+            FwdIter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            auto smallest = it;
+
+            element_type value = HPX_INVOKE(proj, *smallest);
+            util::loop_n<ExPolicy>(
+                ++it, count - 1, [&](FwdIter const& curr) -> void {
+                    element_type curr_value = HPX_INVOKE(proj, *curr);
+                    if (HPX_INVOKE(f, curr_value, value))
+                    {
+                        smallest = curr;
+                        value = HPX_MOVE(curr_value);
+                    }
+                });
+
+            return smallest;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_min_element_t<ExPolicy>
+        sequential_min_element = sequential_min_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_min_element(Args&&... args)
+    {
+        return sequential_min_element_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // find the last largest element
+    template <typename ExPolicy>
+    struct sequential_max_element_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_max_element_t<ExPolicy>>
+    {
+    private:
+        template <typename ExPolicy_, typename FwdIter, typename Sent,
+            typename F, typename Proj>
+        friend constexpr FwdIter tag_fallback_invoke(sequential_max_element_t,
+            ExPolicy_&& policy, FwdIter first, Sent last, F const& f,
+            Proj const& proj)
+        {
+            if (first == last)
+                return first;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            auto largest = first;
+
+            element_type value = HPX_INVOKE(proj, *largest);
+            util::loop(HPX_FORWARD(ExPolicy_, policy), ++first, last,
+                [&](FwdIter const& curr) -> void {
+                    element_type curr_value = HPX_INVOKE(proj, *curr);
+                    if (!HPX_INVOKE(f, curr_value, value))
+                    {
+                        largest = curr;
+                        value = HPX_MOVE(curr_value);
+                    }
+                });
+
+            return largest;
+        }
+
+        template <typename FwdIter, typename F, typename Proj>
+        friend constexpr FwdIter tag_fallback_invoke(sequential_max_element_t,
+            FwdIter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            auto largest = it;
+
+            element_type value = HPX_INVOKE(proj, *largest);
+            util::loop_n<ExPolicy>(
+                ++it, count - 1, [&](FwdIter const& curr) -> void {
+                    element_type curr_value = HPX_INVOKE(proj, *curr);
+                    if (!HPX_INVOKE(f, curr_value, value))
+                    {
+                        largest = curr;
+                        value = HPX_MOVE(curr_value);
+                    }
+                });
+
+            return largest;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_max_element_t<ExPolicy>
+        sequential_max_element = sequential_max_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_max_element(Args&&... args)
+    {
+        return sequential_max_element_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // find the first smallest and the last largest element
+    template <typename ExPolicy>
+    struct sequential_minmax_element_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_minmax_element_t<ExPolicy>>
+    {
+    private:
+        template <typename ExPolicy_, typename FwdIter, typename Sent,
+            typename F, typename Proj>
+        friend constexpr minmax_element_result<FwdIter> tag_fallback_invoke(
+            sequential_minmax_element_t, ExPolicy_&& policy, FwdIter first,
+            Sent last, F const& f, Proj const& proj)
+        {
+            auto min = first, max = first;
+
+            if (first == last || ++first == last)
+            {
+                return minmax_element_result<FwdIter>{min, max};
+            }
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            element_type min_value = HPX_INVOKE(proj, *min);
+            element_type max_value = HPX_INVOKE(proj, *max);
+            util::loop(HPX_FORWARD(ExPolicy_, policy), first, last,
+                [&](FwdIter const& curr) -> void {
+                    element_type curr_value = HPX_INVOKE(proj, *curr);
+                    if (HPX_INVOKE(f, curr_value, min_value))
+                    {
+                        min = curr;
+                        min_value = curr_value;
+                    }
+
+                    if (!HPX_INVOKE(f, curr_value, max_value))
+                    {
+                        max = curr;
+                        max_value = HPX_MOVE(curr_value);
+                    }
+                });
+
+            return minmax_element_result<FwdIter>{min, max};
+        }
+
+        template <typename FwdIter, typename F, typename Proj>
+        friend constexpr minmax_element_result<FwdIter> tag_fallback_invoke(
+            sequential_minmax_element_t, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
+        {
+            minmax_element_result<FwdIter> result = {it, it};
+
+            if (count == 0 || count == 1)
+                return result;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            element_type min_value = HPX_INVOKE(proj, *it);
+            element_type max_value = min_value;
+            util::loop_n<ExPolicy>(
+                ++it, count - 1, [&](FwdIter const& curr) -> void {
+                    element_type curr_value = HPX_INVOKE(proj, *curr);
+                    if (HPX_INVOKE(f, curr_value, min_value))
+                    {
+                        result.min = curr;
+                        min_value = curr_value;
+                    }
+
+                    if (!HPX_INVOKE(f, curr_value, max_value))
+                    {
+                        result.max = curr;
+                        max_value = HPX_MOVE(curr_value);
+                    }
+                });
+
+            return result;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_minmax_element_t<ExPolicy>
+        sequential_minmax_element = sequential_minmax_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_minmax_element(
+        Args&&... args)
+    {
+        return sequential_minmax_element_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+}    // namespace hpx::parallel::detail
@@ -0,0 +1,573 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_local/dataflow.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // Sequences shorter than this are sorted using a comparison based sort.
+    inline constexpr std::size_t radix_sort_limit = 1 << 12;
+
+    // Minimal number of elements handled by each of the tasks.
+    inline constexpr std::size_t radix_sort_limit_per_task = 1 << 16;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Map arithmetic keys onto unsigned integers preserving their order.
+    template <typename T, typename Enable = void>
+    struct radix_key
+    {
+        static constexpr bool value = false;
+    };
+
+    template <typename T>
+    struct radix_key<T,
+        std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    {
+        static constexpr bool value = true;
+        using type = std::make_unsigned_t<T>;
+
+        static constexpr type call(T t) noexcept
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                // flip the sign bit to order negative values first
+                constexpr type sign = static_cast<type>(
+                    type(1) << (sizeof(T) * CHAR_BIT - 1));
+                return static_cast<type>(static_cast<type>(t) ^ sign);
+            }
+            else
+            {
+                return t;
+            }
+        }
+    };
+
+    template <typename T>
+    struct radix_key<T,
+        std::enable_if_t<std::is_floating_point_v<T> &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>>
+    {
+        static constexpr bool value = true;
+        using type = std::conditional_t<sizeof(T) == sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>;
+
+        static type call(T t) noexcept
+        {
+            // -0.0 and 0.0 compare equal, they must map to the same key to
+            // preserve the relative order of equal elements
+            if (t == T(0))
+            {
+                t = T(0);
+            }
+
+            type u;
+            std::memcpy(&u, &t, sizeof(T));
+
+            // negative values: invert all bits to reverse their order,
+            // positive values: set the sign bit to order them last
+            constexpr type sign = type(1) << (sizeof(T) * CHAR_BIT - 1);
+            return (u & sign) ? static_cast<type>(~u) : (u | sign);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Figure out whether a comparison function object orders its arguments
+    // ascending (1), descending (-1), or whether it's unknown (0).
+    template <typename Comp, typename Key>
+    struct radix_sort_order : std::integral_constant<int, 0>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_order<hpx::parallel::detail::less, Key>
+      : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_order<std::less<>, Key> : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_order<std::less<Key>, Key>
+      : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_order<hpx::parallel::detail::greater, Key>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_order<std::greater<>, Key>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_order<std::greater<Key>, Key>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A sequence can be radix sorted if the projected elements are arithmetic
+    // values that are compared using less or greater. The elements are
+    // (move-)assigned to a temporary buffer, which requires them to be
+    // default constructible.
+    template <typename Iter, typename Comp, typename Proj,
+        typename Enable = void>
+    struct is_radix_sortable : std::false_type
+    {
+    };
+
+    template <typename Iter, typename Comp, typename Proj>
+    struct is_radix_sortable<Iter, Comp, Proj,
+        std::enable_if_t<hpx::is_invocable_v<Proj&,
+                             typename std::iterator_traits<Iter>::reference> &&
+            hpx::is_invocable_v<Proj&,
+                typename std::iterator_traits<Iter>::value_type&>>>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using key_type = std::decay_t<hpx::util::invoke_result_t<Proj&,
+            typename std::iterator_traits<Iter>::reference>>;
+
+        static constexpr bool value = radix_key<key_type>::value &&
+            radix_sort_order<std::decay_t<Comp>, key_type>::value != 0 &&
+            std::is_default_constructible_v<value_type> &&
+            std::is_move_assignable_v<value_type>;
+    };
+
+    template <typename Iter, typename Comp, typename Proj>
+    inline constexpr bool is_radix_sortable_v =
+        is_radix_sortable<Iter, std::decay_t<Comp>, std::decay_t<Proj>>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parallel least significant digit (LSD) radix sort. The sequence is
+    // split into chunks, each of the passes (one per 8 bit digit of the key)
+    // counts the digits in each of the chunks, computes the position of each
+    // chunk's elements in the output from the digit counts, and scatters the
+    // elements of all chunks concurrently. Every pass is stable, thus the
+    // whole sort is stable. Passes over digits that are equal for all keys are
+    // skipped.
+    template <typename Iter, typename Proj, typename Key, bool Descending>
+    struct radix_sort_helper
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using key_type = typename radix_key<Key>::type;
+
+        static constexpr std::size_t digit_bits = 8;
+        static constexpr std::size_t num_buckets = std::size_t(1)
+            << digit_bits;
+        static constexpr std::size_t num_digits =
+            sizeof(key_type) * CHAR_BIT / digit_bits;
+
+        radix_sort_helper(Iter first, std::size_t count, Proj const& proj,
+            std::size_t nchunks)
+          : first_(first)
+          , count_(count)
+          , proj_(proj)
+          , nchunks_(nchunks)
+          , counts_(nchunks * num_digits * num_buckets)
+        {
+            HPX_ASSERT(nchunks_ != 0);
+        }
+
+        template <typename Ref>
+        key_type get_key(Ref&& ref)
+        {
+            key_type const key = radix_key<Key>::call(
+                HPX_INVOKE(proj_, HPX_FORWARD(Ref, ref)));
+
+            if constexpr (Descending)
+            {
+                return static_cast<key_type>(~key);
+            }
+            else
+            {
+                return key;
+            }
+        }
+
+        static constexpr std::size_t get_digit(
+            key_type key, std::size_t digit) noexcept
+        {
+            return static_cast<std::size_t>(
+                (key >> (digit * digit_bits)) & (num_buckets - 1));
+        }
+
+        std::size_t* get_counts(std::size_t chunk, std::size_t digit) noexcept
+        {
+            return counts_.data() + (chunk * num_digits + digit) * num_buckets;
+        }
+
+        constexpr std::size_t chunk_begin(std::size_t chunk) const noexcept
+        {
+            return chunk * count_ / nchunks_;
+        }
+
+        // count all digits of the keys of the given chunk in one go
+        void count_all_digits(std::size_t chunk)
+        {
+            std::size_t const end = chunk_begin(chunk + 1);
+            for (std::size_t i = chunk_begin(chunk); i != end; ++i)
+            {
+                key_type const key = get_key(*(first_ + i));
+                for (std::size_t digit = 0; digit != num_digits; ++digit)
+                {
+                    ++get_counts(chunk, digit)[get_digit(key, digit)];
+                }
+            }
+        }
+
+        template <typename Src>
+        void count_digit(Src src, std::size_t chunk, std::size_t digit)
+        {
+            std::size_t* counts = get_counts(chunk, digit);
+            std::fill(counts, counts + num_buckets, std::size_t(0));
+
+            std::size_t const end = chunk_begin(chunk + 1);
+            for (std::size_t i = chunk_begin(chunk); i != end; ++i)
+            {
+                ++counts[get_digit(get_key(*(src + i)), digit)];
+            }
+        }
+
+        // A digit does not need to be sorted if all keys share its value.
+        bool is_uniform_digit(std::size_t digit) noexcept
+        {
+            for (std::size_t bucket = 0; bucket != num_buckets; ++bucket)
+            {
+                std::size_t total = 0;
+                for (std::size_t chunk = 0; chunk != nchunks_; ++chunk)
+                {
+                    total += get_counts(chunk, digit)[bucket];
+                }
+
+                if (total == count_)
+                {
+                    return true;
+                }
+                if (total != 0)
+                {
+                    return false;
+                }
+            }
+            return false;
+        }
+
+        // Turn the digit counts into the output position of the first element
+        // of each of the chunks' buckets.
+        void compute_offsets(std::size_t digit) noexcept
+        {
+            std::size_t offset = 0;
+            for (std::size_t bucket = 0; bucket != num_buckets; ++bucket)
+            {
+                for (std::size_t chunk = 0; chunk != nchunks_; ++chunk)
+                {
+                    std::size_t& count = get_counts(chunk, digit)[bucket];
+                    std::size_t const current = count;
+                    count = offset;
+                    offset += current;
+                }
+            }
+        }
+
+        template <typename Src, typename Dest>
+        void scatter(Src src, Dest dest, std::size_t chunk, std::size_t digit)
+        {
+            std::size_t* offsets = get_counts(chunk, digit);
+
+            std::size_t const end = chunk_begin(chunk + 1);
+            for (std::size_t i = chunk_begin(chunk); i != end; ++i)
+            {
+                std::size_t const bucket = get_digit(get_key(*(src + i)), digit);
+                *(dest + offsets[bucket]++) = HPX_MOVE(*(src + i));
+            }
+        }
+
+        void move_back(value_type* buffer, std::size_t chunk)
+        {
+            std::size_t const end = chunk_begin(chunk + 1);
+            for (std::size_t i = chunk_begin(chunk); i != end; ++i)
+            {
+                *(first_ + i) = HPX_MOVE(buffer[i]);
+            }
+        }
+
+        // Perform the sequential work needed before the next step of the
+        // sort, return false if the sort is complete. Each step has to be
+        // executed for all chunks (see operator()) before calling this again.
+        bool next_step()
+        {
+            switch (step_)
+            {
+            case step::start:
+                step_ = step::count_all;
+                return true;
+
+            case step::count:
+                compute_offsets(digit_);
+                step_ = step::scatter;
+                return true;
+
+            case step::scatter:
+                in_buffer_ = !in_buffer_;
+                ++digit_;
+                [[fallthrough]];
+
+            case step::count_all:
+                return next_digit();
+
+            case step::move_back:
+                [[fallthrough]];
+            case step::done:
+                step_ = step::done;
+                break;
+            }
+            return false;
+        }
+
+        // execute the current step for the given chunk
+        void operator()(std::size_t chunk)
+        {
+            value_type* buffer_ptr = buffer_.get();
+            switch (step_)
+            {
+            case step::count_all:
+                count_all_digits(chunk);
+                break;
+
+            case step::count:
+                // the digit counts computed up front are valid for the
+                // initial order of the elements only
+                if (in_buffer_)
+                {
+                    count_digit(buffer_ptr, chunk, digit_);
+                }
+                else
+                {
+                    count_digit(first_, chunk, digit_);
+                }
+                break;
+
+            case step::scatter:
+                if (in_buffer_)
+                {
+                    scatter(buffer_ptr, first_, chunk, digit_);
+                }
+                else
+                {
+                    scatter(first_, buffer_ptr, chunk, digit_);
+                }
+                break;
+
+            case step::move_back:
+                move_back(buffer_ptr, chunk);
+                break;
+
+            default:
+                HPX_ASSERT(false);
+                break;
+            }
+        }
+
+        std::size_t size() const noexcept
+        {
+            return nchunks_;
+        }
+
+    private:
+        enum class step
+        {
+            start,
+            count_all,
+            count,
+            scatter,
+            move_back,
+            done
+        };
+
+        // skip all digits that are equal for all keys
+        bool next_digit()
+        {
+            while (digit_ != num_digits && is_uniform_digit(digit_))
+            {
+                ++digit_;
+            }
+
+            if (digit_ == num_digits)
+            {
+                step_ = in_buffer_ ? step::move_back : step::done;
+                return in_buffer_;
+            }
+
+            // leave memory uninitialized for trivial types
+            if (!buffer_)
+            {
+                buffer_.reset(new value_type[count_]);
+            }
+
+            if (scattered_)
+            {
+                step_ = step::count;
+            }
+            else
+            {
+                compute_offsets(digit_);
+                step_ = step::scatter;
+                scattered_ = true;
+            }
+            return true;
+        }
+
+        Iter first_;
+        std::size_t count_;
+        Proj proj_;
+        std::size_t nchunks_;
+        std::vector<std::size_t> counts_;
+
+        std::unique_ptr<value_type[]> buffer_;
+        step step_ = step::start;
+        std::size_t digit_ = 0;
+        bool in_buffer_ = false;
+        bool scattered_ = false;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter, typename Comp, typename Proj>
+    Iter sequential_radix_sort(Iter first, Iter last, Comp&&, Proj&& proj)
+    {
+        using key_type = std::decay_t<hpx::util::invoke_result_t<Proj&,
+            typename std::iterator_traits<Iter>::reference>>;
+        constexpr bool descending =
+            radix_sort_order<std::decay_t<Comp>, key_type>::value < 0;
+
+        std::size_t const count = std::distance(first, last);
+
+        radix_sort_helper<Iter, std::decay_t<Proj>, key_type, descending>
+            sorter(first, count, proj, 1);
+
+        while (sorter.next_step())
+        {
+            sorter(0);
+        }
+        return last;
+    }
+
+    // Run the remaining steps of the sort asynchronously, each step is
+    // started once all chunks have finished the previous one.
+    template <typename ExPolicy, typename Sorter>
+    hpx::future<void> parallel_radix_sort_steps(
+        ExPolicy policy, std::shared_ptr<Sorter> sorter)
+    {
+        if (!sorter->next_step())
+        {
+            return hpx::make_ready_future();
+        }
+
+        auto shape = hpx::util::iterator_range(
+            hpx::util::counting_iterator(static_cast<std::size_t>(0)),
+            hpx::util::counting_iterator(sorter->size()));
+
+        auto&& items = execution::bulk_async_execute(policy.executor(),
+            [sorter](std::size_t chunk) { (*sorter)(chunk); }, shape);
+
+        return hpx::dataflow(
+            hpx::launch::sync,
+            [policy = HPX_MOVE(policy), sorter = HPX_MOVE(sorter)](
+                auto&& items) mutable -> hpx::future<void> {
+                util::detail::handle_local_exceptions<ExPolicy>::call(items);
+                return parallel_radix_sort_steps(
+                    HPX_MOVE(policy), HPX_MOVE(sorter));
+            },
+            HPX_MOVE(items));
+    }
+
+    template <typename ExPolicy, typename Iter, typename Comp, typename Proj>
+    hpx::future<Iter> parallel_radix_sort(
+        ExPolicy&& policy, Iter first, Iter last, Comp&&, Proj&& proj)
+    {
+        using key_type = std::decay_t<hpx::util::invoke_result_t<Proj&,
+            typename std::iterator_traits<Iter>::reference>>;
+        constexpr bool descending =
+            radix_sort_order<std::decay_t<Comp>, key_type>::value < 0;
+
+        using sorter_type =
+            radix_sort_helper<Iter, std::decay_t<Proj>, key_type, descending>;
+
+        std::size_t const count = std::distance(first, last);
+
+        // The digit counts of all chunks are combined for each pass, thus we
+        // create no more chunks than there are cores.
+        std::size_t const cores =
+            execution::processing_units_count(policy.parameters(),
+                policy.executor(), hpx::chrono::null_duration, count);
+
+        std::size_t const nchunks = (std::max)(std::size_t(1),
+            (std::min)(cores,
+                (count + radix_sort_limit_per_task - 1) /
+                    radix_sort_limit_per_task));
+
+        if constexpr (!hpx::is_async_execution_policy_v<ExPolicy>)
+        {
+            if (nchunks == 1)
+            {
+                sorter_type sorter(first, count, proj, 1);
+                while (sorter.next_step())
+                {
+                    sorter(0);
+                }
+                return hpx::make_ready_future(last);
+            }
+        }
+
+        // the sorter is kept alive by the tasks running the individual steps
+        return parallel_radix_sort_steps(HPX_FORWARD(ExPolicy, policy),
+            std::make_shared<sorter_type>(first, count, proj, nchunks))
+            .then(hpx::launch::sync, [last](hpx::future<void>&& f) -> Iter {
+                f.get();    // rethrow exceptions
+                return last;
+            });
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
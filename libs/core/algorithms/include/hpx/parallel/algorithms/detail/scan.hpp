@@ -0,0 +1,51 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Last step of the partitioned scan algorithms: combine the accumulated
+    // value of all preceding partitions with each element of the partition.
+    template <typename ExPolicy>
+    struct sequential_scan_update_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_scan_update_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename T, typename Op>
+        friend constexpr Iter tag_fallback_invoke(sequential_scan_update_t,
+            Iter it, std::size_t count, T const& val, Op&& op)
+        {
+            return util::loop_n<ExPolicy>(
+                it, count, [&op, &val](Iter const& curr) -> void {
+                    *curr = HPX_INVOKE(op, val, *curr);
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_scan_update_t<ExPolicy> sequential_scan_update =
+        sequential_scan_update_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename... Args>
+    HPX_HOST_DEVICE HPX_FORCEINLINE auto sequential_scan_update(Args&&... args)
+    {
+        return sequential_scan_update_t<ExPolicy>{}(
+            std::forward<Args>(args)...);
+    }
+#endif
+}    // namespace hpx::parallel::detail
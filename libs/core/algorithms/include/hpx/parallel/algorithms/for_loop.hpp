@@ -185,6 +185,57 @@ namespace hpx { namespace experimental {
     hpx::parallel::util::detail::algorithm_result_t<ExPolicy> for_loop(
         ExPolicy&& policy, std::decay_t<I> first, I last, Args&&... args);
 
+    /// The multi-dimensional for_loop implements a loop nest over the
+    /// iteration space specified by integral bounds for each dimension.
+    /// The iteration space is divided into tiles which are distributed
+    /// according to the policy. If the executor parameters of the policy are
+    /// \a hpx::execution::experimental::cache_tiling, the tile shape is chosen
+    /// such that the working set of each tile fits into the cache, and every
+    /// tile is scheduled separately. Otherwise the tiles are sized for the L2
+    /// cache reported by the topology, and the executor parameters control
+    /// how many tiles are run by each task.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam I           The type of the iteration variables. This has to be
+    ///                     an integral type.
+    /// \tparam N           The number of dimensions of the iteration space.
+    /// \tparam F           The type of the function object to invoke.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the first index of the iteration space
+    ///                     in each dimension.
+    /// \param last         Refers to the index after the last index of the
+    ///                     iteration space in each dimension.
+    /// \param f            The function (or function object) which will be
+    ///                     invoked for each index of the iteration space. It
+    ///                     should expose a signature equivalent to:
+    ///                     \code
+    ///                     <ignored> pred(I i0, I i1, ..., I iN-1);
+    ///                     \endcode \n
+    ///
+    /// Effects:  Applies \a f to each index of the iteration space. The
+    ///           iterations of each tile are executed in row-major order,
+    ///           i.e. the last dimension varies fastest.
+    ///
+    /// Complexity: Applies \a f exactly once for each index of the iteration
+    ///             space.
+    ///
+    /// \returns  The \a for_loop algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a hpx::execution::sequenced_task_policy or
+    ///           \a hpx::execution::parallel_task_policy and returns \a void
+    ///           otherwise.
+    ///
+    template <typename ExPolicy, typename I, std::size_t N, typename F>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy> for_loop(
+        ExPolicy&& policy, std::array<I, N> const& first,
+        std::array<I, N> const& last, F&& f);
+
     /// The for_loop_strided implements loop functionality over a range
     /// specified by integral or iterator bounds. For the iterator case, these
     /// algorithms resemble for_each from the Parallelism TS, but leave to the
@@ -742,6 +793,9 @@ namespace hpx { namespace experimental {
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/cache_tiling.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution/executors/static_chunk_size.hpp>
 #include <hpx/functional/detail/invoke.hpp>
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
@@ -759,6 +813,8 @@ namespace hpx { namespace experimental {
 #include <hpx/type_support/pack.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
@@ -1590,6 +1646,144 @@ namespace hpx::parallel {
             return for_loop_strided_algo().call(HPX_FORWARD(ExPolicy, policy),
                 first, size, stride, HPX_MOVE(f), hpx::get<Is>(t)...);
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // multi-dimensional for_loop
+        template <typename F, typename I, std::size_t N, std::size_t... Is>
+        HPX_FORCEINLINE constexpr void invoke_md_iteration(F& f,
+            std::array<I, N> const& index, hpx::util::index_pack<Is...>)
+        {
+            HPX_INVOKE(f, index[Is]...);
+        }
+
+        // iterate over all elements of one tile in row-major order
+        template <std::size_t D, typename F, typename I, std::size_t N>
+        constexpr void md_tile_loop(F& f, std::array<I, N> const& first,
+            std::array<I, N> const& last, std::array<I, N>& index)
+        {
+            for (I i = first[D]; i != last[D]; ++i)
+            {
+                index[D] = i;
+                if constexpr (D == N - 1)
+                {
+                    detail::invoke_md_iteration(
+                        f, index, hpx::util::make_index_pack_t<N>());
+                }
+                else
+                {
+                    detail::md_tile_loop<D + 1>(f, first, last, index);
+                }
+            }
+        }
+
+        template <typename F, typename I, std::size_t N>
+        struct md_tile_iterations
+        {
+            F f_;
+            std::array<I, N> first_;
+            std::array<std::size_t, N> extents_;
+            std::array<std::size_t, N> shape_;
+            std::array<std::size_t, N> num_tiles_;
+
+            // execute all iterations of the tile with the given (linear)
+            // index, tiles are numbered in row-major order as well
+            void operator()(std::size_t tile)
+            {
+                std::array<I, N> tile_first;
+                std::array<I, N> tile_last;
+                for (std::size_t d = N; d != 0; --d)
+                {
+                    std::size_t const pos = tile % num_tiles_[d - 1];
+                    tile /= num_tiles_[d - 1];
+
+                    std::size_t const offset = pos * shape_[d - 1];
+                    std::size_t const count =
+                        (std::min)(shape_[d - 1], extents_[d - 1] - offset);
+
+                    tile_first[d - 1] = static_cast<I>(first_[d - 1] + offset);
+                    tile_last[d - 1] =
+                        static_cast<I>(tile_first[d - 1] + count);
+                }
+
+                std::array<I, N> index = tile_first;
+                detail::md_tile_loop<0>(f_, tile_first, tile_last, index);
+            }
+        };
+
+        // The iteration space is divided into tiles as described by the
+        // cache_tiling executor parameters (if given), the tiles are then
+        // distributed by the one-dimensional for_loop.
+        template <typename ExPolicy, typename I, std::size_t N, typename F>
+        decltype(auto) for_loop_md(ExPolicy&& policy,
+            std::array<I, N> const& first, std::array<I, N> const& last, F&& f)
+        {
+            static_assert(N != 0, "the iteration space must not be empty");
+
+            std::array<std::size_t, N> extents;
+            std::size_t count = 1;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                extents[d] = first[d] < last[d] ?
+                    static_cast<std::size_t>(last[d] - first[d]) :
+                    0;
+                count *= extents[d];
+            }
+
+            if constexpr (!hpx::execution_policy_has_scheduler_executor_v<
+                              ExPolicy>)
+            {
+                if (count == 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy>::get();
+                }
+            }
+
+            using parameters_type =
+                std::decay_t<decltype(policy.parameters())>;
+            constexpr bool has_tiling = std::is_same_v<parameters_type,
+                hpx::execution::experimental::cache_tiling>;
+
+            hpx::execution::experimental::cache_tiling tiling;
+            if constexpr (has_tiling)
+            {
+                tiling = policy.parameters();
+            }
+
+            std::size_t const cores =
+                hpx::parallel::execution::processing_units_count(
+                    policy.parameters(), policy.executor(),
+                    hpx::chrono::null_duration, count);
+
+            std::array<std::size_t, N> const shape =
+                tiling.get_tile_shape(extents, cores);
+
+            std::array<std::size_t, N> num_tiles;
+            std::size_t total_tiles = 1;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                num_tiles[d] = (extents[d] + shape[d] - 1) / shape[d];
+                total_tiles *= num_tiles[d];
+            }
+
+            md_tile_iterations<std::decay_t<F>, I, N> iterations{
+                HPX_FORWARD(F, f), first, extents, shape, num_tiles};
+
+            if constexpr (has_tiling)
+            {
+                // every tile is scheduled separately
+                return detail::for_loop(
+                    policy.with(
+                        hpx::execution::experimental::static_chunk_size(1)),
+                    std::size_t(0), total_tiles,
+                    hpx::util::make_index_pack_t<0>(), HPX_MOVE(iterations));
+            }
+            else
+            {
+                return detail::for_loop(HPX_FORWARD(ExPolicy, policy),
+                    std::size_t(0), total_tiles,
+                    hpx::util::make_index_pack_t<0>(), HPX_MOVE(iterations));
+            }
+        }
         /// \endcond
     }    // namespace detail
 }    // namespace hpx::parallel
@@ -1638,6 +1832,34 @@ namespace hpx::experimental {
                 last, make_index_pack_t<sizeof...(Args) - 1>(),
                 HPX_FORWARD(Args, args)...);
         }
+
+        // clang-format off
+        template <typename ExPolicy, typename I, std::size_t N, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                std::is_integral_v<I>
+            )>
+        // clang-format on
+        friend decltype(auto) tag_fallback_invoke(hpx::experimental::for_loop_t,
+            ExPolicy&& policy, std::array<I, N> const& first,
+            std::array<I, N> const& last, F&& f)
+        {
+            return hpx::parallel::detail::for_loop_md(
+                HPX_FORWARD(ExPolicy, policy), first, last, HPX_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename I, std::size_t N, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                std::is_integral_v<I>
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(hpx::experimental::for_loop_t,
+            std::array<I, N> const& first, std::array<I, N> const& last, F&& f)
+        {
+            return hpx::parallel::detail::for_loop_md(
+                hpx::execution::seq, first, last, HPX_FORWARD(F, f));
+        }
     } for_loop{};
 
     ///////////////////////////////////////////////////////////////////////////
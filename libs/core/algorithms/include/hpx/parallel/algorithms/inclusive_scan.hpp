@@ -431,6 +431,7 @@ namespace hpx {
 #include <hpx/iterator_support/zip_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
@@ -564,11 +565,8 @@ namespace hpx::parallel {
                               T val) mutable -> void {
                     FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
 
-                    // MSVC 2015 fails if op is captured by reference
-                    util::loop_n<std::decay_t<ExPolicy>>(
-                        dst, part_size, [=, &val](FwdIter2 it) mutable -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                    sequential_scan_update<std::decay_t<ExPolicy>>(
+                        dst, part_size, val, op);
                 };
 
                 return util::scan_partitioner<ExPolicy,
@@ -163,6 +163,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -342,6 +343,18 @@ namespace hpx::parallel {
                 ExPolicy, RandomIt first, Sent last, Comp&& comp, Proj&& proj)
             {
                 auto last_iter = detail::advance_to_sentinel(first, last);
+
+                // use radix sort for arithmetic keys
+                if constexpr (is_radix_sortable_v<RandomIt, Comp, Proj>)
+                {
+                    if (static_cast<std::size_t>(last_iter - first) >=
+                        radix_sort_limit)
+                    {
+                        return sequential_radix_sort(
+                            first, last_iter, comp, proj);
+                    }
+                }
+
                 std::sort(first, last_iter,
                     util::compare_projected<Comp&, Proj&>(comp, proj));
                 return last_iter;
@@ -359,6 +372,18 @@ namespace hpx::parallel {
 
                 try
                 {
+                    // use radix sort for arithmetic keys
+                    if constexpr (is_radix_sortable_v<RandomIt, Comp, Proj>)
+                    {
+                        if (static_cast<std::size_t>(last - first) >=
+                            radix_sort_limit)
+                        {
+                            return algorithm_result::get(parallel_radix_sort(
+                                HPX_FORWARD(ExPolicy, policy), first, last,
+                                comp, proj));
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     return algorithm_result::get(parallel_sort_async(
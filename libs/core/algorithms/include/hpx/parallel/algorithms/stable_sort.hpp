@@ -162,6 +162,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/parallel_stable_sort.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/detail/spin_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -201,6 +202,17 @@ namespace hpx::parallel {
 
                 auto last_iter = detail::advance_to_sentinel(first, last);
 
+                // radix sort is stable, use it for arithmetic keys
+                if constexpr (is_radix_sortable_v<RandomIt, Compare, Proj>)
+                {
+                    if (static_cast<std::size_t>(last_iter - first) >=
+                        radix_sort_limit)
+                    {
+                        return sequential_radix_sort(
+                            first, last_iter, comp, proj);
+                    }
+                }
+
                 spin_sort(first, last_iter, compare_type(comp, proj));
                 return last_iter;
             }
@@ -240,6 +252,17 @@ namespace hpx::parallel {
 
                 try
                 {
+                    // radix sort is stable, use it for arithmetic keys
+                    if constexpr (is_radix_sortable_v<RandomIt, Compare, Proj>)
+                    {
+                        if (count >= radix_sort_limit)
+                        {
+                            return algorithm_result::get(
+                                parallel_radix_sort(policy, first, last_iter,
+                                    compare, proj));
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     compare_type comp(compare, proj);
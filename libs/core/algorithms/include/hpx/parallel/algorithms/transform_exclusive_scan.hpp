@@ -184,6 +184,7 @@ namespace hpx {
 #include <hpx/functional/traits/is_invocable.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
 #include <hpx/parallel/algorithms/transform_inclusive_scan.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
@@ -297,10 +298,8 @@ namespace hpx::parallel {
                     FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
                     *dst++ = val;
 
-                    util::loop_n<std::decay_t<ExPolicy>>(
-                        dst, part_size - 1, [&op, &val](FwdIter2 it) -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                    sequential_scan_update<std::decay_t<ExPolicy>>(
+                        dst, part_size - 1, val, op);
                 };
 
                 return util::scan_partitioner<ExPolicy, result_type, T>::call(
@@ -0,0 +1,419 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/type_support/identity.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized implementation is used for arithmetic element types only
+    // if no projection is given and the comparison can be applied to vector
+    // packs.
+    template <typename Iter, typename F, typename Proj, typename Enable = void>
+    struct is_datapar_minmax_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename F, typename Proj>
+    struct is_datapar_minmax_compatible<Iter, F, Proj,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible_v<Iter> &&
+            std::is_same_v<std::decay_t<Proj>, hpx::identity>>>
+      : hpx::is_invocable<F const&,
+            traits::vector_pack_type_t<
+                typename std::iterator_traits<Iter>::value_type> const&,
+            traits::vector_pack_type_t<
+                typename std::iterator_traits<Iter>::value_type> const&>
+    {
+    };
+
+    template <typename Iter, typename F, typename Proj>
+    inline constexpr bool is_datapar_minmax_compatible_v =
+        is_datapar_minmax_compatible<Iter, F, Proj>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct datapar_minmax
+    {
+        // Calculate the smallest and the largest value of the given sequence.
+        // The vector packs are used as accumulators, their lanes are combined
+        // only once at the end.
+        template <bool Min, bool Max, typename Iter, typename F>
+        static auto min_max_values(Iter it, std::size_t count, F const& f)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V1 = traits::vector_pack_type_t<value_type, 1>;
+            using V = traits::vector_pack_type_t<value_type>;
+
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+            auto update_min = [&f](auto& minv, auto const& v) {
+                traits::mask_assign(HPX_INVOKE(f, v, minv), minv, v);
+            };
+            auto update_max = [&f](auto& maxv, auto const& v) {
+                traits::mask_assign(!HPX_INVOKE(f, v, maxv), maxv, v);
+            };
+            auto update = [&](auto& minv, auto& maxv, auto const& v) {
+                if constexpr (Min)
+                    update_min(minv, v);
+                if constexpr (Max)
+                    update_max(maxv, v);
+            };
+            auto lane = [](auto& v, std::size_t i) {
+                return static_cast<value_type>(traits::get(v, i));
+            };
+
+            V1 min1(traits::vector_pack_load<V1, value_type>::unaligned(it));
+            V1 max1 = min1;
+            ++it;
+            --count;
+
+            for (/* */; count != 0 && !util::detail::is_data_aligned(it);
+                 --count, ++it)
+            {
+                update(min1, max1,
+                    V1(traits::vector_pack_load<V1, value_type>::unaligned(
+                        it)));
+            }
+
+            if (count >= size)
+            {
+                V minv(lane(min1, 0));
+                V maxv(lane(max1, 0));
+
+                for (/* */; count >= size;
+                     count -= size, std::advance(it, size))
+                {
+                    update(minv, maxv,
+                        V(traits::vector_pack_load<V, value_type>::aligned(
+                            it)));
+                }
+
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    if constexpr (Min)
+                        update_min(min1, V1(lane(minv, i)));
+                    if constexpr (Max)
+                        update_max(max1, V1(lane(maxv, i)));
+                }
+            }
+
+            for (/* */; count != 0; --count, ++it)
+            {
+                update(min1, max1,
+                    V1(traits::vector_pack_load<V1, value_type>::unaligned(
+                        it)));
+            }
+
+            return std::make_pair(lane(min1, 0), lane(max1, 0));
+        }
+
+        // Find the first element equivalent to the given smallest value. As
+        // no element compares less than value, each element x for which
+        // f(value, x) is false is equivalent to it.
+        template <typename Iter, typename F, typename T>
+        static Iter find_first_equivalent(
+            Iter it, std::size_t count, F const& f, T const& value)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V1 = traits::vector_pack_type_t<value_type, 1>;
+            using V = traits::vector_pack_type_t<value_type>;
+
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+            V1 const value1(value);
+            for (/* */; count != 0 && !util::detail::is_data_aligned(it);
+                 --count, ++it)
+            {
+                V1 const v(
+                    traits::vector_pack_load<V1, value_type>::unaligned(it));
+                if (traits::any_of(!HPX_INVOKE(f, value1, v)))
+                    return it;
+            }
+
+            V const valuev(value);
+            for (/* */; count >= size; count -= size, std::advance(it, size))
+            {
+                V const v(traits::vector_pack_load<V, value_type>::aligned(it));
+                int const offset =
+                    traits::find_first_of(!HPX_INVOKE(f, valuev, v));
+                if (offset != -1)
+                    return std::next(it, offset);
+            }
+
+            for (/* */; count != 0; --count, ++it)
+            {
+                V1 const v(
+                    traits::vector_pack_load<V1, value_type>::unaligned(it));
+                if (traits::any_of(!HPX_INVOKE(f, value1, v)))
+                    return it;
+            }
+            return it;
+        }
+
+        // Find the last element equivalent to the given largest value. As no
+        // element compares greater than value, each element x for which
+        // f(x, value) is false is equivalent to it.
+        template <typename Iter, typename F, typename T>
+        static Iter find_last_equivalent(
+            Iter it, std::size_t count, F const& f, T const& value)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V1 = traits::vector_pack_type_t<value_type, 1>;
+            using V = traits::vector_pack_type_t<value_type>;
+
+            constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+            // remember the last range of elements containing a match
+            Iter found = it;
+            std::size_t found_count = 1;
+
+            V1 const value1(value);
+            for (/* */; count != 0 && !util::detail::is_data_aligned(it);
+                 --count, ++it)
+            {
+                V1 const v(
+                    traits::vector_pack_load<V1, value_type>::unaligned(it));
+                if (traits::any_of(!HPX_INVOKE(f, v, value1)))
+                {
+                    found = it;
+                    found_count = 1;
+                }
+            }
+
+            V const valuev(value);
+            for (/* */; count >= size; count -= size, std::advance(it, size))
+            {
+                V const v(traits::vector_pack_load<V, value_type>::aligned(it));
+                if (traits::any_of(!HPX_INVOKE(f, v, valuev)))
+                {
+                    found = it;
+                    found_count = size;
+                }
+            }
+
+            for (/* */; count != 0; --count, ++it)
+            {
+                V1 const v(
+                    traits::vector_pack_load<V1, value_type>::unaligned(it));
+                if (traits::any_of(!HPX_INVOKE(f, v, value1)))
+                {
+                    found = it;
+                    found_count = 1;
+                }
+            }
+
+            // locate the match inside the remembered range
+            for (Iter curr = std::next(found, found_count); curr != found;
+                 /**/)
+            {
+                --curr;
+                V1 const v(
+                    traits::vector_pack_load<V1, value_type>::unaligned(curr));
+                if (traits::any_of(!HPX_INVOKE(f, v, value1)))
+                    return curr;
+            }
+            return found;
+        }
+
+        template <typename Iter, typename F>
+        static Iter min_element(Iter it, std::size_t count, F const& f)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            auto const values = min_max_values<true, false>(it, count, f);
+            return find_first_equivalent(it, count, f, values.first);
+        }
+
+        template <typename Iter, typename F>
+        static Iter max_element(Iter it, std::size_t count, F const& f)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            auto const values = min_max_values<false, true>(it, count, f);
+            return find_last_equivalent(it, count, f, values.second);
+        }
+
+        template <typename Iter, typename F>
+        static minmax_element_result<Iter> minmax_element(
+            Iter it, std::size_t count, F const& f)
+        {
+            if (count == 0 || count == 1)
+                return minmax_element_result<Iter>{it, it};
+
+            auto const values = min_max_values<true, true>(it, count, f);
+            return minmax_element_result<Iter>{
+                find_first_equivalent(it, count, f, values.first),
+                find_last_equivalent(it, count, f, values.second)};
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename ExPolicy_, typename FwdIter,
+        typename Sent, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_min_element_t<ExPolicy>, ExPolicy_&& policy, FwdIter first,
+        Sent last, F const& f, Proj const& proj)
+    {
+        if constexpr (is_datapar_minmax_compatible_v<FwdIter, F, Proj> &&
+            hpx::traits::is_sized_sentinel_for_v<Sent, FwdIter>)
+        {
+            return datapar_minmax<ExPolicy>::min_element(
+                first, static_cast<std::size_t>(last - first), f);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_min_element<base_policy_type>(
+                hpx::execution::experimental::to_non_simd(
+                    HPX_FORWARD(ExPolicy_, policy)),
+                first, last, f, proj);
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_min_element_t<ExPolicy>, FwdIter it, std::size_t count,
+        F const& f, Proj const& proj)
+    {
+        if constexpr (is_datapar_minmax_compatible_v<FwdIter, F, Proj>)
+        {
+            return datapar_minmax<ExPolicy>::min_element(it, count, f);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_min_element<base_policy_type>(
+                it, count, f, proj);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename ExPolicy_, typename FwdIter,
+        typename Sent, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_max_element_t<ExPolicy>, ExPolicy_&& policy, FwdIter first,
+        Sent last, F const& f, Proj const& proj)
+    {
+        if constexpr (is_datapar_minmax_compatible_v<FwdIter, F, Proj> &&
+            hpx::traits::is_sized_sentinel_for_v<Sent, FwdIter>)
+        {
+            return datapar_minmax<ExPolicy>::max_element(
+                first, static_cast<std::size_t>(last - first), f);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_max_element<base_policy_type>(
+                hpx::execution::experimental::to_non_simd(
+                    HPX_FORWARD(ExPolicy_, policy)),
+                first, last, f, proj);
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_max_element_t<ExPolicy>, FwdIter it, std::size_t count,
+        F const& f, Proj const& proj)
+    {
+        if constexpr (is_datapar_minmax_compatible_v<FwdIter, F, Proj>)
+        {
+            return datapar_minmax<ExPolicy>::max_element(it, count, f);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_max_element<base_policy_type>(
+                it, count, f, proj);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename ExPolicy_, typename FwdIter,
+        typename Sent, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE minmax_element_result<FwdIter> tag_invoke(
+        sequential_minmax_element_t<ExPolicy>, ExPolicy_&& policy,
+        FwdIter first, Sent last, F const& f, Proj const& proj)
+    {
+        if constexpr (is_datapar_minmax_compatible_v<FwdIter, F, Proj> &&
+            hpx::traits::is_sized_sentinel_for_v<Sent, FwdIter>)
+        {
+            return datapar_minmax<ExPolicy>::minmax_element(
+                first, static_cast<std::size_t>(last - first), f);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_minmax_element<base_policy_type>(
+                hpx::execution::experimental::to_non_simd(
+                    HPX_FORWARD(ExPolicy_, policy)),
+                first, last, f, proj);
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE minmax_element_result<FwdIter> tag_invoke(
+        sequential_minmax_element_t<ExPolicy>, FwdIter it, std::size_t count,
+        F const& f, Proj const& proj)
+    {
+        if constexpr (is_datapar_minmax_compatible_v<FwdIter, F, Proj>)
+        {
+            return datapar_minmax<ExPolicy>::minmax_element(it, count, f);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_minmax_element<base_policy_type>(
+                it, count, f, proj);
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
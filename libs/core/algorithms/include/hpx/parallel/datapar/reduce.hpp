@@ -10,17 +10,23 @@
 
 #if defined(HPX_HAVE_DATAPAR)
 #include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
 #include <hpx/execution/traits/vector_pack_reduce.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
 #include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
 #include <hpx/functional/tag_invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/reduce.hpp>
 #include <hpx/parallel/datapar/handle_local_exceptions.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/datapar/loop.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 
@@ -80,18 +86,105 @@ namespace hpx { namespace parallel { namespace detail {
             return init;
         }
 
+        // The binary form is vectorized as soon as the first sequence is
+        // aligned, the elements of the second sequence are loaded unaligned
+        // if necessary. The partial results are accumulated in a vector pack
+        // if the reduction operation supports it.
         template <typename Iter1, typename Sent, typename Iter2, typename T,
             typename Reduce, typename Convert>
         HPX_HOST_DEVICE HPX_FORCEINLINE static T call(Iter1 first1, Sent last1,
             Iter2 first2, T init, Reduce&& r, Convert&& conv)
         {
-            util::loop2<ExPolicy>(
-                first1, last1, first2, [&init, &r, &conv](auto it1, auto it2) {
-                    auto partial_res = hpx::parallel::traits::reduce(
-                        r, HPX_INVOKE(conv, it1, it2));
-                    init = r(init, partial_res);
-                });
-            return init;
+            if constexpr (std::is_same_v<Iter1, Sent> &&
+                util::detail::iterators_datapar_compatible_v<Iter1, Iter2>)
+            {
+                using value_type1 =
+                    typename std::iterator_traits<Iter1>::value_type;
+                using value_type2 =
+                    typename std::iterator_traits<Iter2>::value_type;
+
+                using V11 = traits::vector_pack_type_t<value_type1, 1>;
+                using V12 = traits::vector_pack_type_t<value_type2, 1>;
+                using V1 = traits::vector_pack_type_t<value_type1>;
+                using V2 = traits::vector_pack_type_t<value_type2>;
+
+                constexpr std::size_t size = traits::vector_pack_size_v<V1>;
+
+                auto step1 = [&]() {
+                    V11 const v1(
+                        traits::vector_pack_load<V11, value_type1>::unaligned(
+                            first1));
+                    V12 const v2(
+                        traits::vector_pack_load<V12, value_type2>::unaligned(
+                            first2));
+                    ++first1;
+                    ++first2;
+                    init = r(init,
+                        hpx::parallel::traits::reduce(
+                            r, HPX_INVOKE(conv, v1, v2)));
+                };
+
+                auto stepv = [&]() {
+                    V1 const v1(
+                        traits::vector_pack_load<V1, value_type1>::aligned(
+                            first1));
+                    V2 const v2(
+                        traits::vector_pack_load<V2, value_type2>::unaligned(
+                            first2));
+                    std::advance(first1, size);
+                    std::advance(first2, size);
+                    return HPX_INVOKE(conv, v1, v2);
+                };
+
+                std::size_t count = std::distance(first1, last1);
+                for (/* */;
+                     count != 0 && !util::detail::is_data_aligned(first1);
+                     --count)
+                {
+                    step1();
+                }
+
+                if (count >= size)
+                {
+                    using acc_type = decltype(stepv());
+                    if constexpr (hpx::is_invocable_r_v<acc_type, Reduce&,
+                                      acc_type, acc_type>)
+                    {
+                        acc_type acc = stepv();
+                        for (count -= size; count >= size; count -= size)
+                        {
+                            acc = r(acc, stepv());
+                        }
+                        init =
+                            r(init, hpx::parallel::traits::reduce(r, acc));
+                    }
+                    else
+                    {
+                        for (/* */; count >= size; count -= size)
+                        {
+                            init = r(init,
+                                hpx::parallel::traits::reduce(r, stepv()));
+                        }
+                    }
+                }
+
+                for (/* */; count != 0; --count)
+                {
+                    step1();
+                }
+                return init;
+            }
+            else
+            {
+                util::loop2<ExPolicy>(
+                    first1, last1, first2,
+                    [&init, &r, &conv](auto it1, auto it2) {
+                        auto partial_res = hpx::parallel::traits::reduce(
+                            r, HPX_INVOKE(conv, it1, it2));
+                        init = r(init, partial_res);
+                    });
+                return init;
+            }
         }
     };
 
@@ -0,0 +1,79 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/datapar/loop.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The partition update can be vectorized if the accumulated value has the
+    // element type of the destination and the scan operation can be applied
+    // to vector packs.
+    template <typename Iter, typename T, typename Op, typename Enable = void>
+    struct is_datapar_scan_update_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename T, typename Op>
+    struct is_datapar_scan_update_compatible<Iter, T, Op,
+        std::enable_if_t<util::detail::iterator_datapar_compatible_v<Iter> &&
+            std::is_same_v<T, typename std::iterator_traits<Iter>::value_type>>>
+      : hpx::is_invocable_r<traits::vector_pack_type_t<T>, Op&,
+            traits::vector_pack_type_t<T> const&,
+            traits::vector_pack_type_t<T> const&>
+    {
+    };
+
+    template <typename Iter, typename T, typename Op>
+    inline constexpr bool is_datapar_scan_update_compatible_v =
+        is_datapar_scan_update_compatible<Iter, std::decay_t<T>,
+            std::decay_t<Op>>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename T, typename Op,
+        HPX_CONCEPT_REQUIRES_(hpx::is_vectorpack_execution_policy_v<ExPolicy>)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(
+        sequential_scan_update_t<ExPolicy>, Iter it, std::size_t count,
+        T const& val, Op&& op)
+    {
+        if constexpr (is_datapar_scan_update_compatible_v<Iter, T, Op>)
+        {
+            return util::loop_n_ind<ExPolicy>(
+                it, count, [&op, &val](auto& v) -> void {
+                    using vector_type = std::decay_t<decltype(v)>;
+                    v = HPX_INVOKE(op, vector_type(val), v);
+                });
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_scan_update<base_policy_type>(
+                it, count, val, HPX_FORWARD(Op, op));
+        }
+    }
+}    // namespace hpx::parallel::detail
+#endif
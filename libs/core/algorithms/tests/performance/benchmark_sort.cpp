@@ -0,0 +1,200 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+// This benchmark compares the radix sort used by hpx::sort and
+// hpx::stable_sort for arithmetic keys with the comparison based sorting
+// algorithms (quick sort, sample_sort, and spin_sort) that are used otherwise.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/format.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+// Using a user-defined comparison function disables the radix sort.
+struct compare_less
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs < rhs;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> make_data(std::size_t vector_size)
+{
+    std::mt19937_64 gen(seed);
+    std::vector<T> data(vector_size);
+
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::normal_distribution<T> dist(T(0), T(1e6));
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    }
+    else
+    {
+        std::uniform_int_distribution<T> dist;
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    }
+    return data;
+}
+
+template <typename T, typename F>
+double run_sort_benchmark(
+    std::vector<T> const& data, int test_count, char const* name, F&& f)
+{
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::vector<T> v = data;
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        f(v);
+        time += hpx::chrono::high_resolution_clock::now() - start;
+
+        if (!std::is_sorted(v.begin(), v.end()))
+        {
+            HPX_TEST_MSG(false, name);
+        }
+    }
+    return (static_cast<double>(time) * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void run_benchmark(std::size_t vector_size, int test_count)
+{
+    using namespace hpx::execution;
+
+    std::vector<T> const data = make_data<T>(vector_size);
+
+    std::cout << "* Running Benchmark..." << std::endl;
+
+    double const time_std = run_sort_benchmark(data, test_count, "std::sort",
+        [](std::vector<T>& v) { std::sort(v.begin(), v.end()); });
+
+    // radix sort
+    double const time_radix_seq = run_sort_benchmark(data, test_count,
+        "radix_sort(seq)",
+        [](std::vector<T>& v) { hpx::sort(seq, v.begin(), v.end()); });
+    double const time_radix_par = run_sort_benchmark(data, test_count,
+        "radix_sort(par)",
+        [](std::vector<T>& v) { hpx::sort(par, v.begin(), v.end()); });
+
+    // comparison based sorting
+    double const time_quick_par = run_sort_benchmark(data, test_count,
+        "sort(par)", [](std::vector<T>& v) {
+            hpx::sort(par, v.begin(), v.end(), compare_less());
+        });
+    double const time_spin_seq = run_sort_benchmark(data, test_count,
+        "spin_sort(seq)", [](std::vector<T>& v) {
+            hpx::stable_sort(seq, v.begin(), v.end(), compare_less());
+        });
+    double const time_sample_par = run_sort_benchmark(data, test_count,
+        "sample_sort(par)", [](std::vector<T>& v) {
+            hpx::stable_sort(par, v.begin(), v.end(), compare_less());
+        });
+
+    std::cout << "\n-------------- Benchmark Result --------------"
+              << std::endl;
+    auto fmt = "{1:<25} : {2}(sec)";
+    hpx::util::format_to(std::cout, fmt, "std::sort", time_std) << std::endl;
+    hpx::util::format_to(std::cout, fmt, "radix_sort (seq)", time_radix_seq)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "radix_sort (par)", time_radix_par)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "quick sort (par)", time_quick_par)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "spin_sort (seq)", time_spin_seq)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "sample_sort (par)", time_sample_par)
+        << std::endl;
+    std::cout << "----------------------------------------------" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    // pull values from cmd
+    std::size_t const vector_size = vm["vector_size"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+    std::string const data_type_str = vm["data_type"].as<std::string>();
+
+    std::size_t const os_threads = hpx::get_os_thread_count();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "vector_size  : " << vector_size << std::endl;
+    std::cout << "data_type    : " << data_type_str << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "os threads   : " << os_threads << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    if (data_type_str == "uint32")
+        run_benchmark<std::uint32_t>(vector_size, test_count);
+    else if (data_type_str == "double")
+        run_benchmark<double>(vector_size, test_count);
+    else    // uint64
+        run_benchmark<std::uint64_t>(vector_size, test_count);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size",
+            hpx::program_options::value<std::size_t>()->default_value(10000000),
+            "size of vector (default: 10000000)")
+        ("data_type",
+            hpx::program_options::value<std::string>()->default_value("uint64"),
+            "the type of the keys to sort (uint32/uint64/double)")
+        ("test_count",
+            hpx::program_options::value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", hpx::program_options::value<unsigned int>(),
+            "the random number generator seed to use for this run");
+    // clang-format on
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,175 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_for_loop_2d(ExPolicy&& policy)
+{
+    constexpr int rows = 37;
+    constexpr int cols = 101;
+
+    std::vector<std::atomic<int>> c(rows * cols);
+    for (auto& v : c)
+        v.store(0);
+
+    hpx::experimental::for_loop(std::forward<ExPolicy>(policy),
+        std::array<int, 2>{-3, 5}, std::array<int, 2>{rows - 3, cols + 5},
+        [&](int i, int j) { ++c[(i + 3) * cols + (j - 5)]; });
+
+    // every index has to be visited exactly once
+    for (auto const& v : c)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+    }
+}
+
+template <typename ExPolicy>
+void test_for_loop_2d_async(ExPolicy&& policy)
+{
+    constexpr std::size_t rows = 64;
+    constexpr std::size_t cols = 65;
+
+    std::vector<std::atomic<int>> c(rows * cols);
+    for (auto& v : c)
+        v.store(0);
+
+    auto f = hpx::experimental::for_loop(std::forward<ExPolicy>(policy),
+        std::array<std::size_t, 2>{0, 0}, std::array<std::size_t, 2>{rows, cols},
+        [&](std::size_t i, std::size_t j) { ++c[i * cols + j]; });
+    f.wait();
+
+    for (auto const& v : c)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+    }
+}
+
+template <typename ExPolicy>
+void test_for_loop_3d(ExPolicy&& policy)
+{
+    constexpr std::size_t nx = 7;
+    constexpr std::size_t ny = 19;
+    constexpr std::size_t nz = 33;
+
+    std::vector<std::atomic<int>> c(nx * ny * nz);
+    for (auto& v : c)
+        v.store(0);
+
+    hpx::experimental::for_loop(std::forward<ExPolicy>(policy),
+        std::array<std::size_t, 3>{0, 0, 0},
+        std::array<std::size_t, 3>{nx, ny, nz},
+        [&](std::size_t x, std::size_t y, std::size_t z) {
+            ++c[(x * ny + y) * nz + z];
+        });
+
+    for (auto const& v : c)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+    }
+}
+
+void test_for_loop_empty()
+{
+    std::atomic<int> count(0);
+
+    hpx::experimental::for_loop(hpx::execution::par,
+        std::array<int, 2>{0, 0}, std::array<int, 2>{10, 0},
+        [&](int, int) { ++count; });
+    hpx::experimental::for_loop(std::array<int, 2>{5, 0},
+        std::array<int, 2>{0, 10}, [&](int, int) { ++count; });
+
+    HPX_TEST_EQ(count.load(), 0);
+}
+
+// the iterations of each tile are executed in row-major order
+void test_for_loop_order()
+{
+    std::vector<std::pair<int, int>> visited;
+    hpx::experimental::for_loop(std::array<int, 2>{0, 0},
+        std::array<int, 2>{3, 4},
+        [&](int i, int j) { visited.emplace_back(i, j); });
+
+    HPX_TEST_EQ(visited.size(), std::size_t(12));
+    for (std::size_t k = 0; k != visited.size(); ++k)
+    {
+        HPX_TEST_EQ(visited[k].first, static_cast<int>(k / 4));
+        HPX_TEST_EQ(visited[k].second, static_cast<int>(k % 4));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_tile_shape()
+{
+    // 4096 doubles fit into 32kB, i.e. tiles of 64x64
+    ex::cache_tiling tiling(sizeof(double), 1, 32 * 1024);
+    HPX_TEST_EQ(tiling.get_tile_size(), std::size_t(4096));
+
+    auto shape = tiling.get_tile_shape(std::array<std::size_t, 2>{1000, 1000});
+    HPX_TEST_EQ(shape[0], std::size_t(64));
+    HPX_TEST_EQ(shape[1], std::size_t(64));
+
+    // budget not used by small dimensions is given to the other ones
+    shape = tiling.get_tile_shape(std::array<std::size_t, 2>{1000, 16});
+    HPX_TEST_EQ(shape[1], std::size_t(16));
+    HPX_TEST_EQ(shape[0], std::size_t(256));
+
+    auto shape3 =
+        tiling.get_tile_shape(std::array<std::size_t, 3>{100, 100, 100});
+    HPX_TEST(shape3[0] * shape3[1] * shape3[2] <= std::size_t(4096));
+    HPX_TEST_EQ(shape3[2], std::size_t(16));
+
+    // create at least one tile per core
+    shape = tiling.get_tile_shape(std::array<std::size_t, 2>{64, 64}, 4);
+    HPX_TEST((64 / shape[0]) * (64 / shape[1]) >= std::size_t(4));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    using namespace hpx::execution;
+
+    test_for_loop_2d(seq);
+    test_for_loop_2d(par);
+    test_for_loop_2d(par_unseq);
+    test_for_loop_2d(par.with(ex::cache_tiling(sizeof(int), 1, 1024)));
+    test_for_loop_2d(par.with(ex::static_chunk_size(3)));
+
+    test_for_loop_2d_async(seq(task));
+    test_for_loop_2d_async(par(task));
+    test_for_loop_2d_async(
+        par(task).with(ex::cache_tiling(sizeof(int), 1, 256)));
+
+    test_for_loop_3d(seq);
+    test_for_loop_3d(par);
+    test_for_loop_3d(par.with(ex::cache_tiling(sizeof(int), 1, 512)));
+
+    test_for_loop_empty();
+    test_for_loop_order();
+    test_tile_shape();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,343 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// hpx::sort and hpx::stable_sort use a radix sort for sufficiently large
+// sequences of arithmetic keys. Verify that it produces the same results as
+// std::stable_sort.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// use smaller array sizes for debug tests
+#if defined(HPX_DEBUG)
+#define HPX_RADIX_SORT_TEST_SIZE (1 << 14)
+#else
+#define HPX_RADIX_SORT_TEST_SIZE (1 << 18)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::vector<T> data(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist(T(-1e6), T(1e6));
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+
+        // make sure positive and negative zeros are handled correctly
+        data[0] = T(0);
+        data[size / 2] = -T(0);
+    }
+    else
+    {
+        // use a narrow distribution to create many duplicate keys, but make
+        // sure the extreme values are present
+        std::uniform_int_distribution<std::int64_t> dist(-1000, 1000);
+        std::generate(data.begin(), data.end(),
+            [&]() { return static_cast<T>(dist(gen)); });
+
+        data[0] = (std::numeric_limits<T>::min)();
+        data[size / 2] = (std::numeric_limits<T>::max)();
+    }
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy, typename Comp>
+void test_radix_sort(ExPolicy policy, Comp comp)
+{
+    for (std::size_t size : {std::size_t(100),
+             std::size_t(HPX_RADIX_SORT_TEST_SIZE),
+             std::size_t(HPX_RADIX_SORT_TEST_SIZE + 17)})
+    {
+        std::vector<T> const data = make_data<T>(size);
+
+        std::vector<T> expected = data;
+        std::stable_sort(expected.begin(), expected.end(), comp);
+
+        std::vector<T> c = data;
+        hpx::sort(policy, c.begin(), c.end(), comp);
+        HPX_TEST(c == expected);
+
+        c = data;
+        hpx::stable_sort(policy, c.begin(), c.end(), comp);
+        HPX_TEST(c == expected);
+    }
+}
+
+template <typename T, typename ExPolicy, typename Comp>
+void test_radix_sort_async(ExPolicy policy, Comp comp)
+{
+    std::vector<T> const data = make_data<T>(HPX_RADIX_SORT_TEST_SIZE);
+
+    std::vector<T> expected = data;
+    std::stable_sort(expected.begin(), expected.end(), comp);
+
+    std::vector<T> c = data;
+    auto f = hpx::sort(policy, c.begin(), c.end(), comp);
+    f.get();
+    HPX_TEST(c == expected);
+
+    c = data;
+    auto f2 = hpx::stable_sort(policy, c.begin(), c.end(), comp);
+    f2.get();
+    HPX_TEST(c == expected);
+}
+
+template <typename T>
+void test_radix_sort()
+{
+    using namespace hpx::execution;
+
+    test_radix_sort<T>(seq, std::less<>());
+    test_radix_sort<T>(par, std::less<>());
+    test_radix_sort<T>(par_unseq, std::less<>());
+    test_radix_sort<T>(seq, std::greater<T>());
+    test_radix_sort<T>(par, std::greater<T>());
+
+    test_radix_sort_async<T>(seq(task), std::less<T>());
+    test_radix_sort_async<T>(par(task), std::greater<>());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the radix sort must keep elements with equal keys in their original order
+void test_radix_sort_stability()
+{
+    using namespace hpx::execution;
+
+    std::vector<std::pair<std::int32_t, std::size_t>> data(
+        HPX_RADIX_SORT_TEST_SIZE);
+
+    std::uniform_int_distribution<std::int32_t> dist(-100, 100);
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        data[i] = std::make_pair(dist(gen), i);
+    }
+
+    auto proj = [](auto const& p) { return p.first; };
+    auto comp = [](auto const& lhs, auto const& rhs) {
+        return lhs.first < rhs.first;
+    };
+
+    std::vector<std::pair<std::int32_t, std::size_t>> expected = data;
+    std::stable_sort(expected.begin(), expected.end(), comp);
+
+    auto c = data;
+    hpx::ranges::stable_sort(seq, c, std::less<>(), proj);
+    HPX_TEST(c == expected);
+
+    c = data;
+    hpx::ranges::stable_sort(par, c, std::less<>(), proj);
+    HPX_TEST(c == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// exceptions thrown by the projection are reported through the algorithm
+struct throwing_projection
+{
+    std::int32_t operator()(std::int32_t value) const
+    {
+        if (value == 42)
+        {
+            throw std::runtime_error("test");
+        }
+        return value;
+    }
+};
+
+template <typename ExPolicy>
+void test_radix_sort_exception(ExPolicy policy)
+{
+    std::vector<std::int32_t> c(HPX_RADIX_SORT_TEST_SIZE, 1);
+    c[c.size() / 2] = 42;
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::ranges::sort(policy, c, std::less<>(), throwing_projection());
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.size(), static_cast<std::size_t>(1));
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+
+    caught_exception = false;
+    try
+    {
+        hpx::ranges::stable_sort(
+            policy, c, std::less<>(), throwing_projection());
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.size(), static_cast<std::size_t>(1));
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
+template <typename ExPolicy>
+void test_radix_sort_exception_async(ExPolicy policy)
+{
+    std::vector<std::int32_t> c(HPX_RADIX_SORT_TEST_SIZE, 1);
+    c[c.size() / 2] = 42;
+
+    bool caught_exception = false;
+    bool returned_from_algorithm = false;
+    try
+    {
+        auto f =
+            hpx::ranges::sort(policy, c, std::less<>(), throwing_projection());
+        returned_from_algorithm = true;
+        f.get();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.size(), static_cast<std::size_t>(1));
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST(returned_from_algorithm);
+
+    caught_exception = false;
+    returned_from_algorithm = false;
+    try
+    {
+        auto f = hpx::ranges::stable_sort(
+            policy, c, std::less<>(), throwing_projection());
+        returned_from_algorithm = true;
+        f.get();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.size(), static_cast<std::size_t>(1));
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST(returned_from_algorithm);
+}
+
+void test_radix_sort_exceptions()
+{
+    using namespace hpx::execution;
+
+    test_radix_sort_exception(par);
+    test_radix_sort_exception_async(par(task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sort_by_key()
+{
+#if defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
+    using namespace hpx::execution;
+
+    std::vector<double> keys = make_data<double>(HPX_RADIX_SORT_TEST_SIZE);
+    std::vector<std::size_t> values(keys.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        values[i] = i;
+    }
+
+    std::vector<double> const original_keys = keys;
+
+    hpx::experimental::sort_by_key(
+        par, keys.begin(), keys.end(), values.begin());
+
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        HPX_TEST_EQ(original_keys[values[i]], keys[i]);
+    }
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_radix_sort<std::uint8_t>();
+    test_radix_sort<std::int16_t>();
+    test_radix_sort<std::int32_t>();
+    test_radix_sort<std::uint64_t>();
+    test_radix_sort<std::int64_t>();
+    test_radix_sort<float>();
+    test_radix_sort<double>();
+
+    test_radix_sort_stability();
+    test_radix_sort_exceptions();
+    test_sort_by_key();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
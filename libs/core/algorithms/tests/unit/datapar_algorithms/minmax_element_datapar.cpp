@@ -0,0 +1,146 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+// Use a narrow value range to create many elements equivalent to the
+// smallest and the largest ones, the algorithms have to return the first
+// smallest and the last largest element.
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<int> dist(-100, 100);
+
+    std::vector<T> c(size);
+    std::generate(
+        c.begin(), c.end(), [&]() { return static_cast<T>(dist(gen)); });
+    return c;
+}
+
+template <typename ExPolicy, typename T, typename F>
+void test_minmax_element(ExPolicy policy, std::vector<T> const& c, F f)
+{
+    using namespace hpx::execution;
+
+    // offset the start of the sequence to exercise the unaligned prologue
+    for (std::size_t offset : {0, 1, 3})
+    {
+        auto first = std::next(c.begin(), offset);
+
+        auto min_ref = hpx::min_element(seq, first, c.end(), f);
+        auto min = hpx::min_element(policy, first, c.end(), f);
+        HPX_TEST(min == min_ref);
+
+        auto max_ref = hpx::max_element(seq, first, c.end(), f);
+        auto max = hpx::max_element(policy, first, c.end(), f);
+        HPX_TEST(max == max_ref);
+
+        auto minmax_ref = std::minmax_element(first, c.end(), f);
+        auto minmax = hpx::minmax_element(policy, first, c.end(), f);
+        HPX_TEST(minmax.min == minmax_ref.first);
+        HPX_TEST(minmax.max == minmax_ref.second);
+        HPX_TEST(minmax.min == min_ref);
+        HPX_TEST(minmax.max == max_ref);
+    }
+}
+
+template <typename ExPolicy, typename T, typename F>
+void test_minmax_element_async(ExPolicy p, std::vector<T> const& c, F f)
+{
+    auto min_f = hpx::min_element(p, c.begin(), c.end(), f);
+    auto max_f = hpx::max_element(p, c.begin(), c.end(), f);
+    auto minmax_f = hpx::minmax_element(p, c.begin(), c.end(), f);
+
+    auto minmax_ref = std::minmax_element(c.begin(), c.end(), f);
+    HPX_TEST(min_f.get() == minmax_ref.first);
+    HPX_TEST(max_f.get() == minmax_ref.second);
+
+    auto minmax = minmax_f.get();
+    HPX_TEST(minmax.min == minmax_ref.first);
+    HPX_TEST(minmax.max == minmax_ref.second);
+}
+
+template <typename T>
+void test_minmax_element()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t size : {1, 2, 7, 10007})
+    {
+        std::vector<T> const c = make_data<T>(size + 3);
+
+        test_minmax_element(simd, c, std::less<>());
+        test_minmax_element(par_simd, c, std::less<>());
+        test_minmax_element(simd, c, std::greater<>());
+        test_minmax_element(par_simd, c, std::greater<>());
+
+        // comparison functions not supporting vector packs
+        test_minmax_element(
+            par_simd, c, [](T lhs, T rhs) { return lhs < rhs; });
+
+        test_minmax_element_async(simd(task), c, std::less<>());
+        test_minmax_element_async(par_simd(task), c, std::less<>());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_minmax_element<std::int32_t>();
+    test_minmax_element<std::int64_t>();
+    test_minmax_element<float>();
+    test_minmax_element<double>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
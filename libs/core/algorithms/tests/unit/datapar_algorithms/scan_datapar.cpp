@@ -0,0 +1,121 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../algorithms/inclusive_scan_tests.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// std::plus<> can be applied to vector packs, which enables the vectorized
+// update of the partitions.
+template <typename T, typename ExPolicy>
+void test_scan_plus(ExPolicy policy)
+{
+    std::vector<T> c(10007);
+    std::iota(std::begin(c), std::end(c), T(0));
+
+    T const init(1);
+
+    // offset the destination to exercise the unaligned prologue
+    for (std::size_t offset : {0, 1})
+    {
+        std::vector<T> d(c.size() + offset);
+        std::vector<T> e(c.size());
+
+        hpx::inclusive_scan(policy, std::begin(c), std::end(c),
+            std::next(std::begin(d), offset), std::plus<>(), init);
+        hpx::parallel::detail::sequential_inclusive_scan(
+            std::begin(c), std::end(c), std::begin(e), init, std::plus<>());
+        HPX_TEST(std::equal(std::begin(e), std::end(e),
+            std::next(std::begin(d), offset)));
+
+        hpx::exclusive_scan(policy, std::begin(c), std::end(c),
+            std::next(std::begin(d), offset), init, std::plus<>());
+        hpx::parallel::detail::sequential_exclusive_scan(
+            std::begin(c), std::end(c), std::begin(e), init, std::plus<>());
+        HPX_TEST(std::equal(std::begin(e), std::end(e),
+            std::next(std::begin(d), offset)));
+    }
+}
+
+template <typename T>
+void test_scan_plus()
+{
+    using namespace hpx::execution;
+
+    test_scan_plus<T>(simd);
+    test_scan_plus<T>(par_simd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_inclusive_scan()
+{
+    using namespace hpx::execution;
+
+    test_inclusive_scan1(simd, IteratorTag());
+    test_inclusive_scan1(par_simd, IteratorTag());
+    test_inclusive_scan2(simd, IteratorTag());
+    test_inclusive_scan2(par_simd, IteratorTag());
+    test_inclusive_scan3(par_simd, IteratorTag());
+
+    test_inclusive_scan1_async(simd(task), IteratorTag());
+    test_inclusive_scan1_async(par_simd(task), IteratorTag());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+
+    test_scan_plus<std::int32_t>();
+    test_scan_plus<std::uint64_t>();
+    test_scan_plus<double>();
+
+    test_inclusive_scan<std::random_access_iterator_tag>();
+    test_inclusive_scan<std::forward_iterator_tag>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -1,4 +1,5 @@
 //  Copyright (c) 2023 Hartmut Kaiser
+//  Copyright (c) 2024 The STE||AR-Group
 //
 //  SPDX-License-Identifier: BSL-1.0
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
@@ -12,7 +13,6 @@
 #include <cstddef>
 #include <memory>
 #include <new>
-#include <stack>
 #include <type_traits>
 #include <utility>
 
@@ -21,107 +21,190 @@ namespace hpx::util {
 #if defined(HPX_ALLOCATOR_SUPPORT_HAVE_CACHING) &&                             \
     !((defined(HPX_HAVE_CUDA) && defined(__CUDACC__)) ||                       \
         defined(HPX_HAVE_HIP))
-    ///////////////////////////////////////////////////////////////////////////
-    template <typename T = char, typename Allocator = std::allocator<T>>
-    struct thread_local_caching_allocator
-    {
-        HPX_NO_UNIQUE_ADDRESS Allocator alloc;
+    namespace detail {
 
-        using traits = std::allocator_traits<Allocator>;
+        ///////////////////////////////////////////////////////////////////////
+        // Memory blocks are cached by their size and alignment, i.e. all types
+        // of the same (rounded up) size share the same cache.
+        template <std::size_t Size, std::size_t Alignment>
+        struct alignas(Alignment) caching_allocator_block
+        {
+            unsigned char data[Size];
+        };
 
-        using value_type = typename traits::value_type;
-        using pointer = typename traits::pointer;
-        using const_pointer = typename traits::const_pointer;
-        using size_type = typename traits::size_type;
-        using difference_type = typename traits::difference_type;
+        template <typename T>
+        inline constexpr std::size_t caching_allocator_block_alignment =
+            alignof(T) < alignof(void*) ? alignof(void*) : alignof(T);
 
-        template <typename U>
-        struct rebind
+        template <typename T>
+        inline constexpr std::size_t caching_allocator_block_size =
+            (sizeof(T) + 2 * sizeof(void*) - 1) / (2 * sizeof(void*)) * 2 *
+            sizeof(void*);
+
+        template <typename T>
+        using caching_allocator_block_type =
+            caching_allocator_block<caching_allocator_block_size<T>,
+                caching_allocator_block_alignment<T>>;
+
+        ///////////////////////////////////////////////////////////////////////
+        // Allocators handing out memory which depends on the allocating
+        // thread (e.g. the arena of its thread pool) expose is_local(p) to
+        // tell whether a block may be reused by the current thread.
+        template <typename Allocator, typename Enable = void>
+        struct has_is_local : std::false_type
         {
-            using other = thread_local_caching_allocator<U,
-                typename traits::template rebind_alloc<U>>;
         };
 
-        using is_always_equal = typename traits::is_always_equal;
-        using propagate_on_container_copy_assignment =
-            typename traits::propagate_on_container_copy_assignment;
-        using propagate_on_container_move_assignment =
-            typename traits::propagate_on_container_move_assignment;
-        using propagate_on_container_swap =
-            typename traits::propagate_on_container_swap;
+        template <typename Allocator>
+        struct has_is_local<Allocator,
+            std::void_t<decltype(std::declval<Allocator const&>().is_local(
+                std::declval<void const*>()))>> : std::true_type
+        {
+        };
 
-    private:
-        struct allocated_cache
+        ///////////////////////////////////////////////////////////////////////
+        // Per-thread pool of memory blocks of the same size. Released blocks
+        // are kept in an intrusive free list, at most max_cached_blocks
+        // blocks are kept for later reuse. Blocks released on a different
+        // thread than the one they were allocated on are added to the cache
+        // of the releasing thread, unless the allocator reports them as not
+        // being local to that thread, those are released directly.
+        template <typename Allocator>
+        class thread_local_block_cache
         {
-            explicit allocated_cache(Allocator const& a) noexcept(
-                noexcept(std::is_nothrow_copy_constructible_v<Allocator>))
+            using traits = std::allocator_traits<Allocator>;
+            using block_type = typename traits::value_type;
+
+            struct free_block
+            {
+                free_block* next;
+            };
+
+            static_assert(sizeof(block_type) >= sizeof(free_block) &&
+                alignof(block_type) >= alignof(free_block));
+
+            static constexpr std::size_t max_cached_blocks = 512;
+
+        public:
+            explicit thread_local_block_cache(Allocator const& a) noexcept(
+                std::is_nothrow_copy_constructible_v<Allocator>)
               : alloc(a)
             {
             }
 
-            allocated_cache(allocated_cache const&) = delete;
-            allocated_cache(allocated_cache&&) = delete;
-            allocated_cache& operator=(allocated_cache const&) = delete;
-            allocated_cache& operator=(allocated_cache&&) = delete;
+            thread_local_block_cache(thread_local_block_cache const&) = delete;
+            thread_local_block_cache(thread_local_block_cache&&) = delete;
+            thread_local_block_cache& operator=(
+                thread_local_block_cache const&) = delete;
+            thread_local_block_cache& operator=(
+                thread_local_block_cache&&) = delete;
 
-            ~allocated_cache()
+            ~thread_local_block_cache()
             {
-                clear_cache();
+                while (free_list != nullptr)
+                {
+                    free_block* next = free_list->next;
+                    std::destroy_at(free_list);
+                    traits::deallocate(
+                        alloc, reinterpret_cast<block_type*>(free_list), 1);
+                    free_list = next;
+                }
             }
 
-            pointer allocate(size_type n)
+            [[nodiscard]] void* allocate()
             {
-                pointer p;
-                if (data.empty())
+                if (free_list == nullptr)
                 {
-                    p = traits::allocate(alloc, n);
+                    void* p = traits::allocate(alloc, 1);
                     if (p == nullptr)
                     {
                         throw std::bad_alloc();
                     }
+                    return p;
                 }
-                else
-                {
-                    p = data.top().first;
-                    data.pop();
-                }
 
-                ++allocated;
+                free_block* p = free_list;
+                free_list = p->next;
+                --cached;
+
+                std::destroy_at(p);
                 return p;
             }
 
-            void deallocate(pointer p, size_type n) noexcept
+            void deallocate(void* p) noexcept
             {
-                data.push(std::make_pair(p, n));
-                if (++deallocated > 2 * (allocated + 16))
+                bool local = true;
+                if constexpr (has_is_local<Allocator>::value)
                 {
-                    clear_cache();
-                    allocated = 0;
-                    deallocated = 0;
+                    local = alloc.is_local(p);
                 }
-            }
 
-        private:
-            void clear_cache() noexcept
-            {
-                while (!data.empty())
+                if (!local || cached == max_cached_blocks)
                 {
                     traits::deallocate(
-                        alloc, data.top().first, data.top().second);
-                    data.pop();
+                        alloc, static_cast<block_type*>(p), 1);
+                    return;
                 }
+
+                free_list = ::new (p) free_block{free_list};
+                ++cached;
+            }
+
+            static thread_local_block_cache& get(Allocator const& a)
+            {
+                thread_local thread_local_block_cache cache(a);
+                return cache;
             }
 
+        private:
             HPX_NO_UNIQUE_ADDRESS Allocator alloc;
-            std::stack<std::pair<T*, size_type>> data;
-            std::size_t allocated = 0;
-            std::size_t deallocated = 0;
+            free_block* free_list = nullptr;
+            std::size_t cached = 0;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Allocator caching single objects in per-thread pools of memory blocks,
+    // allocations of arrays are forwarded to the underlying allocator.
+    template <typename T = char, typename Allocator = std::allocator<T>>
+    struct thread_local_caching_allocator
+    {
+        HPX_NO_UNIQUE_ADDRESS Allocator alloc;
+
+        using traits = std::allocator_traits<Allocator>;
+
+        using value_type = typename traits::value_type;
+        using pointer = typename traits::pointer;
+        using const_pointer = typename traits::const_pointer;
+        using size_type = typename traits::size_type;
+        using difference_type = typename traits::difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = thread_local_caching_allocator<U,
+                typename traits::template rebind_alloc<U>>;
         };
 
-        allocated_cache& cache()
+        using is_always_equal = typename traits::is_always_equal;
+        using propagate_on_container_copy_assignment =
+            typename traits::propagate_on_container_copy_assignment;
+        using propagate_on_container_move_assignment =
+            typename traits::propagate_on_container_move_assignment;
+        using propagate_on_container_swap =
+            typename traits::propagate_on_container_swap;
+
+    private:
+        // T may still be incomplete when the allocator type is instantiated,
+        // the block type is determined only once memory is requested
+        auto& cache()
         {
-            thread_local allocated_cache allocated_data(alloc);
-            return allocated_data;
+            using block_allocator = typename traits::template rebind_alloc<
+                detail::caching_allocator_block_type<T>>;
+            using block_cache =
+                detail::thread_local_block_cache<block_allocator>;
+
+            return block_cache::get(block_allocator(alloc));
         }
 
     public:
@@ -158,12 +241,22 @@ namespace hpx::util {
             {
                 throw std::bad_array_new_length();
             }
-            return cache().allocate(n);
+
+            if (n != 1)
+            {
+                return traits::allocate(alloc, n);
+            }
+            return static_cast<pointer>(cache().allocate());
         }
 
         void deallocate(pointer p, size_type n) noexcept
         {
-            cache().deallocate(p, n);
+            if (n != 1)
+            {
+                traits::deallocate(alloc, p, n);
+                return;
+            }
+            cache().deallocate(p);
         }
 
         [[nodiscard]] constexpr size_type max_size() noexcept
@@ -0,0 +1,691 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class concurrent_cache concurrent_cache.hpp hpx/cache/concurrent_cache.hpp
+    ///
+    /// \brief The \a concurrent_cache implements a local (non-distributed)
+    ///        cache that can be used concurrently without any external
+    ///        locking.
+    ///
+    /// The entries are distributed over a number of independent shards based
+    /// on the hash of their keys. Each shard is protected by its own spinlock
+    /// and maintains its own statistics. Entries are evicted using the CLOCK
+    /// (second chance) algorithm, an approximation of LRU which only sets a
+    /// flag while looking up an entry. This keeps the critical sections
+    /// short and avoids the reordering of a list of all entries (as done by
+    /// the \a lru_cache) on every cache hit.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept. The default value is
+    ///                       the type \a statistics#no_statistics which does
+    ///                       not collect any numbers, but provides empty stubs
+    ///                       allowing the code to compile.
+    /// \tparam Hash          The hash function used for the keys.
+    /// \tparam KeyEqual      The function used to compare keys for equality.
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class concurrent_cache
+    {
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using statistics_type = Statistics;
+        using entry_pair = std::pair<key_type, entry_type>;
+        using size_type = std::size_t;
+
+    private:
+        using update_on_exit = typename statistics_type::update_on_exit;
+        using mutex_type = hpx::util::detail::spinlock;
+
+        struct slot
+        {
+            template <typename Entry_>
+            slot(key_type const& key, Entry_&& entry)
+              : value(key, HPX_FORWARD(Entry_, entry))
+            {
+            }
+
+            entry_pair value;
+            bool used = true;
+            bool referenced = false;
+        };
+
+        struct alignas(threads::get_cache_line_size()) shard
+        {
+            // Evict the next entry which was not referenced since the clock
+            // hand has passed it the last time, caller must hold the lock.
+            void evict()
+            {
+                HPX_ASSERT(size_.load(std::memory_order_relaxed) != 0);
+
+                while (true)
+                {
+                    if (hand_ >= slots_.size())
+                    {
+                        hand_ = 0;
+                    }
+
+                    slot& s = slots_[hand_];
+                    if (s.used)
+                    {
+                        if (!s.referenced)
+                        {
+                            remove(hand_++);
+                            statistics_.got_eviction();
+                            return;
+                        }
+                        s.referenced = false;    // give a second chance
+                    }
+                    ++hand_;
+                }
+            }
+
+            // caller must hold the lock
+            void remove(std::size_t index)
+            {
+                slot& s = slots_[index];
+                map_.erase(s.value.first);
+                s.used = false;
+                s.value = entry_pair();
+                free_.push_back(index);
+                size_.store(size_.load(std::memory_order_relaxed) - 1,
+                    std::memory_order_relaxed);
+            }
+
+            // Returns false if the shard can't hold any entries, caller must
+            // hold the lock.
+            template <typename Entry_>
+            bool insert_nonexist(key_type const& key, Entry_&& entry)
+            {
+                if (max_size_ == 0)
+                {
+                    return false;
+                }
+
+                if (size_.load(std::memory_order_relaxed) >= max_size_)
+                {
+                    evict();
+                }
+
+                std::size_t index = slots_.size();
+                if (!free_.empty())
+                {
+                    index = free_.back();
+                    free_.pop_back();
+
+                    slot& s = slots_[index];
+                    s.value = entry_pair(key, HPX_FORWARD(Entry_, entry));
+                    s.used = true;
+                    s.referenced = false;
+                }
+                else
+                {
+                    slots_.emplace_back(key, HPX_FORWARD(Entry_, entry));
+                }
+
+                map_.emplace(key, index);
+                size_.store(size_.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+
+                // update statistics
+                statistics_.got_insertion();
+                return true;
+            }
+
+            // Reduce the number of entries to the given maximum and squeeze
+            // out all unused slots, caller must hold the lock.
+            void reserve(size_type max_size)
+            {
+                max_size_ = max_size;
+                while (size_.load(std::memory_order_relaxed) > max_size_)
+                {
+                    evict();
+                }
+
+                if (free_.empty())
+                {
+                    return;
+                }
+
+                std::vector<slot> slots;
+                slots.reserve(size_.load(std::memory_order_relaxed));
+                for (slot& s : slots_)
+                {
+                    if (s.used)
+                    {
+                        map_[s.value.first] = slots.size();
+                        slots.push_back(HPX_MOVE(s));
+                    }
+                }
+
+                slots_ = HPX_MOVE(slots);
+                free_.clear();
+                hand_ = 0;
+            }
+
+            // caller must hold the lock
+            size_type clear()
+            {
+                size_type const erased = size_.load(std::memory_order_relaxed);
+                map_.clear();
+                slots_.clear();
+                free_.clear();
+                hand_ = 0;
+                size_.store(0, std::memory_order_relaxed);
+                return erased;
+            }
+
+            mutable mutex_type mtx_;
+
+            // the number of entries is read without holding the lock
+            std::atomic<size_type> size_{0};
+            size_type max_size_ = 0;
+            std::size_t hand_ = 0;
+
+            std::unordered_map<key_type, std::size_t, Hash, KeyEqual> map_;
+            std::vector<slot> slots_;
+            std::vector<std::size_t> free_;
+
+            statistics_type statistics_;
+        };
+
+        static std::size_t default_num_shards() noexcept
+        {
+            std::size_t const concurrency =
+                (std::max)(std::thread::hardware_concurrency(), 1u);
+
+            std::size_t num_shards = 1;
+            while (num_shards < concurrency)
+            {
+                num_shards <<= 1;
+            }
+            return num_shards;
+        }
+
+        static std::size_t round_to_power_of_two(std::size_t n) noexcept
+        {
+            std::size_t result = 1;
+            while (result < n)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        // Don't create more shards than there are entries in the cache,
+        // every shard has to be able to hold at least one entry.
+        static std::size_t clamp_num_shards(
+            std::size_t num_shards, size_type max_size) noexcept
+        {
+            while (max_size != 0 && num_shards > max_size)
+            {
+                num_shards >>= 1;
+            }
+            return num_shards;
+        }
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a concurrent_cache.
+        ///
+        /// \param max_size   [in] The maximal size this cache is allowed to
+        ///                   reach any time. The default is zero (no size
+        ///                   limitation).
+        /// \param num_shards [in] The number of independent shards used by
+        ///                   this cache instance. The value is rounded up to
+        ///                   the next power of two. The default is zero,
+        ///                   which creates roughly one shard per hardware
+        ///                   thread. No more shards than \a max_size are
+        ///                   created.
+        ///
+        explicit concurrent_cache(
+            size_type max_size = 0, std::size_t num_shards = 0)
+          : num_shards_(clamp_num_shards(
+                num_shards == 0 ? default_num_shards() :
+                                  round_to_power_of_two(num_shards),
+                max_size))
+          , shard_bits_(0)
+          , shards_(new shard[num_shards_])
+        {
+            while ((std::size_t(1) << shard_bits_) < num_shards_)
+            {
+                ++shard_bits_;
+            }
+            reserve(max_size);
+        }
+
+        concurrent_cache(concurrent_cache const&) = delete;
+        concurrent_cache(concurrent_cache&&) = delete;
+        concurrent_cache& operator=(concurrent_cache const&) = delete;
+        concurrent_cache& operator=(concurrent_cache&&) = delete;
+
+        ~concurrent_cache() = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        ///
+        /// \note         The returned value is a snapshot only as other
+        ///               threads might modify the cache concurrently.
+        ///
+        /// \returns The current size of this cache instance.
+        [[nodiscard]] size_type size() const noexcept
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                result += shards_[i].size_.load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        ///
+        /// \returns    The maximum size this cache instance is currently
+        ///             allowed to reach. If this number is zero the cache has
+        ///             no limitation with regard to a maximum size.
+        [[nodiscard]] size_type capacity() const noexcept
+        {
+            return max_size_.load(std::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return the number of shards used by this cache instance.
+        [[nodiscard]] constexpr std::size_t num_shards() const noexcept
+        {
+            return num_shards_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to.
+        ///
+        /// \note       The capacity is evenly distributed over all shards,
+        ///             thus a shard may start evicting entries before the
+        ///             overall capacity of the cache has been reached. The
+        ///             capacities of all shards add up to \a max_size. If
+        ///             \a max_size is smaller than the number of shards, some
+        ///             of the shards will not hold any entries.
+        void reserve(size_type max_size)
+        {
+            max_size_.store(max_size, std::memory_order_relaxed);
+
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                // zero means no limitation, otherwise the first shards get
+                // one of the remaining entries each
+                size_type shard_size = static_cast<size_type>(-1);
+                if (max_size != 0)
+                {
+                    shard_size = max_size / num_shards_ +
+                        (i < max_size % num_shards_ ? 1 : 0);
+                }
+
+                shard& s = shards_[i];
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.reserve(shard_size);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \param key    [in] The key for the entry which should be looked up
+        ///               in the cache.
+        ///
+        /// \note         This function does not mark the entry as recently
+        ///               used.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        [[nodiscard]] bool holds_key(key_type const& key) const
+        {
+            shard const& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.map_.find(key) != s.map_.end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key     [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey[out] Return the full real key found in the cache
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry)
+        {
+            shard& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(s.statistics_, statistics::method::get_entry);
+
+            auto it = s.map_.find(key);
+            if (it == s.map_.end())
+            {
+                // Got miss
+                s.statistics_.got_miss();    // update statistics
+                return false;
+            }
+
+            slot& e = s.slots_[it->second];
+            e.referenced = true;
+
+            // update statistics
+            s.statistics_.got_hit();
+
+            // got hit
+            realkey = e.value.first;
+            entry = e.value.second;
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param key    [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param entry  [in] The entry which should be added to the cache.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               added to the cache, otherwise (if an entry with the
+        ///               same key is already held, or if the shard of the key
+        ///               has no capacity) it returns \a false.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        bool insert(key_type const& key, Entry_&& entry)
+        {
+            shard& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::insert_entry);
+
+            if (s.map_.find(key) != s.map_.end())
+            {
+                return false;
+            }
+
+            return s.insert_nonexist(key, HPX_FORWARD(Entry_, entry));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The entry which should be used as a replacement
+        ///               for the existing value in the cache. If no entry is
+        ///               held for the given key, a new one is inserted.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        void update(key_type const& key, Entry_&& entry)
+        {
+            shard& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::update_entry);
+
+            // Is it already in the cache?
+            auto it = s.map_.find(key);
+            if (it == s.map_.end())
+            {
+                // got miss
+                s.statistics_.got_miss();    // update statistics
+                s.insert_nonexist(key, HPX_FORWARD(Entry_, entry));
+                return;
+            }
+
+            // got hit!
+            slot& e = s.slots_[it->second];
+            e.value.second = HPX_FORWARD(Entry_, entry);
+            e.referenced = true;
+
+            // update statistics
+            s.statistics_.got_hit();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The value which should be used as a replacement
+        ///               for the existing value in the cache.
+        /// \param f      [in] A callable taking two arguments, \a k and the
+        ///               key found in the cache (in that order). If \a f
+        ///               returns true, then the update will not succeed.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated, otherwise it returns \a false.
+        ///               If the entry currently is not held by the cache it is
+        ///               added and the return value reflects the outcome of
+        ///               the corresponding insert operation.
+        template <typename F, typename Entry_,
+            std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>, int> =
+                0>
+        bool update_if(key_type const& key, Entry_&& entry, F&& f)
+        {
+            shard& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::update_entry);
+
+            // Is it already in the cache?
+            auto it = s.map_.find(key);
+            if (it == s.map_.end())
+            {
+                // got miss
+                s.statistics_.got_miss();    // update statistics
+                return s.insert_nonexist(key, HPX_FORWARD(Entry_, entry));
+            }
+
+            if (f(key, it->first))
+                return false;
+
+            // got hit!
+            slot& e = s.slots_[it->second];
+            e.value.second = HPX_FORWARD(Entry_, entry);
+            e.referenced = true;
+
+            // update statistics
+            s.statistics_.got_hit();
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked for each of the entries
+        ///               currently held in the cache. An entry is considered
+        ///               for removal from the cache whenever the value
+        ///               returned from this invocation is \a true.
+        ///
+        /// \note         The shards are visited one after the other, entries
+        ///               that are concurrently added to an already visited
+        ///               shard are not considered.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                std::lock_guard<mutex_type> l(s.mtx_);
+                update_on_exit update(
+                    s.statistics_, statistics::method::erase_entry);
+
+                for (std::size_t index = 0; index != s.slots_.size(); ++index)
+                {
+                    if (s.slots_[index].used && ep(s.slots_[index].value))
+                    {
+                        ++erased;
+                        s.remove(index);
+
+                        // update statistics
+                        s.statistics_.got_eviction();
+                    }
+                }
+            }
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        ///
+        /// \returns      This function returns the number of removed entries.
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                std::lock_guard<mutex_type> l(s.mtx_);
+                erased += s.clear();
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Accumulate the statistics of all shards
+        ///
+        /// \param f      [in] A callable that is invoked with a reference to
+        ///               the statistics instance of each of the shards (while
+        ///               holding the lock of the shard). The values returned
+        ///               from these invocations are summed up.
+        ///
+        /// \returns      This function returns the sum of the values returned
+        ///               from invoking \a f for all shards.
+        template <typename F>
+        auto accumulate_statistics(F&& f)
+        {
+            using result_type =
+                std::decay_t<std::invoke_result_t<F&, statistics_type&>>;
+
+            result_type result = result_type();
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result += f(s.statistics_);
+            }
+            return result;
+        }
+
+    private:
+        // Use the upper bits of the (mixed) hash value to select the shard,
+        // the lower bits are used by the hash map inside the shard.
+        std::size_t get_shard_index(key_type const& key) const
+        {
+            if (shard_bits_ == 0)
+            {
+                return 0;
+            }
+
+            std::uint64_t const h =
+                static_cast<std::uint64_t>(Hash()(key)) * 0x9E3779B97F4A7C15ull;
+            return static_cast<std::size_t>(h >> (64 - shard_bits_));
+        }
+
+        shard& get_shard(key_type const& key)
+        {
+            return shards_[get_shard_index(key)];
+        }
+
+        shard const& get_shard(key_type const& key) const
+        {
+            return shards_[get_shard_index(key)];
+        }
+
+    private:
+        std::size_t const num_shards_;
+        std::size_t shard_bits_;
+        std::unique_ptr<shard[]> shards_;
+
+        std::atomic<size_type> max_size_{0};
+    };
+}    // namespace hpx::util::cache
@@ -0,0 +1,266 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/concurrent_cache.hpp>
+#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using cache_type = hpx::util::cache::concurrent_cache<std::size_t, std::string,
+    hpx::util::cache::statistics::local_full_statistics>;
+
+std::size_t get_hits(cache_type& c)
+{
+    return c.accumulate_statistics(
+        [](auto& s) { return s.hits(false); });
+}
+
+std::size_t get_misses(cache_type& c)
+{
+    return c.accumulate_statistics(
+        [](auto& s) { return s.misses(false); });
+}
+
+std::size_t get_insertions(cache_type& c)
+{
+    return c.accumulate_statistics(
+        [](auto& s) { return s.insertions(false); });
+}
+
+std::size_t get_evictions(cache_type& c)
+{
+    return c.accumulate_statistics(
+        [](auto& s) { return s.evictions(false); });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert_get()
+{
+    cache_type c(0, 4);
+    HPX_TEST_EQ(c.num_shards(), static_cast<std::size_t>(4));
+
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        HPX_TEST(c.insert(i, std::to_string(i)));
+    }
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(100));
+
+    // inserting an existing key must fail
+    HPX_TEST(!c.insert(42, std::string("42")));
+
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        std::size_t realkey = 0;
+        std::string value;
+        HPX_TEST(c.get_entry(i, realkey, value));
+        HPX_TEST_EQ(realkey, i);
+        HPX_TEST_EQ(value, std::to_string(i));
+    }
+
+    std::string value;
+    HPX_TEST(!c.get_entry(100, value));
+    HPX_TEST(c.holds_key(0));
+    HPX_TEST(!c.holds_key(100));
+
+    HPX_TEST_EQ(get_hits(c), static_cast<std::size_t>(100));
+    HPX_TEST_EQ(get_misses(c), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(get_insertions(c), static_cast<std::size_t>(100));
+    HPX_TEST_EQ(get_evictions(c), static_cast<std::size_t>(0));
+
+    HPX_TEST_EQ(c.accumulate_statistics([](auto& s) {
+        return s.get_get_entry_count(false);
+    }),
+        static_cast<std::int64_t>(101));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_eviction()
+{
+    // a single shard makes the CLOCK eviction order deterministic
+    cache_type c(4, 1);
+    HPX_TEST_EQ(c.capacity(), static_cast<std::size_t>(4));
+
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        HPX_TEST(c.insert(i, std::to_string(i)));
+    }
+
+    // mark entry 0 as recently used, it must survive the next eviction
+    std::string value;
+    HPX_TEST(c.get_entry(0, value));
+
+    HPX_TEST(c.insert(4, std::string("4")));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(4));
+    HPX_TEST_EQ(get_evictions(c), static_cast<std::size_t>(1));
+
+    HPX_TEST(c.holds_key(0));
+    HPX_TEST(!c.holds_key(1));
+    HPX_TEST(c.holds_key(4));
+
+    // shrinking the cache evicts entries
+    c.reserve(2);
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(2));
+    HPX_TEST_EQ(get_evictions(c), static_cast<std::size_t>(3));
+
+    // all remaining entries must still be accessible
+    std::size_t found = 0;
+    for (std::size_t i = 0; i != 5; ++i)
+    {
+        if (c.get_entry(i, value))
+        {
+            HPX_TEST_EQ(value, std::to_string(i));
+            ++found;
+        }
+    }
+    HPX_TEST_EQ(found, static_cast<std::size_t>(2));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_capacity()
+{
+    // the capacities of the shards must add up to the capacity of the cache
+    cache_type c(10, 4);
+    HPX_TEST_EQ(c.num_shards(), static_cast<std::size_t>(4));
+
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        c.update(i, std::to_string(i));
+    }
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(10));
+
+    // no more shards than entries are created
+    cache_type small(3, 8);
+    HPX_TEST_EQ(small.num_shards(), static_cast<std::size_t>(2));
+
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        small.update(i, std::to_string(i));
+    }
+    HPX_TEST_EQ(small.size(), static_cast<std::size_t>(3));
+
+    // shrinking the cache below the number of shards leaves shards empty
+    small.reserve(1);
+    HPX_TEST_EQ(small.size(), static_cast<std::size_t>(1));
+
+    std::size_t inserted = 0;
+    for (std::size_t i = 1000; i != 2000; ++i)
+    {
+        if (small.insert(i, std::to_string(i)))
+        {
+            ++inserted;
+        }
+    }
+    HPX_TEST_LT(inserted, static_cast<std::size_t>(1000));
+    HPX_TEST_EQ(small.size(), static_cast<std::size_t>(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_update_erase()
+{
+    cache_type c(0, 2);
+
+    c.update(1, std::string("1"));
+    c.update(1, std::string("one"));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(1));
+
+    std::string value;
+    HPX_TEST(c.get_entry(1, value));
+    HPX_TEST_EQ(value, std::string("one"));
+
+    // update_if doesn't replace the entry if the predicate returns true
+    HPX_TEST(!c.update_if(1, std::string("uno"),
+        [](std::size_t, std::size_t) { return true; }));
+    HPX_TEST(c.update_if(1, std::string("eins"),
+        [](std::size_t, std::size_t) { return false; }));
+    HPX_TEST(c.get_entry(1, value));
+    HPX_TEST_EQ(value, std::string("eins"));
+
+    for (std::size_t i = 2; i != 10; ++i)
+    {
+        HPX_TEST(c.insert(i, std::to_string(i)));
+    }
+
+    std::size_t const erased = c.erase(
+        [](std::pair<std::size_t, std::string> const& p) {
+            return p.first % 2 == 0;
+        });
+    HPX_TEST_EQ(erased, static_cast<std::size_t>(4));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(5));
+    HPX_TEST(!c.holds_key(2));
+    HPX_TEST(c.holds_key(3));
+
+    HPX_TEST_EQ(c.clear(), static_cast<std::size_t>(5));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_access()
+{
+    constexpr std::size_t num_threads = 4;
+    constexpr std::size_t num_keys = 1000;
+
+    cache_type c(num_keys / 2);
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&c, t]() {
+            std::string value;
+            for (std::size_t i = 0; i != 10 * num_keys; ++i)
+            {
+                std::size_t const key = (i * 7 + t) % num_keys;
+                if (c.get_entry(key, value))
+                {
+                    HPX_TEST_EQ(value, std::to_string(key));
+                }
+                else
+                {
+                    c.update(key, std::to_string(key));
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_LTE(c.size(), num_keys / 2);
+
+    // every lookup and every update was either a hit or a miss
+    auto const get_entry_count = c.accumulate_statistics(
+        [](auto& s) { return s.get_get_entry_count(false); });
+    auto const update_entry_count = c.accumulate_statistics([](auto& s) {
+        return s.get_update_entry_count(false);
+    });
+
+    HPX_TEST_EQ(get_entry_count,
+        static_cast<std::int64_t>(num_threads * 10 * num_keys));
+    HPX_TEST_EQ(static_cast<std::int64_t>(get_hits(c) + get_misses(c)),
+        get_entry_count + update_entry_count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert_get();
+    test_eviction();
+    test_capacity();
+    test_update_erase();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
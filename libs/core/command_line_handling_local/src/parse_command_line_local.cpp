@@ -481,6 +481,7 @@ namespace hpx::local::detail {
                 "--hpx:queuing=local-workrequesting-fifo, "
                 "--hpx:queuing=local-workrequesting-lifo, "
                 "--hpx:queuing=local-workrequesting-mc, "
+                "--hpx:queuing=local-workstealing, "
                 "and --hpx:queuing=local-priority only")
             ("hpx:pu-step", value<std::size_t>(),
                 "the step between used processing unit numbers for this "
@@ -490,6 +491,7 @@ namespace hpx::local::detail {
                 "--hpx:queuing=local-workrequesting-fifo, "
                 "--hpx:queuing=local-workrequesting-lifo, "
                 "--hpx:queuing=local-workrequesting-mc, "
+                "--hpx:queuing=local-workstealing, "
                 "and --hpx:queuing=local-priority only")
             ("hpx:affinity", value<std::string>(),
                 "the affinity domain the OS threads will be confined to, "
@@ -499,6 +501,7 @@ namespace hpx::local::detail {
                 "--hpx:queuing=local-workrequesting-fifo, "
                 "--hpx:queuing=local-workrequesting-lifo, "
                 "--hpx:queuing=local-workrequesting-mc, "
+                "--hpx:queuing=local-workstealing, "
                 " and --hpx:queuing=local-priority only")
             ("hpx:bind", value<std::vector<std::string> >()->composing(),
                 "the detailed affinity description for the OS threads, see "
@@ -525,7 +528,8 @@ namespace hpx::local::detail {
                 "'local', 'local-priority-fifo','local-priority-lifo', "
                 "'abp-priority-fifo', 'abp-priority-lifo', 'static', "
                 "'static-priority', 'local-workrequesting-fifo',"
-                "'local-workrequesting-lifo', and 'local-workrequesting-mc' "
+                "'local-workrequesting-lifo', 'local-workrequesting-mc', "
+                "and 'local-workstealing' "
                 "(default: 'local-priority'; all option values can be "
                 "abbreviated)")
             ("hpx:high-priority-threads", value<std::size_t>(),
@@ -535,6 +539,7 @@ namespace hpx::local::detail {
                 "--hpx:queuing=local-workrequesting-fifo, "
                 "--hpx:queuing=local-workrequesting-lifo, "
                 "--hpx:queuing=local-workrequesting-mc, "
+                "--hpx:queuing=local-workstealing, "
                 " and --hpx:queuing=abp-priority only)")
             ("hpx:numa-sensitive", value<std::size_t>()->implicit_value(0),
                 "makes the local-priority scheduler NUMA sensitive ("
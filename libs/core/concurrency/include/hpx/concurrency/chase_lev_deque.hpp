@@ -0,0 +1,227 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace hpx::concurrency {
+
+    /// \brief A dynamically growing work-stealing deque.
+    ///
+    /// Implements the Chase-Lev deque (D. Chase, Y. Lev, "Dynamic circular
+    /// work-stealing deque", SPAA 2005) using the memory orderings proposed by
+    /// N. M. Le et.al., "Correct and efficient work-stealing for weak memory
+    /// models", PPoPP 2013.
+    ///
+    /// Only a single thread (the owner) may call \a push_bottom and
+    /// \a pop_bottom, which operate on the deque in LIFO order. Any other
+    /// thread may concurrently call \a steal, which removes the oldest item.
+    /// Steal operations may fail spuriously if they race with other thieves
+    /// or with the owner taking the last item.
+    ///
+    /// Buffers replaced when the deque grows are kept alive until the deque
+    /// is destroyed, as concurrent thieves might still read from them.
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+            "chase_lev_deque requires trivially copyable items");
+
+        struct buffer
+        {
+            explicit buffer(std::size_t capacity)
+              : mask_(capacity - 1)
+              , items_(new std::atomic<T>[capacity])
+            {
+                HPX_ASSERT((capacity & mask_) == 0);
+            }
+
+            [[nodiscard]] std::size_t capacity() const noexcept
+            {
+                return mask_ + 1;
+            }
+
+            [[nodiscard]] T load(std::int64_t i) const noexcept
+            {
+                return items_[static_cast<std::size_t>(i) & mask_].load(
+                    std::memory_order_relaxed);
+            }
+
+            void store(std::int64_t i, T value) noexcept
+            {
+                items_[static_cast<std::size_t>(i) & mask_].store(
+                    value, std::memory_order_relaxed);
+            }
+
+            std::unique_ptr<buffer> grow(
+                std::int64_t top, std::int64_t bottom) const
+            {
+                auto result = std::make_unique<buffer>(2 * capacity());
+                for (std::int64_t i = top; i != bottom; ++i)
+                {
+                    result->store(i, load(i));
+                }
+                return result;
+            }
+
+            std::size_t mask_;
+            std::unique_ptr<std::atomic<T>[]> items_;
+        };
+
+        static constexpr std::size_t round_up_capacity(
+            std::size_t capacity) noexcept
+        {
+            std::size_t result = 16;
+            while (result < capacity)
+            {
+                result *= 2;
+            }
+            return result;
+        }
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        explicit chase_lev_deque(std::size_t initial_capacity = 64)
+          : top_(0)
+          , bottom_(0)
+        {
+            buffers_.push_back(
+                std::make_unique<buffer>(round_up_capacity(initial_capacity)));
+            buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque(chase_lev_deque&&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque&&) = delete;
+
+        ~chase_lev_deque() = default;
+
+        // Add an item at the bottom of the deque, must be called by the owner
+        // only.
+        void push_bottom(T value)
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_acquire);
+            buffer* a = buffer_.load(std::memory_order_relaxed);
+
+            if (b - t > static_cast<std::int64_t>(a->capacity()) - 1)
+            {
+                buffers_.push_back(a->grow(t, b));
+                a = buffers_.back().get();
+                buffer_.store(a, std::memory_order_release);
+            }
+
+            a->store(b, value);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // Remove the most recently added item from the bottom of the deque,
+        // must be called by the owner only.
+        [[nodiscard]] bool pop_bottom(T& value) noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed) - 1;
+            buffer const* a = buffer_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            T result = a->load(b);
+            if (t == b)
+            {
+                // this is the last item, race against the thieves for it
+                bool const success = top_.data_.compare_exchange_strong(t,
+                    t + 1, std::memory_order_seq_cst,
+                    std::memory_order_relaxed);
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                if (!success)
+                {
+                    return false;
+                }
+            }
+
+            value = result;
+            return true;
+        }
+
+        // Remove the oldest item from the top of the deque, may be called by
+        // any thread.
+        [[nodiscard]] bool steal(T& value) noexcept
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+            {
+                return false;
+            }
+
+            buffer const* a = buffer_.load(std::memory_order_acquire);
+            T result = a->load(t);
+            if (!top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                // lost the race against another thief or the owner
+                return false;
+            }
+
+            value = result;
+            return true;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? static_cast<std::size_t>(b - t) : 0;
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return buffer_.load(std::memory_order_relaxed)->capacity();
+        }
+
+    private:
+        // thieves modify top_, the owner modifies bottom_
+        util::cache_line_data<std::atomic<std::int64_t>> top_;
+        util::cache_line_data<std::atomic<std::int64_t>> bottom_;
+
+        std::atomic<buffer*> buffer_;
+
+        // all buffers ever used, accessed by the owner only
+        std::vector<std::unique_ptr<buffer>> buffers_;
+    };
+}    // namespace hpx::concurrency
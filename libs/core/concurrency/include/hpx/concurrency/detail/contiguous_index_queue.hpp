@@ -214,6 +214,40 @@ namespace hpx::concurrency::detail {
             return hpx::optional<T>(HPX_MOVE(index));
         }
 
+        /// \brief Attempt to pop a range of items from the right of the queue.
+        ///
+        /// Attempt to pop half of the remaining items (rounded up) from the
+        /// right (end) of the queue in one go. If no items are left
+        /// hpx::nullopt is returned, otherwise the popped range [first, last).
+        hpx::optional<std::pair<T, T>> pop_right_half() noexcept
+        {
+            range desired_range{0, 0};
+            T middle = 0;
+
+            range expected_range =
+                current_range.data_.load(std::memory_order_relaxed);
+
+            do
+            {
+                if (expected_range.empty())
+                {
+                    return hpx::optional<std::pair<T, T>>(hpx::nullopt);
+                }
+
+                // reduce pipeline pressure
+                HPX_SMT_PAUSE;
+
+                middle = static_cast<T>(expected_range.first +
+                    (expected_range.last - expected_range.first) / 2);
+                desired_range = range{expected_range.first, middle};
+
+            } while (!current_range.data_.compare_exchange_weak(
+                expected_range, desired_range));
+
+            return hpx::optional<std::pair<T, T>>(
+                std::pair<T, T>(middle, expected_range.last));
+        }
+
         /// \brief Attempt to pop an item from the given end of the queue.
         ///
         /// Attempt to pop an item from the given end of the queue. If no items
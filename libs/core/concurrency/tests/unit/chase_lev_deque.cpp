@@ -0,0 +1,141 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using deque_type = hpx::concurrency::chase_lev_deque<std::uintptr_t>;
+
+void simple_deque_test()
+{
+    deque_type q(4);
+
+    HPX_TEST(q.empty());
+
+    std::uintptr_t value = 0;
+    HPX_TEST(!q.pop_bottom(value));
+    HPX_TEST(!q.steal(value));
+
+    for (std::uintptr_t i = 1; i <= 3; ++i)
+    {
+        q.push_bottom(i);
+    }
+    HPX_TEST_EQ(q.size(), static_cast<std::size_t>(3));
+
+    // the owner removes items in LIFO order
+    HPX_TEST(q.pop_bottom(value));
+    HPX_TEST_EQ(value, static_cast<std::uintptr_t>(3));
+
+    // thieves remove items in FIFO order
+    HPX_TEST(q.steal(value));
+    HPX_TEST_EQ(value, static_cast<std::uintptr_t>(1));
+
+    HPX_TEST(q.pop_bottom(value));
+    HPX_TEST_EQ(value, static_cast<std::uintptr_t>(2));
+
+    HPX_TEST(q.empty());
+    HPX_TEST(!q.pop_bottom(value));
+    HPX_TEST(!q.steal(value));
+}
+
+void grow_deque_test()
+{
+    deque_type q(16);
+    std::size_t const capacity = q.capacity();
+
+    std::uintptr_t const count = 10 * capacity;
+    for (std::uintptr_t i = 0; i != count; ++i)
+    {
+        q.push_bottom(i);
+    }
+
+    HPX_TEST_LT(capacity, q.capacity());
+    HPX_TEST_EQ(q.size(), static_cast<std::size_t>(count));
+
+    std::uintptr_t value = 0;
+    for (std::uintptr_t i = 0; i != count / 2; ++i)
+    {
+        HPX_TEST(q.steal(value));
+        HPX_TEST_EQ(value, i);
+    }
+    for (std::uintptr_t i = count; i != count / 2; --i)
+    {
+        HPX_TEST(q.pop_bottom(value));
+        HPX_TEST_EQ(value, i - 1);
+    }
+
+    HPX_TEST(q.empty());
+}
+
+void concurrent_deque_test()
+{
+    constexpr std::uintptr_t count = 100000;
+    constexpr std::size_t num_thieves = 3;
+
+    deque_type q;
+    std::vector<std::atomic<int>> seen(count);
+    std::atomic<bool> done(false);
+
+    auto record = [&](std::uintptr_t value) { ++seen[value]; };
+
+    std::vector<std::thread> thieves;
+    for (std::size_t i = 0; i != num_thieves; ++i)
+    {
+        thieves.emplace_back([&]() {
+            std::uintptr_t value = 0;
+            while (!done.load(std::memory_order_acquire))
+            {
+                if (q.steal(value))
+                {
+                    record(value);
+                }
+            }
+        });
+    }
+
+    // the owner pushes all items and removes some of them itself
+    std::uintptr_t value = 0;
+    for (std::uintptr_t i = 0; i != count; ++i)
+    {
+        q.push_bottom(i);
+        if (i % 3 == 0 && q.pop_bottom(value))
+        {
+            record(value);
+        }
+    }
+    while (q.pop_bottom(value))
+    {
+        record(value);
+    }
+
+    done.store(true, std::memory_order_release);
+    for (std::thread& t : thieves)
+    {
+        t.join();
+    }
+
+    // every item has to be taken exactly once
+    HPX_TEST(q.empty());
+    for (std::uintptr_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(seen[i].load(), 1);
+    }
+}
+
+int main()
+{
+    simple_deque_test();
+    grow_deque_test();
+    concurrent_deque_test();
+
+    return hpx::util::report_errors();
+}
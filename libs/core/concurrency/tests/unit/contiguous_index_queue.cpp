@@ -23,6 +23,7 @@
 #include <iterator>
 #include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
 unsigned int seed = std::random_device{}();
@@ -91,12 +92,40 @@ void test_basic()
         HPX_TEST(!q.pop_left());
         HPX_TEST(!q.pop_right());
     }
+
+    {
+        // Popping half of the items from the right should give us the
+        // expected ranges.
+        std::uint32_t first = 3;
+        std::uint32_t last = 10;
+        hpx::concurrency::detail::contiguous_index_queue<> q{first, last};
+
+        auto curr = q.pop_right_half();
+        HPX_TEST(curr);
+        HPX_TEST_EQ(curr->first, std::uint32_t(6));
+        HPX_TEST_EQ(curr->second, std::uint32_t(10));
+
+        curr = q.pop_right_half();
+        HPX_TEST(curr);
+        HPX_TEST_EQ(curr->first, std::uint32_t(4));
+        HPX_TEST_EQ(curr->second, std::uint32_t(6));
+
+        curr = q.pop_right_half();
+        HPX_TEST(curr);
+        HPX_TEST_EQ(curr->first, std::uint32_t(3));
+        HPX_TEST_EQ(curr->second, std::uint32_t(4));
+
+        HPX_TEST(q.empty());
+        HPX_TEST(!q.pop_right_half());
+        HPX_TEST(!q.pop_left());
+    }
 }
 
 enum class pop_mode
 {
     left,
     right,
+    right_half,
     random
 };
 
@@ -126,6 +155,18 @@ void test_concurrent_worker(pop_mode m, std::size_t thread_index,
             popped_indices.push_back(curr.value());
         }
         break;
+    case pop_mode::right_half:
+    {
+        hpx::optional<std::pair<std::uint32_t, std::uint32_t>> range;
+        while ((range = q.pop_right_half()))
+        {
+            for (std::uint32_t i = range->first; i != range->second; ++i)
+            {
+                popped_indices.push_back(i);
+            }
+        }
+        break;
+    }
     case pop_mode::random:
         while (d(r) == 0 ? (curr = q.pop_left()) : (curr = q.pop_right()))
         {
@@ -206,6 +247,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_basic();
     test_concurrent(pop_mode::left);
     test_concurrent(pop_mode::right);
+    test_concurrent(pop_mode::right_half);
     test_concurrent(pop_mode::random);
 
     return hpx::local::finalize();
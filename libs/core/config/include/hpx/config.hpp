@@ -400,6 +400,22 @@
 #  define HPX_IDLE_BACKOFF_TIME_MAX 1000
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Resolution (in microseconds) of the per-worker timer wheels used to wake up
+// HPX threads from timed suspension. A value of zero disables the timer wheels
+// (timed suspension will be handled by the default timer service instead).
+#if !defined(HPX_TIMER_WHEEL_RESOLUTION)
+#  define HPX_TIMER_WHEEL_RESOLUTION 1000
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of terminated thread objects shared between the thread
+// queues of a scheduler for reuse (in addition to the few thread objects kept
+// by each queue).
+#if !defined(HPX_THREAD_QUEUE_MAX_RECYCLED_THREADS)
+#  define HPX_THREAD_QUEUE_MAX_RECYCLED_THREADS 10000
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #if !defined(HPX_WRAPPER_HEAP_STEP)
 #  define HPX_WRAPPER_HEAP_STEP 0xFFFFU
@@ -70,4 +70,15 @@
 #if !defined(HPX_HUGE_STACK_SIZE)
 #  define HPX_HUGE_STACK_SIZE     0x2000000       // 32MByte
 #endif
+
+// Maximum number of bytes of released stacks kept for reuse per NUMA domain
+#if !defined(HPX_STACK_POOL_MAX_SIZE)
+#  define HPX_STACK_POOL_MAX_SIZE 0x4000000       // 64MByte
+#endif
+
+// Sample the stack usage of every n-th HPX thread (if enabled at configuration
+// time, see HPX_COROUTINES_WITH_STACK_USAGE_SAMPLING)
+#if !defined(HPX_STACK_USAGE_SAMPLING_RATE)
+#  define HPX_STACK_USAGE_SAMPLING_RATE 100
+#endif
 // clang-format on
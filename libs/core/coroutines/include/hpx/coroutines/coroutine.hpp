@@ -33,6 +33,7 @@
 #include <hpx/config.hpp>
 
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/config/defines.hpp>
 #include <hpx/coroutines/coroutine_fwd.hpp>
 #include <hpx/coroutines/detail/coroutine_accessor.hpp>
 #include <hpx/coroutines/detail/coroutine_impl.hpp>
@@ -174,6 +175,15 @@ namespace hpx::threads::coroutines {
         }
 #endif
 
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+        // Return the stack usage (in bytes) of the last run of the coroutine
+        // function, or -1 if it was not sampled.
+        std::ptrdiff_t get_stack_usage() const noexcept
+        {
+            return impl_.get_stack_usage();
+        }
+#endif
+
         constexpr impl_type* impl() noexcept
         {
             return &impl_;
@@ -16,6 +16,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/config/defines.hpp>
 #include <hpx/coroutines/detail/get_stack_pointer.hpp>
 #include <hpx/coroutines/detail/posix_utility.hpp>
 #include <hpx/coroutines/detail/swap_context.hpp>
@@ -321,6 +322,10 @@ namespace hpx::threads::coroutines::detail::lx {
             posix::watermark_stack(
                 m_stack, static_cast<std::size_t>(m_stack_size));
 
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+            start_stack_usage_sampling();
+#endif
+
             using fun_type = void(void*);
             fun_type* funp = trampoline<CoroutineImpl>;
 
@@ -371,6 +376,27 @@ namespace hpx::threads::coroutines::detail::lx {
                 return;
 
             HPX_ASSERT(m_stack);
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+            if (m_stack_painted)
+            {
+                // the painted pages have to be given back in any case
+                m_stack_painted = false;
+                m_stack_usage =
+                    static_cast<std::ptrdiff_t>(posix::get_painted_stack_usage(
+                        m_stack, static_cast<std::size_t>(m_stack_size)));
+                posix::discard_stack(
+                    m_stack, static_cast<std::size_t>(m_stack_size));
+
+                // the stack is reused, restore the watermark the regular
+                // reset below relies on
+                posix::watermark_stack(
+                    m_stack, static_cast<std::size_t>(m_stack_size));
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+                increment_stack_unbind_count();
+#endif
+                return;
+            }
+#endif
             if (posix::reset_stack(
                     m_stack, static_cast<std::size_t>(m_stack_size)))
             {
@@ -402,6 +428,9 @@ namespace hpx::threads::coroutines::detail::lx {
 #if defined(HPX_HAVE_ADDRESS_SANITIZER)
             asan_stack_size = m_stack_size;
             asan_stack_bottom = const_cast<void const*>(m_stack);
+#endif
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+            start_stack_usage_sampling();
 #endif
         }
 
@@ -411,6 +440,15 @@ namespace hpx::threads::coroutines::detail::lx {
                 context_size;
         }
 
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+        // Return the number of bytes of stack used by the last execution of
+        // this context, or -1 if the stack usage was not sampled.
+        constexpr std::ptrdiff_t get_stack_usage() const noexcept
+        {
+            return m_stack_usage;
+        }
+#endif
+
         using counter_type = std::atomic<std::int64_t>;
 
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
@@ -457,6 +495,28 @@ namespace hpx::threads::coroutines::detail::lx {
             x86_linux_context_impl_base const& to, yield_hint) noexcept;
 
     private:
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+        void start_stack_usage_sampling() noexcept
+        {
+            m_stack_usage = -1;
+
+            std::size_t const rate = posix::stack_usage_sampling_rate;
+            if (rate == 0)
+            {
+                return;
+            }
+
+            // avoid contention, sampling doesn't have to be exact
+            static thread_local std::size_t sample_count = 0;
+            if (++sample_count % rate == 0)
+            {
+                posix::paint_stack(
+                    m_stack, static_cast<std::size_t>(m_stack_size));
+                m_stack_painted = true;
+            }
+        }
+#endif
+
         void set_sigsegv_handler()
         {
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION) &&                               \
@@ -526,6 +586,11 @@ namespace hpx::threads::coroutines::detail::lx {
         std::ptrdiff_t m_stack_size;
         void* m_stack;
 
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+        std::ptrdiff_t m_stack_usage = -1;
+        bool m_stack_painted = false;
+#endif
+
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION) &&                               \
     !defined(HPX_HAVE_ADDRESS_SANITIZER)
         struct sigaction action;
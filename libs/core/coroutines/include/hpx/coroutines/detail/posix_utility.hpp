@@ -32,6 +32,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/config/defines.hpp>
 
 // include unistd.h conditionally to check for POSIX version. Not all OSs have the
 // unistd header...
@@ -44,8 +45,10 @@
  * Most of these utilities are really pure C++, but they are useful
  * only on posix systems.
  */
+#include <algorithm>
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
 
@@ -81,54 +84,17 @@ namespace hpx::threads::coroutines::detail::posix {
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
-    inline void* alloc_stack(std::size_t size)
-    {
-#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
-        if (use_guard_pages)
-        {
-            size += EXEC_PAGESIZE;
-        }
-#endif
-        void* real_stack = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
-#if defined(__APPLE__)
-            MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
-#elif defined(__FreeBSD__)
-            MAP_PRIVATE | MAP_ANON,
-#else
-            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
-#endif
-            -1, 0);
+#define HPX_COROUTINES_HAVE_STACK_POOL
 
-        if (real_stack == MAP_FAILED)
-        {
-            char const* error_message =
-                "mmap() failed to allocate thread stack";
-            if (ENOMEM == errno && use_guard_pages)
-            {
-                error_message = "mmap() failed to allocate thread stack due to "
-                                " insufficient resources, increase "
-                                "/proc/sys/vm/max_map_count or add "
-                                "--hpx:ini=hpx.stacks.use_guard_pages=0 to the "
-                                "command line";
-            }
-            throw std::runtime_error(error_message);
-        }
+    // These global variables control whether the stacks of terminated
+    // threads are kept for later reuse and how many bytes worth of stacks are
+    // kept at most per NUMA domain.
+    HPX_CORE_EXPORT extern bool use_stack_pool;
+    HPX_CORE_EXPORT extern std::size_t stack_pool_max_size;
 
-#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
-        if (use_guard_pages)
-        {
-            // Set the guard page.
-            ::mprotect(real_stack, EXEC_PAGESIZE, PROT_NONE);
-
-            void** stack = static_cast<void**>(real_stack) +
-                (EXEC_PAGESIZE / sizeof(void*));
-            return static_cast<void*>(stack);
-        }
-        return real_stack;
-#else
-        return real_stack;
-#endif
-    }
+    // Allocate a new stack, stacks released earlier on the current NUMA domain
+    // are reused if possible.
+    HPX_CORE_EXPORT void* alloc_stack(std::size_t size);
 
     inline void watermark_stack(void* stack, std::size_t size)
     {
@@ -140,6 +106,13 @@ namespace hpx::threads::coroutines::detail::posix {
         *watermark = reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull);
     }
 
+    // Give all but the topmost page of the stack back to the OS. If stacks are
+    // pooled, the pages are reclaimed lazily (MADV_FREE) where supported, i.e.
+    // only under memory pressure. Reusing the stack before that happens does
+    // not cause any page faults.
+    HPX_CORE_EXPORT void release_stack_pages(
+        void* stack, std::size_t size) noexcept;
+
     inline bool reset_stack(void* stack, std::size_t size)
     {
         void** watermark = static_cast<void**>(stack) +
@@ -151,31 +124,95 @@ namespace hpx::threads::coroutines::detail::posix {
         {
             // We never free up the first page, as it's initialized only when the
             // stack is created.
-            ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
+            release_stack_pages(stack, size);
+
+            // re-arm the watermark for the next user of this stack
+            *watermark = reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull);
             return true;
         }
 
         return false;
     }
 
-    inline void free_stack(void* stack, std::size_t size)
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+    // The stack usage of every n-th (re-)used stack is sampled, zero disables
+    // the sampling.
+    HPX_CORE_EXPORT extern std::size_t stack_usage_sampling_rate;
+
+    // Only this many bytes right below the topmost page of a sampled stack
+    // are painted. This keeps the sampling from faulting in the whole stack,
+    // stack usage beyond this window is not measured.
+    HPX_CORE_EXPORT extern std::size_t stack_paint_window_size;
+
+    inline constexpr std::uintptr_t stack_paint_pattern =
+        static_cast<std::uintptr_t>(0xA5A5A5A5A5A5A5A5ull);
+
+    // Return the number of bytes at the bottom of the stack which are not
+    // covered by the paint window.
+    inline std::size_t get_unpainted_stack_size(std::size_t size) noexcept
+    {
+        std::size_t const window =
+            (std::min)(size - EXEC_PAGESIZE, stack_paint_window_size) &
+            ~(sizeof(std::uintptr_t) - 1);
+        return size - EXEC_PAGESIZE - window;
+    }
+
+    // Fill the paint window right below the topmost page of the stack with a
+    // known pattern, this allows to determine the high-water mark of the
+    // stack later on.
+    inline void paint_stack(void* stack, std::size_t size) noexcept
     {
-#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
-        if (use_guard_pages)
+        auto* const begin = static_cast<std::uintptr_t*>(stack) +
+            get_unpainted_stack_size(size) / sizeof(std::uintptr_t);
+        std::fill(begin,
+            static_cast<std::uintptr_t*>(stack) +
+                (size - EXEC_PAGESIZE) / sizeof(std::uintptr_t),
+            stack_paint_pattern);
+    }
+
+    // Return the number of bytes used of a stack painted before. A stack
+    // which has overrun the paint window is reported as being fully used.
+    inline std::size_t get_painted_stack_usage(
+        void const* stack, std::size_t size) noexcept
+    {
+        std::size_t const unpainted = get_unpainted_stack_size(size);
+        auto const* const begin = static_cast<std::uintptr_t const*>(stack) +
+            unpainted / sizeof(std::uintptr_t);
+        auto const* const end = static_cast<std::uintptr_t const*>(stack) +
+            (size - EXEC_PAGESIZE) / sizeof(std::uintptr_t);
+
+        if (unpainted != 0 && *begin != stack_paint_pattern)
         {
-            void** real_stack =
-                static_cast<void**>(stack) - (EXEC_PAGESIZE / sizeof(void*));
-            ::munmap(static_cast<void*>(real_stack), size + EXEC_PAGESIZE);
+            return size;
         }
-        else
+
+        auto const* p = begin;
+        while (p != end && *p == stack_paint_pattern)
         {
-            ::munmap(stack, size);
+            ++p;
         }
-#else
-        ::munmap(stack, size);
-#endif
+        return size - unpainted -
+            static_cast<std::size_t>(p - begin) * sizeof(*p);
     }
 
+    // Unconditionally give all but the topmost page of the stack back to the
+    // OS.
+    inline void discard_stack(void* stack, std::size_t size) noexcept
+    {
+        ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
+    }
+#endif
+
+    // Release the given stack. The stack is handed to the pool of the NUMA
+    // domain its memory is local to (its cold pages are returned to the OS
+    // lazily), or unmapped if the pool is disabled or full.
+    HPX_CORE_EXPORT void free_stack(void* stack, std::size_t size) noexcept;
+
+    // Statistics of the stack pool, exposed as performance counters.
+    HPX_CORE_EXPORT std::int64_t get_stack_pool_hit_count(bool reset) noexcept;
+    HPX_CORE_EXPORT std::int64_t get_stack_pool_miss_count(bool reset) noexcept;
+    HPX_CORE_EXPORT std::int64_t get_stack_mapped_bytes(bool reset) noexcept;
+
 #else
     // non-mmap()
 
@@ -173,6 +173,8 @@ namespace hpx::threads {
         nostack = 5,    ///< this thread does not suspend
                         ///< (does not need a stack)
         current = 6,    ///< use size of current thread's stack
+        automatic = 7,  ///< use the smallest stack size sufficient for
+                        ///< earlier threads with the same description
 
         default_ = small_,    ///< use default stack size
         minimal = small_,     ///< use minimally stack size
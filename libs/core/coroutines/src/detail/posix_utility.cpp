@@ -12,12 +12,348 @@
 
 #include <hpx/coroutines/detail/posix_utility.hpp>
 
+#if defined(HPX_COROUTINES_HAVE_STACK_POOL)
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#endif
+
 namespace hpx::threads::coroutines::detail::posix {
 
     ///////////////////////////////////////////////////////////////////////////
     // this global variable is used to control whether guard pages will be used
     // or not
     bool use_guard_pages = true;
+
+#if defined(HPX_COROUTINES_HAVE_STACK_POOL)
+    ///////////////////////////////////////////////////////////////////////////
+    // these global variables are used to control whether released stacks are
+    // pooled for later reuse or not
+    bool use_stack_pool = true;
+    std::size_t stack_pool_max_size = HPX_STACK_POOL_MAX_SIZE;
+
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+    // this global variable is used to control how often the stack usage of
+    // HPX threads is sampled
+    std::size_t stack_usage_sampling_rate = HPX_STACK_USAGE_SAMPLING_RATE;
+
+    // this global variable is used to control how much of a sampled stack is
+    // painted, it is set to the configured small stack size
+    std::size_t stack_paint_window_size = HPX_SMALL_STACK_SIZE;
+#endif
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        void* map_stack(std::size_t size)
+        {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+            if (use_guard_pages)
+            {
+                size += EXEC_PAGESIZE;
+            }
+#endif
+            void* real_stack = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#elif defined(__FreeBSD__)
+                MAP_PRIVATE | MAP_ANON,
+#else
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                -1, 0);
+
+            if (real_stack == MAP_FAILED)
+            {
+                char const* error_message =
+                    "mmap() failed to allocate thread stack";
+                if (ENOMEM == errno && use_guard_pages)
+                {
+                    error_message =
+                        "mmap() failed to allocate thread stack due to "
+                        " insufficient resources, increase "
+                        "/proc/sys/vm/max_map_count or add "
+                        "--hpx:ini=hpx.stacks.use_guard_pages=0 to the "
+                        "command line";
+                }
+                throw std::runtime_error(error_message);
+            }
+
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+            if (use_guard_pages)
+            {
+                // Set the guard page.
+                ::mprotect(real_stack, EXEC_PAGESIZE, PROT_NONE);
+
+                void** stack = static_cast<void**>(real_stack) +
+                    (EXEC_PAGESIZE / sizeof(void*));
+                return static_cast<void*>(stack);
+            }
+            return real_stack;
+#else
+            return real_stack;
+#endif
+        }
+
+        void unmap_stack(void* stack, std::size_t size) noexcept
+        {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+            if (use_guard_pages)
+            {
+                void** real_stack = static_cast<void**>(stack) -
+                    (EXEC_PAGESIZE / sizeof(void*));
+                ::munmap(static_cast<void*>(real_stack), size + EXEC_PAGESIZE);
+            }
+            else
+            {
+                ::munmap(stack, size);
+            }
+#else
+            ::munmap(stack, size);
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Pooled stacks are kept in intrusive lists, the list node is placed
+        // at the top end of the released stack (the topmost page is never
+        // given back to the OS).
+        struct pooled_stack
+        {
+            pooled_stack* next;
+        };
+
+        pooled_stack* get_pooled_stack(void* stack, std::size_t size) noexcept
+        {
+            return reinterpret_cast<pooled_stack*>(
+                static_cast<char*>(stack) + size - sizeof(pooled_stack));
+        }
+
+        void* get_stack(pooled_stack* p, std::size_t size) noexcept
+        {
+            return reinterpret_cast<char*>(p) + sizeof(pooled_stack) - size;
+        }
+
+        // Stacks are binned by their size, usually only the few stack sizes
+        // corresponding to the thread_stacksize enumerators are in use.
+        struct stack_bin
+        {
+            std::size_t size = 0;
+            pooled_stack* head = nullptr;
+        };
+
+        constexpr std::size_t num_stack_bins = 8;
+
+        struct alignas(threads::get_cache_line_size()) numa_stack_pool
+        {
+            using mutex_type = hpx::util::detail::spinlock;
+
+            // caller must hold the lock
+            stack_bin* find_bin(std::size_t size, bool create) noexcept
+            {
+                for (stack_bin& bin : bins)
+                {
+                    if (bin.size == size)
+                    {
+                        return &bin;
+                    }
+                    if (create && bin.head == nullptr)
+                    {
+                        // reuse empty bins for other stack sizes
+                        bin.size = size;
+                        return &bin;
+                    }
+                }
+                return nullptr;
+            }
+
+            mutex_type mtx;
+            std::atomic<std::size_t> pooled_bytes{0};    // modified under lock
+            std::array<stack_bin, num_stack_bins> bins;
+        };
+
+        std::array<numa_stack_pool, HPX_HAVE_MAX_NUMA_DOMAIN_COUNT> pools;
+
+        std::atomic<std::int64_t> stack_pool_hits(0);
+        std::atomic<std::int64_t> stack_pool_misses(0);
+        std::atomic<std::int64_t> stack_mapped_bytes(0);
+
+        // HPX worker threads are usually bound to a processing unit, thus
+        // the NUMA domain needs to be determined only once per OS-thread.
+        std::size_t get_numa_domain() noexcept
+        {
+#if defined(__linux) || defined(linux) || defined(__linux__)
+            thread_local std::size_t const domain = []() -> std::size_t {
+                unsigned cpu = 0;
+                unsigned node = 0;
+                if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0 &&
+                    node < HPX_HAVE_MAX_NUMA_DOMAIN_COUNT)
+                {
+                    return node;
+                }
+                return 0;
+            }();
+            return domain;
+#else
+            return 0;
+#endif
+        }
+
+        // Return the NUMA domain the memory of the given stack is local to.
+        // This is the domain of its topmost page, which is touched first when
+        // the stack is set up and which is never given back to the OS. The
+        // stack may be released on a different domain than it was used on.
+        std::size_t get_numa_domain(void* stack, std::size_t size) noexcept
+        {
+#if defined(__linux) || defined(linux) || defined(__linux__)
+            int node = -1;
+            void* top = static_cast<char*>(stack) + size - EXEC_PAGESIZE;
+            if (::syscall(SYS_get_mempolicy, &node, nullptr, 0, top,
+                    MPOL_F_NODE | MPOL_F_ADDR) == 0 &&
+                node >= 0 &&
+                static_cast<std::size_t>(node) < HPX_HAVE_MAX_NUMA_DOMAIN_COUNT)
+            {
+                return static_cast<std::size_t>(node);
+            }
+#endif
+            return get_numa_domain();
+        }
+
+        void* get_from_pool(std::size_t size) noexcept
+        {
+            numa_stack_pool& pool = pools[get_numa_domain()];
+
+            std::lock_guard<numa_stack_pool::mutex_type> l(pool.mtx);
+
+            stack_bin* bin = pool.find_bin(size, false);
+            if (bin == nullptr || bin->head == nullptr)
+            {
+                return nullptr;
+            }
+
+            pooled_stack* p = bin->head;
+            bin->head = p->next;
+            pool.pooled_bytes.store(
+                pool.pooled_bytes.load(std::memory_order_relaxed) - size,
+                std::memory_order_relaxed);
+
+            return get_stack(p, size);
+        }
+
+        bool put_into_pool(void* stack, std::size_t size) noexcept
+        {
+            numa_stack_pool& pool = pools[get_numa_domain(stack, size)];
+
+            // avoid touching the stack memory if the pool is full anyway
+            if (pool.pooled_bytes.load(std::memory_order_relaxed) + size >
+                stack_pool_max_size)
+            {
+                return false;
+            }
+
+            // Stacks are usually reset (and their cold pages released) when
+            // their thread terminates. Stacks which were not reset since they
+            // have grown beyond their topmost page are released here.
+            posix::reset_stack(stack, size);
+
+            pooled_stack* p = get_pooled_stack(stack, size);
+
+            std::lock_guard<numa_stack_pool::mutex_type> l(pool.mtx);
+
+            std::size_t const pooled_bytes =
+                pool.pooled_bytes.load(std::memory_order_relaxed);
+
+            stack_bin* bin = pool.find_bin(size, true);
+            if (bin == nullptr || pooled_bytes + size > stack_pool_max_size)
+            {
+                return false;
+            }
+
+            p->next = bin->head;
+            bin->head = p;
+            pool.pooled_bytes.store(
+                pooled_bytes + size, std::memory_order_relaxed);
+
+            return true;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void release_stack_pages(void* stack, std::size_t size) noexcept
+    {
+#if defined(MADV_FREE)
+        if (use_stack_pool &&
+            ::madvise(stack, size - EXEC_PAGESIZE, MADV_FREE) == 0)
+        {
+            return;
+        }
+        // the kernel might not support MADV_FREE (EINVAL), fall back
+#endif
+        ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* alloc_stack(std::size_t size)
+    {
+        if (use_stack_pool)
+        {
+            if (void* stack = get_from_pool(size); stack != nullptr)
+            {
+                // no need to re-establish the guard page or to fault in the
+                // topmost page again
+                stack_pool_hits.fetch_add(1, std::memory_order_relaxed);
+                return stack;
+            }
+            stack_pool_misses.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void* stack = map_stack(size);
+        stack_mapped_bytes.fetch_add(
+            static_cast<std::int64_t>(size), std::memory_order_relaxed);
+        return stack;
+    }
+
+    void free_stack(void* stack, std::size_t size) noexcept
+    {
+        if (use_stack_pool && put_into_pool(stack, size))
+        {
+            return;
+        }
+
+        unmap_stack(stack, size);
+        stack_mapped_bytes.fetch_sub(
+            static_cast<std::int64_t>(size), std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t get_stack_pool_hit_count(bool reset) noexcept
+    {
+        return util::get_and_reset_value(stack_pool_hits, reset);
+    }
+
+    std::int64_t get_stack_pool_miss_count(bool reset) noexcept
+    {
+        return util::get_and_reset_value(stack_pool_misses, reset);
+    }
+
+    // This is an upper bound of the memory used by the stacks, pages which
+    // were never touched or which were given back to the OS are included.
+    std::int64_t get_stack_mapped_bytes(bool) noexcept
+    {
+        return stack_mapped_bytes.load(std::memory_order_relaxed);
+    }
+#endif
 }    // namespace hpx::threads::coroutines::detail::posix
 
 #endif
@@ -144,6 +144,9 @@ namespace hpx::threads {
         if (size == thread_stacksize::unknown)
             return "unknown";
 
+        if (size == thread_stacksize::automatic)
+            return "automatic";
+
         if (size < thread_stacksize::small_ || size > thread_stacksize::nostack)
             return "custom";
 
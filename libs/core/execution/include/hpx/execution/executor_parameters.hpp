@@ -10,6 +10,7 @@
 
 #include <hpx/execution/executors/adaptive_static_chunk_size.hpp>
 #include <hpx/execution/executors/auto_chunk_size.hpp>
+#include <hpx/execution/executors/autotuned_chunk_size.hpp>
 #include <hpx/execution/executors/dynamic_chunk_size.hpp>
 #include <hpx/execution/executors/guided_chunk_size.hpp>
 #include <hpx/execution/executors/num_cores.hpp>
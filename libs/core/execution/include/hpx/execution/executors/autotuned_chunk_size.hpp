@@ -0,0 +1,232 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/autotuned_chunk_size.hpp
+/// \page hpx::execution::experimental::autotuned_chunk_size
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::execution::experimental {
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        struct autotuner_entry;
+
+        // Return the table entry for the given call site, the size bucket
+        // of the given number of iterations, and the given number of cores.
+        // Entries are never removed, the returned pointer stays valid.
+        HPX_CORE_EXPORT autotuner_entry* get_autotuner_entry(
+            std::string const& name, std::size_t count, std::size_t cores);
+
+        // Select the number of chunks per core to use for the next
+        // invocation, returns the index of the selected candidate.
+        HPX_CORE_EXPORT std::size_t autotuner_select(
+            autotuner_entry* entry, std::size_t exploration_interval);
+
+        // Return the number of chunks per core of the given candidate
+        HPX_CORE_EXPORT std::size_t autotuner_chunks_per_core(
+            std::size_t candidate) noexcept;
+
+        // Record the time per iteration measured for the given candidate
+        HPX_CORE_EXPORT void autotuner_record(autotuner_entry* entry,
+            std::size_t candidate, double ns_per_iteration);
+
+        // State of the measurement of the algorithm invocation currently
+        // in flight. This is shared between all copies of an
+        // autotuned_chunk_size object.
+        struct autotuner_state
+        {
+            // The lower bits count the invocations in flight, the upper bits
+            // hold the id of the invocation owning the measurement (zero if
+            // there is none). An invocation owns the measurement only as long
+            // as it doesn't overlap with any other invocation.
+            std::atomic<std::uint64_t> invocations{0};
+            std::atomic<std::uint64_t> next_id{0};
+
+            // written by the owner of the measurement only
+            std::atomic<autotuner_entry*> entry{nullptr};
+            std::atomic<std::size_t> candidate{0};
+            std::atomic<std::size_t> count{0};
+            std::atomic<std::uint64_t> start{0};
+        };
+
+        // Register the begin of an invocation, claims the measurement if no
+        // other invocation is in flight.
+        HPX_CORE_EXPORT void autotuner_begin_invocation(
+            autotuner_state& state) noexcept;
+
+        // Remember the selected candidate if the measurement is owned by the
+        // (only) invocation in flight.
+        HPX_CORE_EXPORT void autotuner_set_candidate(autotuner_state& state,
+            autotuner_entry* entry, std::size_t candidate,
+            std::size_t count) noexcept;
+
+        // Register the end of an invocation, the owner of the measurement
+        // records the measured time and releases the measurement.
+        HPX_CORE_EXPORT void autotuner_end_invocation(autotuner_state& state);
+        /// \endcond
+    }    // namespace detail
+
+    /// Load the chunk sizes learned by \a autotuned_chunk_size from the
+    /// given file, merging them into the current table.
+    ///
+    /// \returns false if the file could not be read.
+    ///
+    /// \note If the environment variable HPX_CHUNK_SIZE_TABLE is set, the
+    ///       table is loaded from the file it names when it is first used,
+    ///       and written back to that file when the program exits.
+    ///
+    HPX_CORE_EXPORT bool load_chunk_size_table(std::string const& filename);
+
+    /// Write the chunk sizes learned by \a autotuned_chunk_size to the
+    /// given file.
+    ///
+    /// \returns false if the file could not be written.
+    ///
+    HPX_CORE_EXPORT bool save_chunk_size_table(std::string const& filename);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into a number of chunks that is learned
+    /// across invocations. Every call site (identified by a name, for
+    /// instance the one given to \a hpx::annotated_function) and every
+    /// power-of-two bucket of input sizes has its own entry in a process
+    /// wide table. The candidates are 1, 2, 4, ..., 64 chunks per core.
+    /// Each invocation measures the time from the begin to the end of the
+    /// algorithm. Every candidate is tried once, after which the fastest one
+    /// is used. Every \a exploration_interval invocations one of its
+    /// neighbours is measured again, which allows adapting to changing
+    /// conditions.
+    ///
+    /// \note The table can be stored in a file and loaded at startup, see
+    ///       \a load_chunk_size_table and \a save_chunk_size_table.
+    /// \note Only invocations which don't overlap with other invocations
+    ///       through copies of the same object are measured. Concurrent
+    ///       invocations use the learned chunk size without contributing to
+    ///       the measurements.
+    ///
+    struct autotuned_chunk_size
+    {
+        /// Construct an \a autotuned_chunk_size executor parameters object
+        ///
+        /// \param name     [in] The name identifying the call site.
+        /// \param exploration_interval [in] Re-measure a neighbour of the
+        ///                 best candidate every that many invocations
+        ///                 (default: 16). If zero, the best candidate is
+        ///                 always used once all candidates have been tried.
+        ///
+        explicit autotuned_chunk_size(
+            std::string name, std::size_t exploration_interval = 16)
+          : name_(HPX_MOVE(name))
+          , exploration_interval_(exploration_interval)
+          , state_(std::make_shared<detail::autotuner_state>())
+        {
+        }
+
+        /// Return the name identifying the call site
+        [[nodiscard]] std::string const& name() const noexcept
+        {
+            return name_;
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        friend void tag_override_invoke(
+            hpx::parallel::execution::mark_begin_execution_t,
+            autotuned_chunk_size const& this_, Executor&&)
+        {
+            detail::autotuner_begin_invocation(*this_.state_);
+        }
+
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::parallel::execution::get_chunk_size_t,
+            autotuned_chunk_size const& this_, Executor& exec,
+            hpx::chrono::steady_duration const&, std::size_t cores,
+            std::size_t count)
+        {
+            // Make sure the internal round-robin counter of the executor is
+            // reset
+            parallel::execution::reset_thread_distribution(this_, exec);
+
+            cores = (std::max)(cores, static_cast<std::size_t>(1));
+
+            auto* entry =
+                detail::get_autotuner_entry(this_.name_, count, cores);
+            std::size_t const candidate =
+                detail::autotuner_select(entry, this_.exploration_interval_);
+
+            detail::autotuner_set_candidate(
+                *this_.state_, entry, candidate, count);
+
+            std::size_t const num_chunks =
+                cores * detail::autotuner_chunks_per_core(candidate);
+            return (std::max)((count + num_chunks - 1) / num_chunks,
+                static_cast<std::size_t>(1));
+        }
+
+        template <typename Executor>
+        friend void tag_override_invoke(
+            hpx::parallel::execution::mark_end_execution_t,
+            autotuned_chunk_size const& this_, Executor&&)
+        {
+            detail::autotuner_end_invocation(*this_.state_);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        // used by serialization only
+        autotuned_chunk_size()
+          : exploration_interval_(16)
+          , state_(std::make_shared<detail::autotuner_state>())
+        {
+        }
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const /* version */)
+        {
+            // clang-format off
+            ar & name_ & exploration_interval_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::string name_;
+        std::size_t exploration_interval_;
+        std::shared_ptr<detail::autotuner_state> state_;
+        /// \endcond
+    };
+}    // namespace hpx::execution::experimental
+
+/// \cond NOINTERNAL
+template <>
+struct hpx::parallel::execution::is_executor_parameters<
+    hpx::execution::experimental::autotuned_chunk_size> : std::true_type
+{
+};
+/// \endcond
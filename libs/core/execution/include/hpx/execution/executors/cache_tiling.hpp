@@ -0,0 +1,204 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/cache_tiling.hpp
+/// \page hpx::execution::experimental::cache_tiling
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+namespace hpx::execution::experimental {
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // Return the size of the L2 cache of the first core as reported by
+        // the topology, or a conservative default if it is not known.
+        HPX_CORE_EXPORT std::size_t get_tiling_cache_size();
+        /// \endcond
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into tiles whose working set fits into the
+    /// L2 cache of a core. For multi-dimensional loops
+    /// (\a hpx::experimental::for_loop invoked with arrays of bounds) the
+    /// tile shape is chosen such that every tile spans the same number of
+    /// elements in each dimension if possible, while the innermost dimension
+    /// covers whole cache lines. For one-dimensional loops every chunk
+    /// consists of as many iterations as fit into the cache.
+    ///
+    /// The working set of a tile is estimated as the number of its elements
+    /// times the size of an element times the number of arrays accessed by
+    /// the loop body.
+    ///
+    struct cache_tiling
+    {
+        /// Construct a \a cache_tiling executor parameters object
+        ///
+        /// \param element_size [in] The size of the elements accessed by the
+        ///                     loop body (default: sizeof(double)).
+        /// \param num_arrays   [in] The number of arrays accessed by the
+        ///                     loop body (default: 2).
+        /// \param cache_size   [in] The size of the cache the tiles should
+        ///                     fit into. If zero (the default), the size of
+        ///                     the L2 cache as reported by the topology is
+        ///                     used.
+        ///
+        constexpr explicit cache_tiling(
+            std::size_t element_size = sizeof(double),
+            std::size_t num_arrays = 2, std::size_t cache_size = 0) noexcept
+          : element_size_(element_size)
+          , num_arrays_(num_arrays)
+          , cache_size_(cache_size)
+        {
+        }
+
+        /// Return the number of elements a single tile should hold
+        [[nodiscard]] std::size_t get_tile_size() const
+        {
+            std::size_t const cache_size = cache_size_ != 0 ?
+                cache_size_ :
+                detail::get_tiling_cache_size();
+
+            std::size_t const bytes_per_element =
+                (std::max)(element_size_, std::size_t(1)) *
+                (std::max)(num_arrays_, std::size_t(1));
+
+            return (std::max)(cache_size / bytes_per_element, std::size_t(1));
+        }
+
+        /// Return the shape of the tiles for the given extents of a
+        /// multi-dimensional iteration space. The last dimension is assumed
+        /// to be the one which is contiguous in memory.
+        ///
+        /// \param extents  [in] The number of iterations in each dimension.
+        /// \param cores    [in] The number of cores the tiles are going to be
+        ///                 distributed over. The tiles are made smaller if
+        ///                 required to create at least one tile per core.
+        ///
+        template <std::size_t N>
+        [[nodiscard]] std::array<std::size_t, N> get_tile_shape(
+            std::array<std::size_t, N> const& extents,
+            std::size_t cores = 1) const
+        {
+            static_assert(N != 0, "the iteration space must not be empty");
+
+            std::array<std::size_t, N> shape{};
+
+            // distribute the tile size evenly over the dimensions, starting
+            // with the innermost one, budget left over by small dimensions
+            // goes to the outer ones
+            std::size_t remaining = get_tile_size();
+            for (std::size_t d = N; d != 0; --d)
+            {
+                double const exact = std::pow(static_cast<double>(remaining),
+                    1.0 / static_cast<double>(d));
+                auto const side = (std::max)(
+                    static_cast<std::size_t>(exact + 1e-6), std::size_t(1));
+
+                shape[d - 1] = (std::max)(
+                    (std::min)(extents[d - 1], side), std::size_t(1));
+                remaining =
+                    (std::max)(remaining / shape[d - 1], std::size_t(1));
+            }
+
+            // make the innermost dimension a multiple of the cache line size
+            std::size_t const line =
+                (std::max)(hpx::threads::get_cache_line_size() /
+                        (std::max)(element_size_, std::size_t(1)),
+                    std::size_t(1));
+            if (shape[N - 1] < extents[N - 1] && shape[N - 1] > line)
+            {
+                shape[N - 1] -= shape[N - 1] % line;
+            }
+
+            // create enough tiles to keep all cores busy by splitting the
+            // outermost dimensions first
+            auto num_tiles = [&]() {
+                std::size_t count = 1;
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    count *= (extents[d] + shape[d] - 1) / shape[d];
+                }
+                return count;
+            };
+
+            for (std::size_t d = 0; d != N && num_tiles() < cores; /**/)
+            {
+                if (shape[d] == 1)
+                {
+                    ++d;
+                    continue;
+                }
+                shape[d] = (shape[d] + 1) / 2;
+            }
+
+            return shape;
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::parallel::execution::get_chunk_size_t, cache_tiling& this_,
+            Executor& exec, hpx::chrono::steady_duration const&,
+            std::size_t cores, std::size_t num_tasks)
+        {
+            // Make sure the internal round-robin counter of the executor is
+            // reset
+            parallel::execution::reset_thread_distribution(this_, exec);
+
+            // use chunks which fit into the cache, but create at least one
+            // chunk per core
+            cores = (std::max)(cores, std::size_t(1));
+            std::size_t const max_chunk_size = (num_tasks + cores - 1) / cores;
+
+            return (std::max)(
+                (std::min)(this_.get_tile_size(), max_chunk_size),
+                std::size_t(1));
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const /* version */)
+        {
+            // clang-format off
+            ar & element_size_ & num_arrays_ & cache_size_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t element_size_;
+        std::size_t num_arrays_;
+        std::size_t cache_size_;
+        /// \endcond
+    };
+}    // namespace hpx::execution::experimental
+
+/// \cond NOINTERNAL
+template <>
+struct hpx::parallel::execution::is_executor_parameters<
+    hpx::execution::experimental::cache_tiling> : std::true_type
+{
+};
+/// \endcond
@@ -0,0 +1,436 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task_graph.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::execution::experimental {
+
+    class task_graph_executable;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A task_graph records a directed acyclic graph of tasks once, which can
+    /// then be instantiated into a \a task_graph_executable and launched
+    /// repeatedly. This avoids paying for the construction of the dependency
+    /// tree (shared states, continuations, and their allocations) every time
+    /// the same DAG is executed, e.g. once per time step of an iterative
+    /// solver.
+    ///
+    /// The tasks do not pass values to each other, they communicate through
+    /// memory they refer to, which is owned by the application. A task may
+    /// depend only on tasks which have been added to the graph before,
+    /// which guarantees that the recorded graph has no cycles.
+    class task_graph
+    {
+    public:
+        /// Identifies a task in a task graph
+        class node
+        {
+        public:
+            constexpr explicit node(std::size_t index) noexcept
+              : index_(index)
+            {
+            }
+
+            [[nodiscard]] constexpr std::size_t index() const noexcept
+            {
+                return index_;
+            }
+
+        private:
+            std::size_t index_;
+        };
+
+        task_graph() = default;
+
+        /// Add the task \a f to the graph. The task will run after all tasks
+        /// referred to by \a dependencies have finished running.
+        ///
+        /// \returns The node identifying the new task, which can be used to
+        ///          express dependencies of tasks added later.
+        ///
+        /// \throws hpx::exception with error code bad_parameter if one of the
+        ///         dependencies does not refer to a task of this graph.
+        template <typename F,
+            typename Dependencies = std::initializer_list<node>>
+        node add_node(F&& f, Dependencies const& dependencies = {})
+        {
+            std::size_t const index = nodes_.size();
+
+            node_data data{hpx::function<void()>(HPX_FORWARD(F, f)), {}};
+            data.dependencies.reserve(std::size(dependencies));
+            for (node const& dep : dependencies)
+            {
+                if (dep.index() >= index)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "task_graph::add_node",
+                        "a task may depend only on tasks which were added "
+                        "to the same graph before it");
+                }
+                data.dependencies.push_back(dep.index());
+            }
+
+            nodes_.push_back(HPX_MOVE(data));
+            return node(index);
+        }
+
+        /// Add a task which does nothing but joins the given dependencies,
+        /// similar to hpx::when_all.
+        template <typename Dependencies = std::initializer_list<node>>
+        node add_barrier(Dependencies const& dependencies = {})
+        {
+            return add_node([]() {}, dependencies);
+        }
+
+        /// Returns the number of tasks in this graph
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return nodes_.size();
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return nodes_.empty();
+        }
+
+        /// Create an executable graph from the tasks recorded so far. The
+        /// graph can be instantiated more than once, every instance holds
+        /// its own copy of the tasks.
+        [[nodiscard]] task_graph_executable instantiate() const;
+
+    private:
+        friend class task_graph_executable;
+
+        struct node_data
+        {
+            hpx::function<void()> f;
+            std::vector<std::size_t> dependencies;
+        };
+
+        std::vector<node_data> nodes_;
+    };
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // The precomputed and preallocated data needed to launch a task graph
+        struct task_graph_data
+        {
+            struct node_data
+            {
+                hpx::function<void()> f;
+                std::size_t num_dependencies;
+
+                // successors of this node are stored in
+                // successors[first_successor, last_successor)
+                std::size_t first_successor;
+                std::size_t last_successor;
+            };
+
+            explicit task_graph_data(std::size_t num_nodes)
+              : counters(new std::atomic<std::size_t>[num_nodes])
+              , remaining(0)
+              , running(false)
+              , failed(false)
+            {
+                nodes.reserve(num_nodes);
+            }
+
+            // Schedule the task with the given index. Returns false if the
+            // task was not scheduled, either because the graph has failed
+            // already or because the executor threw. In both cases the task
+            // has to be retired by the caller without running it.
+            template <typename Executor>
+            bool post(Executor const& exec, std::size_t index)
+            {
+                if (failed.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+
+                try
+                {
+                    hpx::parallel::execution::post(
+                        exec, [this, exec, index]() { execute(exec, index); });
+                    return true;
+                }
+                catch (...)
+                {
+                    set_exception(std::current_exception());
+                }
+                return false;
+            }
+
+            // Run the task with the given index and all of its successors
+            // which become ready as a result.
+            template <typename Executor>
+            void execute(Executor const& exec, std::size_t index)
+            {
+                // tasks which became ready after the graph has failed, they
+                // are retired on this thread (this allocates only on failure)
+                std::vector<std::size_t> cancelled;
+
+                while (true)
+                {
+                    node_data& n = nodes[index];
+
+                    // skip the remaining tasks after one of them has failed
+                    if (!failed.load(std::memory_order_relaxed))
+                    {
+                        try
+                        {
+                            n.f();
+                        }
+                        catch (...)
+                        {
+                            set_exception(std::current_exception());
+                        }
+                    }
+
+                    // The first successor which becomes ready is run on the
+                    // current thread, any others are scheduled separately.
+                    std::size_t next = static_cast<std::size_t>(-1);
+                    for (std::size_t i = n.first_successor;
+                         i != n.last_successor; ++i)
+                    {
+                        std::size_t const successor = successors[i];
+                        if (counters[successor].fetch_sub(
+                                1, std::memory_order_acq_rel) == 1)
+                        {
+                            if (next == static_cast<std::size_t>(-1))
+                            {
+                                next = successor;
+                            }
+                            else if (!post(exec, successor))
+                            {
+                                cancelled.push_back(successor);
+                            }
+                        }
+                    }
+
+                    if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    {
+                        HPX_ASSERT(next == static_cast<std::size_t>(-1));
+                        HPX_ASSERT(cancelled.empty());
+
+                        // this may release the last reference to this object
+                        finish();
+                        return;
+                    }
+
+                    if (next == static_cast<std::size_t>(-1))
+                    {
+                        if (cancelled.empty())
+                        {
+                            return;
+                        }
+                        next = cancelled.back();
+                        cancelled.pop_back();
+                    }
+                    index = next;
+                }
+            }
+
+            void set_exception(std::exception_ptr e) noexcept
+            {
+                if (!failed.exchange(true))
+                {
+                    exception = HPX_MOVE(e);
+                }
+            }
+
+            void finish()
+            {
+                // move everything out which is needed to signal completion,
+                // the graph can be launched again as soon as running is reset
+                std::shared_ptr<task_graph_data> self = HPX_MOVE(keep_alive);
+                hpx::promise<void> p = HPX_MOVE(promise);
+                std::exception_ptr e = HPX_MOVE(exception);
+                exception = nullptr;
+
+                running.store(false, std::memory_order_release);
+
+                if (e)
+                {
+                    p.set_exception(HPX_MOVE(e));
+                }
+                else
+                {
+                    p.set_value();
+                }
+            }
+
+            std::vector<node_data> nodes;
+            std::vector<std::size_t> successors;
+            std::vector<std::size_t> roots;
+
+            std::unique_ptr<std::atomic<std::size_t>[]> counters;
+            std::atomic<std::size_t> remaining;
+            std::atomic<bool> running;
+            std::atomic<bool> failed;
+
+            hpx::promise<void> promise;
+            std::exception_ptr exception;
+
+            // refers to this object while a launch is in progress, so that
+            // the executable can be destroyed before the launch has finished
+            std::shared_ptr<task_graph_data> keep_alive;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A task_graph_executable is created by instantiating a \a task_graph.
+    /// The dependency counters and successor lists of all tasks are computed
+    /// once, launching the graph only resets the counters and schedules the
+    /// tasks which have no dependencies. No shared states are created for
+    /// the individual tasks, the only allocation per launch is the shared
+    /// state of the returned future.
+    ///
+    /// A graph can be launched again once the future returned from the
+    /// previous launch has become ready. The executable may be destroyed
+    /// before that, a launch keeps the tasks alive until it has finished.
+    class task_graph_executable
+    {
+    public:
+        task_graph_executable() = default;
+
+        explicit task_graph_executable(task_graph const& graph)
+          : data_(std::make_shared<detail::task_graph_data>(graph.size()))
+        {
+            std::size_t const num_nodes = graph.size();
+
+            // count the successors of each node
+            std::vector<std::size_t> num_successors(num_nodes, 0);
+            for (auto const& n : graph.nodes_)
+            {
+                for (std::size_t const dep : n.dependencies)
+                {
+                    ++num_successors[dep];
+                }
+            }
+
+            // lay out the successor lists in one contiguous array
+            std::size_t first = 0;
+            for (std::size_t i = 0; i != num_nodes; ++i)
+            {
+                auto const& n = graph.nodes_[i];
+                data_->nodes.push_back(detail::task_graph_data::node_data{
+                    n.f, n.dependencies.size(), first, first});
+                first += num_successors[i];
+
+                if (n.dependencies.empty())
+                {
+                    data_->roots.push_back(i);
+                }
+            }
+
+            data_->successors.resize(first);
+            for (std::size_t i = 0; i != num_nodes; ++i)
+            {
+                for (std::size_t const dep : graph.nodes_[i].dependencies)
+                {
+                    auto& d = data_->nodes[dep];
+                    data_->successors[d.last_successor++] = i;
+                }
+            }
+        }
+
+        task_graph_executable(task_graph_executable&&) = default;
+        task_graph_executable& operator=(task_graph_executable&&) = default;
+
+        task_graph_executable(task_graph_executable const&) = delete;
+        task_graph_executable& operator=(
+            task_graph_executable const&) = delete;
+
+        /// Returns the number of tasks in this graph
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return data_ ? data_->nodes.size() : 0;
+        }
+
+        /// Execute all tasks of the graph on the given executor.
+        ///
+        /// \returns A future which becomes ready once all tasks have finished
+        ///          running. If any of the tasks threw an exception, the
+        ///          tasks which did not start yet are skipped and the future
+        ///          holds the first exception thrown. If scheduling one of
+        ///          the tasks on \a exec throws, the tasks which were not
+        ///          scheduled yet are skipped and the future holds that
+        ///          exception.
+        ///
+        /// \throws hpx::exception with error code invalid_status if the
+        ///         previous launch of this graph has not finished yet.
+        template <typename Executor>
+        hpx::future<void> launch(Executor&& exec)
+        {
+            if (!data_ || data_->nodes.empty())
+            {
+                return hpx::make_ready_future();
+            }
+
+            if (data_->running.exchange(true, std::memory_order_acquire))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "task_graph_executable::launch",
+                    "the previous launch of this task graph has not finished "
+                    "yet");
+            }
+
+            std::size_t const num_nodes = data_->nodes.size();
+            for (std::size_t i = 0; i != num_nodes; ++i)
+            {
+                data_->counters[i].store(data_->nodes[i].num_dependencies,
+                    std::memory_order_relaxed);
+            }
+            data_->remaining.store(num_nodes, std::memory_order_relaxed);
+            data_->failed.store(false, std::memory_order_relaxed);
+
+            data_->promise = hpx::promise<void>();
+            hpx::future<void> result = data_->promise.get_future();
+            data_->keep_alive = data_;
+
+            std::decay_t<Executor> const& e = exec;
+            for (std::size_t const root : data_->roots)
+            {
+                if (!data_->post(e, root))
+                {
+                    // retire the task without running it
+                    data_->execute(e, root);
+                }
+            }
+
+            return result;
+        }
+
+    private:
+        std::shared_ptr<detail::task_graph_data> data_;
+    };
+
+    inline task_graph_executable task_graph::instantiate() const
+    {
+        return task_graph_executable(*this);
+    }
+}    // namespace hpx::execution::experimental
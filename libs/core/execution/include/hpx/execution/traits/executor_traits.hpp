@@ -31,6 +31,7 @@ namespace hpx::execution {
 
         struct adaptive_static_chunk_size;
         struct auto_chunk_size;
+        struct autotuned_chunk_size;
         struct default_parameters;
         struct dynamic_chunk_size;
         struct guided_chunk_size;
@@ -0,0 +1,381 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/executors/autotuned_chunk_size.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <tuple>
+
+namespace hpx::execution::experimental::detail {
+
+    // candidates are 1, 2, 4, ..., 64 chunks per core
+    inline constexpr std::size_t autotuner_num_candidates = 7;
+
+    struct autotuner_entry
+    {
+        // recompute the fastest candidate, requires mtx to be held
+        void update_best() noexcept
+        {
+            for (std::size_t i = 0; i != autotuner_num_candidates; ++i)
+            {
+                if (samples[i] != 0 &&
+                    (samples[best] == 0 ||
+                        ns_per_iteration[i] < ns_per_iteration[best]))
+                {
+                    best = i;
+                }
+            }
+        }
+
+        hpx::spinlock mtx;
+        std::array<std::uint64_t, autotuner_num_candidates> samples{};
+        std::array<double, autotuner_num_candidates> ns_per_iteration{};
+        std::size_t best = 0;
+        std::uint64_t invocations = 0;
+    };
+
+    namespace {
+
+        std::size_t size_bucket(std::size_t count) noexcept
+        {
+            std::size_t bucket = 0;
+            while (count > 1)
+            {
+                count >>= 1;
+                ++bucket;
+            }
+            return bucket;
+        }
+
+        struct autotuner_key
+        {
+            std::string name;
+            std::size_t bucket;
+            std::size_t cores;
+
+            friend bool operator<(
+                autotuner_key const& lhs, autotuner_key const& rhs) noexcept
+            {
+                return std::tie(lhs.name, lhs.bucket, lhs.cores) <
+                    std::tie(rhs.name, rhs.bucket, rhs.cores);
+            }
+        };
+
+        class autotuner_table
+        {
+        public:
+            autotuner_table()
+            {
+                if (char const* filename = std::getenv("HPX_CHUNK_SIZE_TABLE"))
+                {
+                    filename_ = filename;
+                    load(filename_);
+                }
+            }
+
+            ~autotuner_table()
+            {
+                if (!filename_.empty())
+                {
+                    save(filename_);
+                }
+            }
+
+            autotuner_table(autotuner_table const&) = delete;
+            autotuner_table(autotuner_table&&) = delete;
+            autotuner_table& operator=(autotuner_table const&) = delete;
+            autotuner_table& operator=(autotuner_table&&) = delete;
+
+            autotuner_entry* get(
+                std::string const& name, std::size_t bucket, std::size_t cores)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                auto it =
+                    entries_.try_emplace(autotuner_key{name, bucket, cores})
+                        .first;
+                return &it->second;
+            }
+
+            // Every line holds one measured candidate:
+            //
+            //      <bucket> <cores> <candidate> <samples> <ns> <name>
+            //
+            bool load(std::string const& filename)
+            {
+                std::ifstream in(filename);
+                if (!in)
+                {
+                    return false;
+                }
+
+                std::string line;
+                while (std::getline(in, line))
+                {
+                    if (line.empty() || line[0] == '#')
+                    {
+                        continue;
+                    }
+
+                    std::istringstream is(line);
+                    std::size_t bucket = 0, cores = 0, candidate = 0;
+                    std::uint64_t samples = 0;
+                    double ns = 0.0;
+                    if (!(is >> bucket >> cores >> candidate >> samples >>
+                            ns) ||
+                        candidate >= autotuner_num_candidates || samples == 0)
+                    {
+                        continue;
+                    }
+
+                    std::string name;
+                    is >> std::ws;
+                    std::getline(is, name);
+
+                    autotuner_entry* entry = get(name, bucket, cores);
+
+                    std::lock_guard<hpx::spinlock> l(entry->mtx);
+                    entry->samples[candidate] = samples;
+                    entry->ns_per_iteration[candidate] = ns;
+                    entry->update_best();
+                }
+                return true;
+            }
+
+            bool save(std::string const& filename)
+            {
+                std::ofstream out(filename);
+                if (!out)
+                {
+                    return false;
+                }
+
+                out << "# <bucket> <cores> <candidate> <samples> "
+                       "<ns per iteration> <name>\n";
+
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                for (auto& [key, entry] : entries_)
+                {
+                    std::lock_guard<hpx::spinlock> le(entry.mtx);
+                    for (std::size_t i = 0; i != autotuner_num_candidates; ++i)
+                    {
+                        if (entry.samples[i] != 0)
+                        {
+                            out << key.bucket << ' ' << key.cores << ' ' << i
+                                << ' ' << entry.samples[i] << ' '
+                                << entry.ns_per_iteration[i] << ' ' << key.name
+                                << '\n';
+                        }
+                    }
+                }
+                return static_cast<bool>(out);
+            }
+
+        private:
+            hpx::spinlock mtx_;
+            std::map<autotuner_key, autotuner_entry> entries_;
+            std::string filename_;
+        };
+
+        autotuner_table& get_autotuner_table()
+        {
+            static autotuner_table table;
+            return table;
+        }
+    }    // namespace
+
+    autotuner_entry* get_autotuner_entry(
+        std::string const& name, std::size_t count, std::size_t cores)
+    {
+        return get_autotuner_table().get(name, size_bucket(count), cores);
+    }
+
+    std::size_t autotuner_select(
+        autotuner_entry* entry, std::size_t exploration_interval)
+    {
+        std::lock_guard<hpx::spinlock> l(entry->mtx);
+
+        std::uint64_t const invocation = ++entry->invocations;
+
+        // measure every candidate once
+        for (std::size_t i = 0; i != autotuner_num_candidates; ++i)
+        {
+            if (entry->samples[i] == 0)
+            {
+                return i;
+            }
+        }
+
+        // re-measure the neighbours of the fastest candidate in turns
+        std::size_t const best = entry->best;
+        if (exploration_interval != 0 && invocation % exploration_interval == 0)
+        {
+            bool const upwards = (invocation / exploration_interval) % 2 == 0;
+            if ((upwards || best == 0) &&
+                best + 1 != autotuner_num_candidates)
+            {
+                return best + 1;
+            }
+            if (best != 0)
+            {
+                return best - 1;
+            }
+        }
+        return best;
+    }
+
+    std::size_t autotuner_chunks_per_core(std::size_t candidate) noexcept
+    {
+        return static_cast<std::size_t>(1) << candidate;
+    }
+
+    void autotuner_record(
+        autotuner_entry* entry, std::size_t candidate, double ns_per_iteration)
+    {
+        std::lock_guard<hpx::spinlock> l(entry->mtx);
+
+        // moving average which keeps adapting once enough samples have been
+        // collected
+        std::uint64_t const samples = ++entry->samples[candidate];
+        double const weight =
+            (std::max)(1.0 / static_cast<double>(samples), 0.25);
+
+        double& value = entry->ns_per_iteration[candidate];
+        value += weight * (ns_per_iteration - value);
+
+        entry->update_best();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        constexpr int invocation_count_bits = 16;
+        constexpr std::uint64_t invocation_count_mask =
+            (std::uint64_t(1) << invocation_count_bits) - 1;
+
+        constexpr std::uint64_t get_owner(std::uint64_t value) noexcept
+        {
+            return value >> invocation_count_bits;
+        }
+
+        constexpr std::uint64_t get_count(std::uint64_t value) noexcept
+        {
+            return value & invocation_count_mask;
+        }
+    }    // namespace
+
+    void autotuner_begin_invocation(autotuner_state& state) noexcept
+    {
+        std::uint64_t const id =
+            (state.next_id.fetch_add(1, std::memory_order_relaxed) + 1) &
+            (~std::uint64_t(0) >> invocation_count_bits);
+
+        std::uint64_t current =
+            state.invocations.load(std::memory_order_relaxed);
+        std::uint64_t desired;
+        do
+        {
+            HPX_ASSERT(get_count(current) != invocation_count_mask);
+
+            // the measurement is claimed if no other invocation is in flight,
+            // otherwise the measurement of the current owner (if any) is
+            // invalidated
+            desired = get_count(current) == 0 ?
+                (id << invocation_count_bits) | 1 :
+                get_count(current) + 1;
+        } while (!state.invocations.compare_exchange_weak(
+            current, desired, std::memory_order_acq_rel));
+
+        if (get_owner(desired) != 0)
+        {
+            state.entry.store(nullptr, std::memory_order_relaxed);
+            state.start.store(hpx::chrono::high_resolution_clock::now(),
+                std::memory_order_relaxed);
+        }
+    }
+
+    void autotuner_set_candidate(autotuner_state& state, autotuner_entry* entry,
+        std::size_t candidate, std::size_t count) noexcept
+    {
+        // only the owner of the measurement is in flight
+        std::uint64_t const current =
+            state.invocations.load(std::memory_order_acquire);
+        if (get_owner(current) != 0 && get_count(current) == 1)
+        {
+            state.candidate.store(candidate, std::memory_order_relaxed);
+            state.count.store(count, std::memory_order_relaxed);
+            state.entry.store(entry, std::memory_order_relaxed);
+        }
+    }
+
+    void autotuner_end_invocation(autotuner_state& state)
+    {
+        std::uint64_t current =
+            state.invocations.load(std::memory_order_acquire);
+        while (true)
+        {
+            HPX_ASSERT(get_count(current) != 0);
+
+            if (get_owner(current) != 0 && get_count(current) == 1)
+            {
+                // we are the owner of the measurement, read the results
+                // before releasing it
+                autotuner_entry* entry =
+                    state.entry.load(std::memory_order_relaxed);
+                std::size_t const candidate =
+                    state.candidate.load(std::memory_order_relaxed);
+                std::size_t const count =
+                    state.count.load(std::memory_order_relaxed);
+                std::uint64_t const elapsed =
+                    hpx::chrono::high_resolution_clock::now() -
+                    state.start.load(std::memory_order_relaxed);
+
+                if (state.invocations.compare_exchange_weak(
+                        current, 0, std::memory_order_acq_rel))
+                {
+                    if (entry != nullptr && count != 0)
+                    {
+                        autotuner_record(entry, candidate,
+                            static_cast<double>(elapsed) /
+                                static_cast<double>(count));
+                    }
+                    return;
+                }
+            }
+            else if (state.invocations.compare_exchange_weak(current,
+                         get_count(current) - 1, std::memory_order_acq_rel))
+            {
+                return;
+            }
+        }
+    }
+}    // namespace hpx::execution::experimental::detail
+
+namespace hpx::execution::experimental {
+
+    bool load_chunk_size_table(std::string const& filename)
+    {
+        return detail::get_autotuner_table().load(filename);
+    }
+
+    bool save_chunk_size_table(std::string const& filename)
+    {
+        return detail::get_autotuner_table().save(filename);
+    }
+}    // namespace hpx::execution::experimental
@@ -0,0 +1,27 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/cache_tiling.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <cstddef>
+
+namespace hpx::execution::experimental::detail {
+
+    std::size_t get_tiling_cache_size()
+    {
+        static std::size_t const cache_size = []() -> std::size_t {
+            auto const& topo = hpx::threads::create_topology();
+            std::size_t const size =
+                topo.get_cache_size(topo.get_core_affinity_mask(0), 2);
+
+            // assume 256kB if the size of the L2 cache is not known
+            return size != 0 ? size : std::size_t(256 * 1024);
+        }();
+        return cache_size;
+    }
+}    // namespace hpx::execution::experimental::detail
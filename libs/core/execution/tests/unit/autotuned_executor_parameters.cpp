@@ -0,0 +1,230 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "foreach_tests.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+void test_autotuned_executor_parameters()
+{
+    using iterator_tag = std::random_access_iterator_tag;
+
+    {
+        hpx::execution::experimental::autotuned_chunk_size p("test_for_each");
+        test_for_each(hpx::execution::par.with(p), iterator_tag());
+    }
+
+    {
+        hpx::execution::experimental::autotuned_chunk_size p("test_for_each");
+        test_for_each_async(
+            hpx::execution::par(hpx::execution::task).with(p), iterator_tag());
+    }
+
+    hpx::execution::parallel_executor par_exec;
+
+    {
+        hpx::execution::experimental::autotuned_chunk_size p("test_for_each");
+        test_for_each(
+            hpx::execution::par.on(par_exec).with(std::ref(p)), iterator_tag());
+    }
+
+    {
+        hpx::execution::experimental::autotuned_chunk_size p("test_for_each");
+        test_for_each_async(hpx::execution::par(hpx::execution::task)
+                                .on(par_exec)
+                                .with(std::ref(p)),
+            iterator_tag());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_autotuned_chunk_size()
+{
+    hpx::execution::parallel_executor exec;
+    hpx::execution::experimental::autotuned_chunk_size p("test_chunk_size");
+
+    for (std::size_t count : {1, 7, 100, 10007})
+    {
+        std::size_t const chunk_size =
+            hpx::parallel::execution::get_chunk_size(p, exec, 4, count);
+        HPX_TEST_LTE(std::size_t(1), chunk_size);
+        HPX_TEST_LTE(chunk_size, count);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_autotuned_table()
+{
+    std::string const name = "test_autotuned_table";
+    std::string const filename = "autotuned_executor_parameters.table";
+
+    std::vector<int> v(10000);
+    hpx::execution::experimental::autotuned_chunk_size p(name);
+    for (int i = 0; i != 64; ++i)
+    {
+        hpx::for_each(hpx::execution::par.with(p), v.begin(), v.end(),
+            [](int& val) { ++val; });
+    }
+
+    for (int const val : v)
+    {
+        HPX_TEST_EQ(val, 64);
+    }
+
+    HPX_TEST(hpx::execution::experimental::save_chunk_size_table(filename));
+
+    // every candidate has been measured at least once
+    {
+        std::ifstream in(filename);
+        HPX_TEST(static_cast<bool>(in));
+
+        std::set<std::size_t> candidates;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (line.empty() || line[0] == '#' ||
+                line.find(name) == std::string::npos)
+            {
+                continue;
+            }
+
+            std::istringstream is(line);
+            std::size_t bucket = 0, cores = 0, candidate = 0;
+            is >> bucket >> cores >> candidate;
+            HPX_TEST_EQ(bucket, std::size_t(13));
+            candidates.insert(candidate);
+        }
+        HPX_TEST_EQ(candidates.size(), std::size_t(7));
+    }
+
+    HPX_TEST(hpx::execution::experimental::load_chunk_size_table(filename));
+    HPX_TEST(!hpx::execution::experimental::load_chunk_size_table(
+        "does-not-exist/autotuned_executor_parameters.table"));
+
+    std::remove(filename.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// concurrent invocations share the measurement state of the same object
+void test_autotuned_concurrent()
+{
+    hpx::execution::experimental::autotuned_chunk_size p(
+        "test_autotuned_concurrent");
+
+    constexpr int num_tasks = 8;
+    constexpr int num_iterations = 32;
+
+    std::vector<std::vector<int>> values(num_tasks, std::vector<int>(1000));
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    for (int t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&p, &v = values[t], t]() {
+            for (int i = 0; i != num_iterations; ++i)
+            {
+                if (t % 2 == 0)
+                {
+                    hpx::for_each(hpx::execution::par.with(std::ref(p)),
+                        v.begin(), v.end(), [](int& val) { ++val; });
+                }
+                else
+                {
+                    hpx::for_each(hpx::execution::par(hpx::execution::task)
+                                      .with(p),
+                        v.begin(), v.end(), [](int& val) { ++val; })
+                        .get();
+                }
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    for (auto const& v : values)
+    {
+        for (int const val : v)
+        {
+            HPX_TEST_EQ(val, num_iterations);
+        }
+    }
+
+    // the measurement has been released by its owner, sequential invocations
+    // measure all candidates
+    std::vector<int> v(5000);
+    for (int i = 0; i != 7; ++i)
+    {
+        hpx::for_each(hpx::execution::par.with(p), v.begin(), v.end(),
+            [](int& val) { ++val; });
+    }
+
+    std::string const filename = "autotuned_concurrent.table";
+    HPX_TEST(hpx::execution::experimental::save_chunk_size_table(filename));
+
+    std::set<std::size_t> candidates;
+    {
+        std::ifstream in(filename);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (line.find("test_autotuned_concurrent") == std::string::npos)
+            {
+                continue;
+            }
+
+            std::istringstream is(line);
+            std::size_t bucket = 0, cores = 0, candidate = 0;
+            is >> bucket >> cores >> candidate;
+            if (bucket == 12)
+            {
+                candidates.insert(candidate);
+            }
+        }
+    }
+    HPX_TEST_EQ(candidates.size(), std::size_t(7));
+
+    std::remove(filename.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_autotuned_executor_parameters();
+    test_autotuned_chunk_size();
+    test_autotuned_table();
+    test_autotuned_concurrent();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
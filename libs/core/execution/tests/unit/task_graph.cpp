@@ -0,0 +1,301 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_empty()
+{
+    ex::task_graph g;
+    HPX_TEST(g.empty());
+
+    ex::task_graph_executable e = g.instantiate();
+    HPX_TEST_EQ(e.size(), std::size_t(0));
+
+    hpx::future<void> f = e.launch(hpx::execution::par.executor());
+    HPX_TEST(f.is_ready());
+    f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// diamond shaped graph, launched repeatedly
+void test_ordering()
+{
+    std::atomic<int> a(0), b(0), c(0), d(0);
+    std::atomic<int> ordering_errors(0);
+
+    ex::task_graph g;
+    auto na = g.add_node([&]() { ++a; });
+    auto nb = g.add_node(
+        [&]() {
+            if (b.load() + 1 != a.load())
+                ++ordering_errors;
+            ++b;
+        },
+        {na});
+    auto nc = g.add_node(
+        [&]() {
+            if (c.load() + 1 != a.load())
+                ++ordering_errors;
+            ++c;
+        },
+        {na});
+    g.add_node(
+        [&]() {
+            if (d.load() + 1 != b.load() || d.load() + 1 != c.load())
+                ++ordering_errors;
+            ++d;
+        },
+        {nb, nc});
+
+    HPX_TEST_EQ(g.size(), std::size_t(4));
+
+    ex::task_graph_executable e = g.instantiate();
+    for (int i = 0; i != 100; ++i)
+    {
+        e.launch(hpx::execution::par.executor()).get();
+    }
+
+    HPX_TEST_EQ(a.load(), 100);
+    HPX_TEST_EQ(b.load(), 100);
+    HPX_TEST_EQ(c.load(), 100);
+    HPX_TEST_EQ(d.load(), 100);
+    HPX_TEST_EQ(ordering_errors.load(), 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// layered graph where every task depends on all tasks of the previous layer
+void test_layers()
+{
+    constexpr std::size_t num_layers = 10;
+    constexpr std::size_t width = 16;
+
+    std::vector<std::atomic<std::size_t>> done(num_layers);
+    for (auto& v : done)
+        v.store(0);
+    std::atomic<int> ordering_errors(0);
+
+    ex::task_graph g;
+    std::vector<ex::task_graph::node> previous;
+    for (std::size_t layer = 0; layer != num_layers; ++layer)
+    {
+        std::vector<ex::task_graph::node> current;
+        for (std::size_t i = 0; i != width; ++i)
+        {
+            current.push_back(g.add_node(
+                [&, layer]() {
+                    if (layer != 0 && done[layer - 1].load() % width != 0)
+                        ++ordering_errors;
+                    ++done[layer];
+                },
+                previous));
+        }
+        previous = current;
+    }
+    g.add_barrier(previous);
+
+    ex::task_graph_executable e = g.instantiate();
+    for (int i = 0; i != 10; ++i)
+    {
+        e.launch(hpx::execution::par.executor()).get();
+    }
+
+    for (auto const& v : done)
+    {
+        HPX_TEST_EQ(v.load(), 10 * width);
+    }
+    HPX_TEST_EQ(ordering_errors.load(), 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_exception()
+{
+    std::atomic<int> executed(0);
+
+    ex::task_graph g;
+    auto n1 = g.add_node([]() { throw std::runtime_error("error"); });
+    g.add_node([&]() { ++executed; }, {n1});
+
+    ex::task_graph_executable e = g.instantiate();
+    for (int i = 0; i != 2; ++i)
+    {
+        bool caught_exception = false;
+        try
+        {
+            e.launch(hpx::execution::par.executor()).get();
+            HPX_TEST(false);
+        }
+        catch (std::runtime_error const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+    HPX_TEST_EQ(executed.load(), 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// executor which fails to schedule any tasks once its budget is exhausted
+struct failing_executor
+{
+    explicit failing_executor(int budget)
+      : budget(std::make_shared<std::atomic<int>>(budget))
+    {
+    }
+
+    bool operator==(failing_executor const& rhs) const noexcept
+    {
+        return budget == rhs.budget;
+    }
+
+    bool operator!=(failing_executor const& rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    failing_executor const& context() const noexcept
+    {
+        return *this;
+    }
+
+    template <typename F, typename... Ts>
+    friend void tag_invoke(hpx::parallel::execution::post_t,
+        failing_executor const& exec, F&& f, Ts&&... ts)
+    {
+        if (exec.budget->fetch_sub(1) <= 0)
+        {
+            throw std::runtime_error("post failed");
+        }
+        hpx::post(std::forward<F>(f), std::forward<Ts>(ts)...);
+    }
+
+    std::shared_ptr<std::atomic<int>> budget;
+};
+
+namespace hpx::parallel::execution {
+    template <>
+    struct is_one_way_executor<failing_executor> : std::true_type
+    {
+    };
+}    // namespace hpx::parallel::execution
+
+void test_post_exception()
+{
+    constexpr int num_roots = 8;
+    std::atomic<int> executed(0);
+
+    ex::task_graph g;
+    std::vector<ex::task_graph::node> roots;
+    for (int i = 0; i != num_roots; ++i)
+    {
+        roots.push_back(g.add_node([&]() { ++executed; }));
+    }
+    g.add_node([&]() { ++executed; }, roots);
+
+    ex::task_graph_executable e = g.instantiate();
+    for (int budget : {0, 1, num_roots / 2})
+    {
+        executed = 0;
+
+        bool caught_exception = false;
+        try
+        {
+            e.launch(failing_executor(budget)).get();
+            HPX_TEST(false);
+        }
+        catch (std::runtime_error const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+        HPX_TEST_LTE(executed.load(), budget);
+    }
+
+    // the graph can be launched again after scheduling has failed
+    executed = 0;
+    e.launch(hpx::execution::par.executor()).get();
+    HPX_TEST_EQ(executed.load(), num_roots + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the executable may be destroyed while it is running
+void test_destroy_while_running()
+{
+    std::atomic<bool> release(false);
+    std::atomic<int> executed(0);
+
+    ex::task_graph g;
+    auto n = g.add_node([&]() {
+        while (!release.load())
+        {
+            hpx::this_thread::yield();
+        }
+        ++executed;
+    });
+    g.add_node([&]() { ++executed; }, {n});
+
+    hpx::future<void> f;
+    {
+        ex::task_graph_executable e = g.instantiate();
+        f = e.launch(hpx::execution::par.executor());
+    }
+
+    release = true;
+    f.get();
+    HPX_TEST_EQ(executed.load(), 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_invalid_dependency()
+{
+    ex::task_graph g;
+    bool caught_exception = false;
+    try
+    {
+        g.add_node([]() {}, {ex::task_graph::node(0)});
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST(g.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_empty();
+    test_ordering();
+    test_layers();
+    test_exception();
+    test_post_exception();
+    test_destroy_while_running();
+    test_invalid_dependency();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,147 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file bulk_team.hpp
+/// \page hpx::execution::experimental::bulk_team
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/detail/contiguous_index_queue.hpp>
+#include <hpx/threading_base/detail/get_default_pool.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx::execution::experimental {
+
+    /// A team of HPX threads which is kept alive for the lifetime of the
+    /// team object and which executes the bulk operations of the
+    /// thread_pool_schedulers it has been attached to (see
+    /// \a with_bulk_team). This avoids creating new HPX threads for each
+    /// bulk operation, which pays off for short bulk operations that are
+    /// executed repeatedly.
+    ///
+    /// The chunks of a bulk operation are distributed evenly across the team
+    /// members. Every member processes its own range front to back by
+    /// atomically advancing the begin of the range. Once its own range is
+    /// exhausted, a member steals the back half of the range of another
+    /// member. The thread starting the bulk operation participates by
+    /// stealing only, which allows for starting bulk operations from any
+    /// thread.
+    ///
+    /// The team executes one bulk operation at a time. Bulk operations
+    /// started while the team is busy (for instance nested ones) are executed
+    /// by spawning new HPX threads, as without a team.
+    ///
+    /// \note The team members wait for new work by spinning, meaning other
+    ///       work will not be executed on the cores of the team while it is
+    ///       waiting. The team yields to other work after the given delay.
+    ///       The team object has to outlive all schedulers it is attached to
+    ///       and it must not be destroyed while executing a bulk operation.
+    class HPX_CORE_EXPORT bulk_team
+    {
+    public:
+        /// \cond NOINTERNAL
+        // The function invoked for every chunk, it is not allowed to throw
+        using chunk_function_type = void(void*, std::uint32_t) noexcept;
+        /// \endcond
+
+        /// \brief Construct a bulk_team.
+        ///
+        /// \param pool The thread pool to run the team members on.
+        /// \param first_core The first worker thread of the pool to use.
+        /// \param num_threads The number of team members, one per worker
+        ///        thread, zero uses all worker threads starting at
+        ///        \a first_core.
+        /// \param yield_delay The time after which the team yields to other
+        ///        work if it has not received any new work for execution.
+        explicit bulk_team(
+            threads::thread_pool_base* pool =
+                threads::detail::get_self_or_default_pool(),
+            std::size_t first_core = 0, std::size_t num_threads = 0,
+            std::chrono::nanoseconds yield_delay =
+                std::chrono::milliseconds(1));
+
+        bulk_team(bulk_team const&) = delete;
+        bulk_team(bulk_team&&) = delete;
+        bulk_team& operator=(bulk_team const&) = delete;
+        bulk_team& operator=(bulk_team&&) = delete;
+
+        ~bulk_team();
+
+        /// \cond NOINTERNAL
+        // Execute f(data, i) for all i in [0, num_chunks) on the team. The
+        // calling thread participates and returns once all chunks have been
+        // executed. Returns false without executing anything if the team is
+        // busy with another bulk operation, the caller has to fall back to
+        // other means of executing the chunks.
+        bool try_run(std::uint32_t num_chunks, chunk_function_type* f,
+            void* data, bool allow_stealing = true);
+        /// \endcond
+
+        /// Return the number of team members
+        [[nodiscard]] std::size_t get_num_threads() const noexcept
+        {
+            return num_threads_;
+        }
+
+        /// Return the thread pool the team members run on
+        [[nodiscard]] threads::thread_pool_base* get_thread_pool()
+            const noexcept
+        {
+            return pool_;
+        }
+
+    private:
+        /// \cond NOINTERNAL
+        using queue_type =
+            hpx::concurrency::detail::contiguous_index_queue<std::uint32_t>;
+
+        void thread_function(std::size_t thread_index) noexcept;
+        void do_work(std::size_t thread_index) noexcept;
+
+        template <typename Pred>
+        void wait_while(Pred&& pred) const noexcept;
+
+        threads::thread_pool_base* pool_;
+        std::size_t first_core_;
+        std::size_t num_threads_;
+        std::uint64_t yield_delay_;
+
+        // Even values identify the current bulk operation, odd values mark
+        // one being set up.
+        hpx::util::cache_line_data<std::atomic<std::uint64_t>> epoch_;
+
+        // number of team members currently looking at the data of the
+        // current bulk operation
+        hpx::util::cache_line_data<std::atomic<std::size_t>> active_;
+
+        // number of chunks of the current bulk operation not finished yet
+        hpx::util::cache_line_data<std::atomic<std::uint32_t>> remaining_;
+
+        // number of team members still running
+        std::atomic<std::size_t> running_;
+        std::atomic<bool> stop_;
+        std::atomic<bool> busy_;
+
+        // data of the current bulk operation
+        chunk_function_type* f_ = nullptr;
+        void* data_ = nullptr;
+        bool allow_stealing_ = true;
+
+        // one queue per team member, and one for the thread that started the
+        // current bulk operation
+        std::vector<hpx::util::cache_aligned_data<queue_type>> queues_;
+        /// \endcond
+    };
+}    // namespace hpx::execution::experimental
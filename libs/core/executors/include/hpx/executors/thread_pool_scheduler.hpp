@@ -32,6 +32,8 @@
 
 namespace hpx::execution::experimental {
 
+    class bulk_team;
+
     namespace detail {
 
         template <typename Policy>
@@ -83,7 +85,8 @@ namespace hpx::execution::experimental {
             thread_pool_policy_scheduler const& lhs,
             thread_pool_policy_scheduler const& rhs) noexcept
         {
-            return lhs.pool_ == rhs.pool_ && lhs.policy_ == rhs.policy_;
+            return lhs.pool_ == rhs.pool_ && lhs.policy_ == rhs.policy_ &&
+                lhs.team_ == rhs.team_;
         }
 
         friend constexpr bool operator!=(
@@ -358,6 +361,18 @@ namespace hpx::execution::experimental {
         {
             return policy_;
         }
+
+        // The persistent team executing bulk operations, if any (see
+        // with_bulk_team)
+        constexpr void team(bulk_team* team) noexcept
+        {
+            team_ = team;
+        }
+
+        constexpr bulk_team* team() const noexcept
+        {
+            return team_;
+        }
         /// \endcond
 
     private:
@@ -402,6 +417,7 @@ namespace hpx::execution::experimental {
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
         char const* annotation_ = nullptr;
 #endif
+        bulk_team* team_ = nullptr;
         /// \endcond
     };
 
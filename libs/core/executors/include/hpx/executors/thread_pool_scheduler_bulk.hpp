@@ -23,6 +23,7 @@
 #include <hpx/execution_base/completion_signatures.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
+#include <hpx/executors/bulk_team.hpp>
 #include <hpx/executors/thread_pool_scheduler.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/detail/tag_fallback_invoke.hpp>
@@ -70,6 +71,32 @@ namespace hpx::execution::experimental::detail {
         HPX_INVOKE(HPX_FORWARD(F, f), HPX_FORWARD(T, t), hpx::get<Is>(ts)...);
     }
 
+    // Perform the work in one chunk indexed by index. The index represents a
+    // range of indices (iterators) in the given shape.
+    template <typename OperationState, typename Ts>
+    void bulk_scheduler_do_work_chunk(OperationState* op_state, Ts& ts,
+        std::size_t const size, std::uint32_t const chunk_size,
+        std::uint32_t const index)
+    {
+#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
+        static hpx::util::itt::event notify_event(
+            "set_value_loop_visitor_static::do_work_chunk(chunking)");
+
+        hpx::util::itt::mark_event e(notify_event);
+#endif
+        using index_pack_type = hpx::detail::fused_index_pack_t<Ts>;
+
+        auto const i_begin = static_cast<std::size_t>(index) * chunk_size;
+        auto const i_end = (std::min)(i_begin + chunk_size, size);
+
+        auto it = std::next(hpx::util::begin(op_state->shape), i_begin);
+        for (std::uint32_t i = i_begin; i != i_end; (void) ++it, ++i)
+        {
+            bulk_scheduler_invoke_helper(
+                index_pack_type{}, op_state->f, *it, ts);
+        }
+    }
+
     inline hpx::threads::mask_type full_mask(
         std::size_t first_thread, std::size_t num_threads)
     {
@@ -131,25 +158,8 @@ namespace hpx::execution::experimental::detail {
         template <typename Ts>
         void do_work_chunk(Ts& ts, std::uint32_t const index) const
         {
-#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
-            static hpx::util::itt::event notify_event(
-                "set_value_loop_visitor_static::do_work_chunk(chunking)");
-
-            hpx::util::itt::mark_event e(notify_event);
-#endif
-            using index_pack_type = hpx::detail::fused_index_pack_t<Ts>;
-
-            auto const i_begin =
-                static_cast<std::size_t>(index) * task_f->chunk_size;
-            auto const i_end =
-                (std::min)(i_begin + task_f->chunk_size, task_f->size);
-
-            auto it = std::next(hpx::util::begin(op_state->shape), i_begin);
-            for (std::uint32_t i = i_begin; i != i_end; (void) ++it, ++i)
-            {
-                bulk_scheduler_invoke_helper(
-                    index_pack_type{}, op_state->f, *it, ts);
-            }
+            bulk_scheduler_do_work_chunk(
+                op_state, ts, task_f->size, task_f->chunk_size, index);
         }
 
         template <hpx::concurrency::detail::queue_end Which, typename Ts>
@@ -330,6 +340,69 @@ namespace hpx::execution::experimental::detail {
         }
     };
 
+    template <typename OperationState>
+    struct team_task_function;
+
+    template <typename OperationState>
+    struct set_value_team_visitor
+    {
+        team_task_function<OperationState> const* const task_f;
+        std::uint32_t const index;
+
+        [[noreturn]] void operator()(hpx::monostate) const noexcept
+        {
+            HPX_UNREACHABLE;
+        }
+
+        // Visit the values sent from the predecessor sender. This function
+        // handles the chunk given by index.
+        //
+        // clang-format off
+        template <typename Ts,
+            HPX_CONCEPT_REQUIRES_(
+                !std::is_same_v<std::decay_t<Ts>, hpx::monostate>
+            )>
+        // clang-format on
+        void operator()(Ts& ts) const
+        {
+            bulk_scheduler_do_work_chunk(task_f->op_state, ts, task_f->size,
+                task_f->chunk_size, index);
+        }
+    };
+
+    // This struct encapsulates the work done for one chunk if the chunks are
+    // executed by the bulk_team attached to the scheduler.
+    template <typename OperationState>
+    struct team_task_function
+    {
+        OperationState* const op_state;
+        std::size_t const size;
+        std::uint32_t const chunk_size;
+
+        // Entry point for the team members, invoked for every chunk.
+        // Exceptions are stored in the operation state.
+        static void call(void* data, std::uint32_t const index) noexcept
+        {
+            auto const* task_f = static_cast<team_task_function const*>(data);
+            OperationState* op_state = task_f->op_state;
+            try
+            {
+                auto visitor =
+                    set_value_team_visitor<OperationState>{task_f, index};
+                hpx::visit(HPX_MOVE(visitor), op_state->ts);
+            }
+            catch (std::bad_alloc const&)
+            {
+                op_state->bad_alloc_thrown = true;
+            }
+            catch (...)
+            {
+                // NOLINTNEXTLINE(bugprone-throw-keyword-missing)
+                op_state->exceptions.add(std::current_exception());
+            }
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////
     template <typename OperationState, typename F, typename Shape>
     struct bulk_receiver
@@ -452,6 +525,45 @@ namespace hpx::execution::experimental::detail {
                 return;
             }
 
+            // Store sent values in the operation state
+            op_state->ts.template emplace<hpx::tuple<Ts...>>(
+                HPX_FORWARD(Ts, ts)...);
+
+            // Execute the chunks on the team attached to the scheduler, if
+            // any. If the team is busy with another bulk operation, we fall
+            // back to spawning tasks below.
+            if (bulk_team* team = op_state->scheduler.team())
+            {
+                std::uint32_t const team_chunk_size =
+                    get_bulk_scheduler_chunk_size(
+                        static_cast<std::uint32_t>(team->get_num_threads()),
+                        size);
+                std::uint32_t const team_num_chunks =
+                    (size + team_chunk_size - 1) / team_chunk_size;
+
+                bool const allow_stealing =
+                    !hpx::threads::do_not_share_function(
+                        hpx::execution::experimental::get_hint(
+                            op_state->scheduler)
+                            .sharing_mode());
+
+                team_task_function<OperationState> team_f{
+                    op_state, size, team_chunk_size};
+                if (team->try_run(team_num_chunks,
+                        &team_task_function<OperationState>::call, &team_f,
+                        allow_stealing))
+                {
+                    // all chunks have been executed, the calling thread is
+                    // the only one left to signal the receiver
+                    op_state->tasks_remaining.data_.store(
+                        1, std::memory_order_relaxed);
+                    task_function<OperationState>{op_state, size,
+                        team_chunk_size, 0, false, false}
+                        .finish();
+                    return;
+                }
+            }
+
             // Calculate chunk size and number of chunks
             std::uint32_t chunk_size = get_bulk_scheduler_chunk_size(
                 op_state->num_worker_threads, size);
@@ -471,10 +583,6 @@ namespace hpx::execution::experimental::detail {
             HPX_ASSERT(hpx::threads::count(op_state->pu_mask) ==
                 op_state->num_worker_threads);
 
-            // Store sent values in the operation state
-            op_state->ts.template emplace<hpx::tuple<Ts...>>(
-                HPX_FORWARD(Ts, ts)...);
-
             // thread placement
             hpx::threads::thread_schedule_hint const hint =
                 hpx::execution::experimental::get_hint(op_state->scheduler);
@@ -611,6 +719,9 @@ namespace hpx::execution::experimental::detail {
     // in this file is not chosen) it will be reused as one of the worker
     // threads.
     //
+    // If a bulk_team is attached to the scheduler, the chunks are executed by
+    // the team members instead, no HPX threads are spawned in this case.
+    //
     template <typename Policy, typename Sender, typename Shape, typename F>
     class thread_pool_bulk_sender
     {
@@ -786,6 +897,19 @@ namespace hpx::execution::experimental::detail {
 
 namespace hpx::execution::experimental {
 
+    /// Return a copy of the given scheduler which executes bulk operations on
+    /// the given team of HPX threads instead of spawning new HPX threads for
+    /// each of them (see \a bulk_team). The team has to outlive the returned
+    /// scheduler and all of its copies.
+    template <typename Policy>
+    constexpr thread_pool_policy_scheduler<Policy> with_bulk_team(
+        thread_pool_policy_scheduler<Policy> scheduler,
+        bulk_team& team) noexcept
+    {
+        scheduler.team(&team);
+        return scheduler;
+    }
+
     // clang-format off
     template <typename Policy, typename Sender, typename Shape, typename F,
         HPX_CONCEPT_REQUIRES_(
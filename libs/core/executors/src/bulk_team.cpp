@@ -0,0 +1,249 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/execution/detail/post_policy_dispatch.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/executors/bulk_team.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/hardware.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace hpx::execution::experimental {
+
+    bulk_team::bulk_team(threads::thread_pool_base* pool,
+        std::size_t first_core, std::size_t num_threads,
+        std::chrono::nanoseconds yield_delay)
+      : pool_(pool)
+      , first_core_(first_core)
+      , num_threads_(num_threads)
+      , yield_delay_(0)
+      , running_(0)
+      , stop_(false)
+      , busy_(false)
+    {
+        if (pool_ != nullptr && num_threads_ == 0 &&
+            first_core_ < pool_->get_os_thread_count())
+        {
+            num_threads_ = pool_->get_os_thread_count() - first_core_;
+        }
+
+        if (pool_ == nullptr || num_threads_ == 0 ||
+            first_core_ + num_threads_ > pool_->get_os_thread_count())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "bulk_team::bulk_team",
+                "unexpected number of threads for the team: {} (first core: "
+                "{}), available threads: {}",
+                num_threads, first_core,
+                pool_ ? pool_->get_os_thread_count() : 0);
+        }
+
+        yield_delay_ = static_cast<std::uint64_t>(
+            static_cast<double>(yield_delay.count()) /
+            pool_->timestamp_scale());
+
+        queues_.resize(num_threads_ + 1);
+        running_.store(num_threads_, std::memory_order_relaxed);
+        epoch_.data_.store(0, std::memory_order_relaxed);
+        active_.data_.store(0, std::memory_order_relaxed);
+        remaining_.data_.store(0, std::memory_order_relaxed);
+
+        for (std::size_t t = 0; t != num_threads_; ++t)
+        {
+            auto const policy = launch::async_policy(
+                threads::thread_priority::bound,
+                threads::thread_stacksize::small_,
+                threads::thread_schedule_hint{
+                    static_cast<std::int16_t>(first_core_ + t)});
+
+            hpx::threads::thread_description desc(
+                hpx::util::format("bulk_team: thread ({})", first_core_ + t));
+
+            hpx::detail::post_policy_dispatch<launch::async_policy>::call(
+                policy, desc, pool_,
+                [this, t]() noexcept { thread_function(t); });
+        }
+    }
+
+    bulk_team::~bulk_team()
+    {
+        HPX_ASSERT(!busy_.load(std::memory_order_relaxed));
+
+        stop_.store(true, std::memory_order_release);
+        hpx::util::yield_while([this]() {
+            return running_.load(std::memory_order_acquire) != 0;
+        });
+    }
+
+    template <typename Pred>
+    void bulk_team::wait_while(Pred&& pred) const noexcept
+    {
+        if (HPX_LIKELY(!pred()))
+        {
+            return;
+        }
+
+        std::uint64_t const base_time = util::hardware::timestamp();
+        while (pred())
+        {
+            for (int i = 0; i < 128; ++i)
+            {
+                HPX_SMT_PAUSE;
+                if (!pred())
+                {
+                    return;
+                }
+            }
+
+            if ((util::hardware::timestamp() - base_time) > yield_delay_)
+            {
+                hpx::execution_base::this_thread::yield();
+            }
+        }
+    }
+
+    void bulk_team::do_work(std::size_t thread_index) noexcept
+    {
+        std::size_t const num_queues = queues_.size();
+        queue_type& queue = queues_[thread_index].data_;
+
+        while (true)
+        {
+            hpx::optional<std::uint32_t> index;
+            while ((index = queue.pop_left()))
+            {
+                f_(data_, *index);
+                remaining_.data_.fetch_sub(1, std::memory_order_acq_rel);
+            }
+
+            if (!allow_stealing_)
+            {
+                return;
+            }
+
+            // Take over the back half of the range of another queue. This
+            // queue is empty at this point and only this thread adds to it,
+            // other threads will see either the empty or the new range.
+            bool stolen = false;
+            for (std::size_t offset = 1; offset != num_queues; ++offset)
+            {
+                auto range =
+                    queues_[(thread_index + offset) % num_queues]
+                        .data_.pop_right_half();
+                if (range)
+                {
+                    queue.reset(range->first, range->second);
+                    stolen = true;
+                    break;
+                }
+            }
+
+            if (!stolen)
+            {
+                return;
+            }
+        }
+    }
+
+    void bulk_team::thread_function(std::size_t thread_index) noexcept
+    {
+        std::uint64_t seen = 0;
+        while (true)
+        {
+            // wait for the next bulk operation to be published
+            wait_while([&]() {
+                std::uint64_t const epoch =
+                    epoch_.data_.load(std::memory_order_acquire);
+                return (epoch == seen || (epoch & 1) != 0) &&
+                    !stop_.load(std::memory_order_relaxed);
+            });
+
+            if (stop_.load(std::memory_order_acquire))
+            {
+                break;
+            }
+
+            // Announce that the data of the bulk operation is being accessed
+            // before checking that it is still current, see try_run.
+            active_.data_.fetch_add(1, std::memory_order_seq_cst);
+
+            std::uint64_t const epoch =
+                epoch_.data_.load(std::memory_order_seq_cst);
+            if (epoch != seen && (epoch & 1) == 0)
+            {
+                seen = epoch;
+                do_work(thread_index);
+            }
+
+            active_.data_.fetch_sub(1, std::memory_order_release);
+        }
+
+        running_.fetch_sub(1, std::memory_order_release);
+    }
+
+    bool bulk_team::try_run(std::uint32_t num_chunks, chunk_function_type* f,
+        void* data, bool allow_stealing)
+    {
+        if (num_chunks == 0)
+        {
+            return true;
+        }
+
+        bool expected = false;
+        if (!busy_.compare_exchange_strong(
+                expected, true, std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        // Mark the data as being modified and wait for the team members
+        // which may still look at the data of the previous bulk operation.
+        // Team members increment active_ before checking the epoch, thus
+        // either they see the odd epoch or we see their increment.
+        epoch_.data_.fetch_add(1, std::memory_order_seq_cst);
+        wait_while([this]() {
+            return active_.data_.load(std::memory_order_seq_cst) != 0;
+        });
+
+        f_ = f;
+        data_ = data;
+        allow_stealing_ = allow_stealing;
+        remaining_.data_.store(num_chunks, std::memory_order_relaxed);
+
+        for (std::size_t t = 0; t != num_threads_; ++t)
+        {
+            queues_[t].data_.reset(
+                static_cast<std::uint32_t>((t * num_chunks) / num_threads_),
+                static_cast<std::uint32_t>(
+                    ((t + 1) * num_chunks) / num_threads_));
+        }
+        queues_[num_threads_].data_.reset(0, 0);
+
+        // publish the bulk operation
+        epoch_.data_.fetch_add(1, std::memory_order_seq_cst);
+
+        // the calling thread participates by stealing from the team members
+        do_work(num_threads_);
+
+        wait_while([this]() {
+            return remaining_.data_.load(std::memory_order_acquire) != 0;
+        });
+
+        busy_.store(false, std::memory_order_release);
+        return true;
+    }
+}    // namespace hpx::execution::experimental
@@ -1713,6 +1713,90 @@ void test_bulk()
     }
 }
 
+void test_bulk_team()
+{
+    ex::bulk_team team;
+    auto sched = ex::with_bulk_team(ex::thread_pool_scheduler{}, team);
+    HPX_TEST(sched.team() == &team);
+    HPX_TEST(sched != ex::thread_pool_scheduler{});
+
+    // repeated short bulk operations on the same team
+    for (int n : {0, 1, 10, 43, 1000})
+    {
+        std::vector<int> v(n, 0);
+        for (int j = 0; j != 100; ++j)
+        {
+            ex::schedule(sched) | ex::bulk(n, [&](int i) { ++v[i]; }) |
+                tt::sync_wait();
+        }
+
+        for (int i = 0; i < n; ++i)
+        {
+            HPX_TEST_EQ(v[i], 100);
+        }
+    }
+
+    // nested bulk operations fall back to spawning tasks
+    {
+        int const n = 10;
+        std::vector<std::atomic<int>> v(n * n);
+
+        ex::schedule(sched) | ex::bulk(n, [&](int i) {
+            ex::schedule(sched) | ex::bulk(n, [&, i](int j) {
+                ++v[i * n + j];
+            }) | tt::sync_wait();
+        }) | tt::sync_wait();
+
+        for (auto const& value : v)
+        {
+            HPX_TEST_EQ(value.load(), 1);
+        }
+    }
+
+    // exceptions are propagated
+    {
+        bool caught_exception = false;
+        try
+        {
+            ex::transfer_just(sched) | ex::bulk(43, [](int i) {
+                if (i == 3)
+                {
+                    throw std::runtime_error("error");
+                }
+            }) | tt::sync_wait();
+        }
+        catch (std::runtime_error const& e)
+        {
+            caught_exception = true;
+            HPX_TEST(std::string(e.what()).find("error") == 0);
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // the team can be used from any thread
+    {
+        std::vector<int> v(100, 0);
+        std::vector<hpx::future<void>> futures;
+        for (int j = 0; j != 4; ++j)
+        {
+            futures.push_back(hpx::async([&, j]() {
+                ex::schedule(sched) |
+                    ex::bulk(25, [&, j](int i) { ++v[j * 25 + i]; }) |
+                    tt::sync_wait();
+            }));
+        }
+        for (auto& f : futures)
+        {
+            f.get();
+        }
+
+        for (int const value : v)
+        {
+            HPX_TEST_EQ(value, 1);
+        }
+    }
+}
+
 void test_completion_scheduler()
 {
     {
@@ -1814,6 +1898,7 @@ int hpx_main()
     test_let_error();
     test_detach();
     test_bulk();
+    test_bulk_team();
     test_completion_scheduler();
 
     return hpx::local::finalize();
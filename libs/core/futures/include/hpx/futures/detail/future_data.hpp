@@ -8,10 +8,12 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/functional/detail/basic_function.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/futures/future_fwd.hpp>
 #include <hpx/futures/traits/future_access.hpp>
@@ -22,6 +24,8 @@
 #include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
+#include <hpx/threading_base/config/defines.hpp>
+#include <hpx/threading_base/memory_arena.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/type_support/assert_owns_lock.hpp>
 #include <hpx/type_support/construct_at.hpp>
@@ -71,6 +75,99 @@ namespace hpx::lcos::detail {
     HPX_CORE_EXPORT void set_run_on_completed_error_handler(
         run_on_completed_error_handler_type f);
 
+    ///////////////////////////////////////////////////////////////////////
+    // Allocator used for the shared states and completion handlers created by
+    // the runtime. Memory blocks are cached per thread, the underlying memory
+    // is taken from the arena of the current thread pool if enabled. Blocks
+    // released on a thread of another pool bypass the cache and are returned
+    // to their arena right away.
+#if defined(HPX_THREADING_BASE_HAVE_POOL_ARENAS)
+    template <typename T = char>
+    using shared_state_allocator = hpx::util::thread_local_caching_allocator<T,
+        hpx::threads::pool_arena_allocator<T>>;
+#else
+    template <typename T = char>
+    using shared_state_allocator = hpx::util::thread_local_caching_allocator<T,
+        hpx::util::internal_allocator<T>>;
+#endif
+
+    ///////////////////////////////////////////////////////////////////////
+    // Completion handlers which do not fit into the small buffer of a
+    // completed_callback_type are stored in memory taken from a per-thread
+    // pool instead of being allocated on the heap.
+    template <typename F>
+    class pooled_completed_callback
+    {
+        using allocator_type = shared_state_allocator<F>;
+        using traits = std::allocator_traits<allocator_type>;
+
+    public:
+        template <typename F_,
+            typename = std::enable_if_t<
+                !std::is_same_v<std::decay_t<F_>, pooled_completed_callback>>>
+        explicit pooled_completed_callback(F_&& f)
+        {
+            allocator_type alloc;
+            F* p = traits::allocate(alloc, 1);
+            try
+            {
+                traits::construct(alloc, p, HPX_FORWARD(F_, f));
+            }
+            catch (...)
+            {
+                traits::deallocate(alloc, p, 1);
+                throw;
+            }
+            f_ = p;
+        }
+
+        pooled_completed_callback(pooled_completed_callback&& rhs) noexcept
+          : f_(rhs.f_)
+        {
+            rhs.f_ = nullptr;
+        }
+
+        pooled_completed_callback(pooled_completed_callback const&) = delete;
+        pooled_completed_callback& operator=(
+            pooled_completed_callback const&) = delete;
+        pooled_completed_callback& operator=(
+            pooled_completed_callback&&) = delete;
+
+        ~pooled_completed_callback()
+        {
+            if (f_ != nullptr)
+            {
+                allocator_type alloc;
+                traits::destroy(alloc, f_);
+                traits::deallocate(alloc, f_, 1);
+            }
+        }
+
+        void operator()()
+        {
+            HPX_ASSERT(f_ != nullptr);
+            (*f_)();
+        }
+
+    private:
+        F* f_ = nullptr;
+    };
+
+    template <typename F>
+    decltype(auto) make_completed_callback(F&& f)
+    {
+        using callback_type = std::decay_t<F>;
+        if constexpr (sizeof(callback_type) <=
+            hpx::util::detail::function_storage_size)
+        {
+            return HPX_FORWARD(F, f);
+        }
+        else
+        {
+            return pooled_completed_callback<callback_type>(HPX_FORWARD(F, f));
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////
     template <typename Result>
     struct future_data;
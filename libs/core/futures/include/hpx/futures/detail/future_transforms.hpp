@@ -7,6 +7,7 @@
 #pragma once
 
 #include <hpx/functional/deferred_call.hpp>
+#include <hpx/futures/detail/future_data.hpp>
 #include <hpx/futures/traits/acquire_future.hpp>
 #include <hpx/futures/traits/acquire_shared_state.hpp>
 #include <hpx/futures/traits/detail/future_traits.hpp>
@@ -55,7 +56,8 @@ namespace hpx::lcos::detail {
 
         // Attach a continuation to this future which will
         // re-evaluate it and continue to the next argument (if any).
-        state->set_on_completed(util::deferred_call(HPX_FORWARD(N, next)));
+        state->set_on_completed(lcos::detail::make_completed_callback(
+            util::deferred_call(HPX_FORWARD(N, next))));
     }
 
     // Acquire a future range from the given begin and end iterator
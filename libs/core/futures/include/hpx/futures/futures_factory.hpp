@@ -770,16 +770,14 @@ namespace hpx::lcos::local {
                 !std::is_same_v<std::decay_t<F>, futures_factory>>>
         explicit futures_factory(F&& f)
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::thread_local_caching_allocator<char,
-                    hpx::util::internal_allocator<>>{},
+                hpx::lcos::detail::shared_state_allocator<>{},
                 HPX_FORWARD(F, f)))
         {
         }
 
         explicit futures_factory(Result (*f)())
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::thread_local_caching_allocator<char,
-                    hpx::util::internal_allocator<>>{},
+                hpx::lcos::detail::shared_state_allocator<>{},
                 f))
         {
         }
@@ -325,7 +325,7 @@ namespace hpx::lcos::detail {
             }
 
             ptr->execute_deferred();
-            ptr->set_on_completed(
+            ptr->set_on_completed(make_completed_callback(
                 [this_ = HPX_MOVE(this_), state = HPX_MOVE(state),
                     policy = HPX_FORWARD(Policy, policy),
                     spawner = HPX_FORWARD(Spawner, spawner)]() mutable -> void {
@@ -338,7 +338,7 @@ namespace hpx::lcos::detail {
                     {
                         this_->template run<Unwrap>(HPX_MOVE(state));
                     }
-                });
+                }));
         }
 
     protected:
@@ -587,8 +587,7 @@ namespace hpx::lcos::detail {
     inline traits::detail::shared_state_ptr_t<future_unwrap_result_t<Future>>
     unwrap(Future&& future, error_code& ec)
     {
-        using allocator_type = hpx::util::thread_local_caching_allocator<char,
-            hpx::util::internal_allocator<>>;
+        using allocator_type = hpx::lcos::detail::shared_state_allocator<>;
         return unwrap_impl_alloc(
             allocator_type{}, HPX_FORWARD(Future, future), ec);
     }
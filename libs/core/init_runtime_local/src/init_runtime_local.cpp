@@ -242,6 +242,19 @@ namespace hpx {
     defined(__FreeBSD__)
                 threads::coroutines::detail::posix::use_guard_pages =
                     cmdline.rtcfg_.use_stack_guard_pages();
+#if defined(HPX_COROUTINES_HAVE_STACK_POOL)
+                threads::coroutines::detail::posix::use_stack_pool =
+                    cmdline.rtcfg_.use_stack_pool();
+                threads::coroutines::detail::posix::stack_pool_max_size =
+                    cmdline.rtcfg_.get_stack_pool_max_size();
+#endif
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+                threads::coroutines::detail::posix::stack_usage_sampling_rate =
+                    cmdline.rtcfg_.get_stack_usage_sampling_rate();
+                threads::coroutines::detail::posix::stack_paint_window_size =
+                    static_cast<std::size_t>(
+                        cmdline.rtcfg_.get_default_stack_size());
+#endif
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
                 if (cmdline.rtcfg_.enable_lock_detection())
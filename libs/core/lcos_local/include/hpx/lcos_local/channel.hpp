@@ -9,13 +9,16 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/packaged_task.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/iterator_support/iterator_facade.hpp>
 #include <hpx/lcos_local/receive_buffer.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/memory.hpp>
+#include <hpx/synchronization/channel_mpmc.hpp>
 #include <hpx/synchronization/no_mutex.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
@@ -23,15 +26,31 @@
 #include <hpx/type_support/assert_owns_lock.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <exception>
 #include <iterator>
+#include <memory>
 #include <mutex>
 #include <utility>
 
 namespace hpx::lcos::local {
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Pass channel_lockfree to the constructor of a channel to create a channel
+    // which is based on lock-free data structures. Such a channel scales
+    // better with many concurrent producers and consumers, but does not
+    // support explicitly specifying the generation of the values to set or
+    // get.
+    struct channel_lockfree_t
+    {
+        explicit channel_lockfree_t() = default;
+    };
+
+    inline constexpr channel_lockfree_t channel_lockfree{};
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
 
@@ -250,6 +269,201 @@ namespace hpx::lcos::local {
             bool closed_;
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Unlimited channel using lock-free queues for the values which were
+        // set but not retrieved yet and for the promises of the consumers
+        // waiting for a value. The balance between the two is tracked by a
+        // single atomic counter, which decides whether a producer has to hand
+        // over its value to a waiting consumer and whether a consumer can
+        // take a value right away.
+        template <typename T>
+        class unlimited_lockfree_channel : public channel_impl_base<T>
+        {
+            using promise_type = std::unique_ptr<hpx::promise<T>>;
+
+        public:
+            HPX_NON_COPYABLE(unlimited_lockfree_channel);
+
+        public:
+            unlimited_lockfree_channel() noexcept
+              : balance_(0)
+              , closed_(false)
+            {
+            }
+
+            ~unlimited_lockfree_channel() override = default;
+
+        protected:
+            hpx::future<T> get(std::size_t generation, bool blocking) override
+            {
+                if (generation != static_cast<std::size_t>(-1))
+                {
+                    return hpx::make_exceptional_future<T>(
+                        HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                            "hpx::lcos::local::channel::get",
+                            "lock-free channels do not support explicit "
+                            "generations"));
+                }
+
+                if (balance_.load() <= 0)
+                {
+                    if (closed_.load())
+                    {
+                        return hpx::make_exceptional_future<T>(
+                            HPX_GET_EXCEPTION(hpx::error::invalid_status,
+                                "hpx::lcos::local::channel::get",
+                                "this channel is empty and was closed"));
+                    }
+
+                    if (blocking && this->use_count() == 1)
+                    {
+                        return hpx::make_exceptional_future<T>(
+                            HPX_GET_EXCEPTION(hpx::error::invalid_status,
+                                "hpx::lcos::local::channel::get",
+                                "this channel is empty and is not accessible "
+                                "by any other thread causing a deadlock"));
+                    }
+                }
+
+                // take a value if one was set already
+                if (balance_.fetch_sub(1) > 0)
+                {
+                    return pop_value();
+                }
+
+                // otherwise wait for the next value to be set
+                auto p = std::make_unique<hpx::promise<T>>();
+                hpx::future<T> f = p->get_future();
+                waiting_.set(HPX_MOVE(p));
+
+                // the channel might have been closed concurrently, make sure
+                // the promise is not left behind
+                if (closed_.load())
+                {
+                    cancel_waiting();
+                }
+                return f;
+            }
+
+            bool try_get(
+                std::size_t generation, hpx::future<T>* f = nullptr) override
+            {
+                if (balance_.load() <= 0 && closed_.load())
+                {
+                    return false;
+                }
+
+                if (f != nullptr)
+                {
+                    *f = get(generation, false);
+                }
+                return true;
+            }
+
+            hpx::future<void> set(std::size_t generation, T&& t) override
+            {
+                if (generation != static_cast<std::size_t>(-1))
+                {
+                    return hpx::make_exceptional_future<void>(
+                        HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                            "hpx::lcos::local::channel::set",
+                            "lock-free channels do not support explicit "
+                            "generations"));
+                }
+
+                if (closed_.load())
+                {
+                    return hpx::make_exceptional_future<void>(
+                        HPX_GET_EXCEPTION(hpx::error::invalid_status,
+                            "hpx::lcos::local::channel::set",
+                            "attempting to write to a closed channel"));
+                }
+
+                if (balance_.fetch_add(1) >= 0)
+                {
+                    // nobody is waiting, store the value
+                    values_.set(hpx::make_ready_future<T>(HPX_MOVE(t)));
+                }
+                else
+                {
+                    // hand the value over to the oldest waiting consumer
+                    pop_waiting()->set_value(HPX_MOVE(t));
+                }
+                return hpx::make_ready_future();
+            }
+
+            std::size_t close(bool /* force_delete_entries */ = false) override
+            {
+                if (closed_.exchange(true))
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                        "hpx::lcos::local::channel::close",
+                        "attempting to close an already closed channel");
+                    return 0;
+                }
+
+                // all pending requests that can't be satisfied have to be
+                // canceled at this point
+                return cancel_waiting();
+            }
+
+        private:
+            // The counterpart of the operation which selected the queue has
+            // already committed to push its element, wait for it to appear.
+            hpx::future<T> pop_value()
+            {
+                hpx::future<T> f;
+                hpx::util::yield_while([&] { return !values_.get(&f); },
+                    "hpx::lcos::local::channel::get");
+                return f;
+            }
+
+            promise_type pop_waiting()
+            {
+                promise_type p;
+                hpx::util::yield_while([&] { return !waiting_.get(&p); },
+                    "hpx::lcos::local::channel::set");
+                return p;
+            }
+
+            std::size_t cancel_waiting()
+            {
+                std::size_t count = 0;
+                std::exception_ptr e;
+
+                std::int64_t balance = balance_.load();
+                while (balance < 0)
+                {
+                    if (!balance_.compare_exchange_weak(balance, balance + 1))
+                    {
+                        continue;
+                    }
+
+                    if (!e)
+                    {
+                        e = HPX_GET_EXCEPTION(hpx::error::future_cancelled,
+                            hpx::throwmode::lightweight,
+                            "hpx::lcos::local::close",
+                            "canceled waiting on this entry");
+                    }
+
+                    pop_waiting()->set_exception(e);
+                    ++count;
+
+                    balance = balance_.load();
+                }
+                return count;
+            }
+
+            // number of values available minus the number of waiting
+            // consumers
+            std::atomic<std::int64_t> balance_;
+            std::atomic<bool> closed_;
+
+            lockfree_unbounded_channel<hpx::future<T>> values_;
+            lockfree_unbounded_channel<promise_type> waiting_;
+        };
+
         ///////////////////////////////////////////////////////////////////////
         template <typename T>
         class one_element_queue_async
@@ -817,6 +1031,11 @@ namespace hpx::lcos::local {
         {
         }
 
+        explicit channel(channel_lockfree_t)
+          : base_type(new detail::unlimited_lockfree_channel<T>())
+        {
+        }
+
         using base_type::begin;
         using base_type::close;
         using base_type::end;
@@ -1102,6 +1321,12 @@ namespace hpx::lcos::local {
         {
         }
 
+        explicit channel(channel_lockfree_t)
+          : base_type(
+                new detail::unlimited_lockfree_channel<util::unused_type>())
+        {
+        }
+
         using base_type::begin;
         using base_type::close;
         using base_type::end;
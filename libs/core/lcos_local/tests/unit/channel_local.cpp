@@ -334,6 +334,132 @@ void closed_channel_set1()
     HPX_TEST(caught_exception);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void calculate_sum_lockfree()
+{
+    std::vector<int> s = {7, 2, 8, -9, 4, 0};
+    hpx::lcos::local::channel<int> c(hpx::lcos::local::channel_lockfree);
+
+    hpx::post(&sum, std::vector<int>(s.begin(), s.begin() + s.size() / 2), c);
+    hpx::post(&sum, std::vector<int>(s.begin() + s.size() / 2, s.end()), c);
+
+    int x = c.get(hpx::launch::sync);    // receive from c
+    int y = c.get(hpx::launch::sync);
+
+    int expected = std::accumulate(s.begin(), s.end(), 0);
+    HPX_TEST_EQ(expected, x + y);
+}
+
+void many_producers_lockfree()
+{
+    constexpr int num_producers = 16;
+    constexpr int num_items = 1000;
+
+    hpx::lcos::local::channel<int> c(hpx::lcos::local::channel_lockfree);
+
+    // request all values before they are produced
+    std::vector<hpx::future<int>> values;
+    values.reserve(num_producers * num_items / 2);
+    for (int i = 0; i != num_producers * num_items / 2; ++i)
+    {
+        values.push_back(c.get());
+    }
+
+    std::vector<hpx::future<void>> producers;
+    producers.reserve(num_producers);
+    for (int i = 0; i != num_producers; ++i)
+    {
+        producers.push_back(hpx::async([c]() mutable {
+            for (int j = 0; j != num_items; ++j)
+            {
+                c.set(1);
+            }
+        }));
+    }
+    hpx::wait_all(producers);
+
+    // the remaining values are retrieved after they were produced
+    for (int i = 0; i != num_producers * num_items / 2; ++i)
+    {
+        values.push_back(c.get());
+    }
+
+    int result = 0;
+    for (auto& f : values)
+    {
+        result += f.get();
+    }
+    HPX_TEST_EQ(result, num_producers * num_items);
+}
+
+void channel_range_lockfree()
+{
+    std::atomic<int> received_elements(0);
+
+    hpx::lcos::local::channel<std::string> queue(
+        hpx::lcos::local::channel_lockfree);
+    queue.set("one");
+    queue.set("two");
+    queue.set("three");
+    queue.close();
+
+    for (auto const& elem : queue)
+    {
+        (void) elem;
+        ++received_elements;
+    }
+
+    HPX_TEST_EQ(received_elements.load(), 3);
+}
+
+void closed_channel_lockfree()
+{
+    hpx::lcos::local::channel<int> c(hpx::lcos::local::channel_lockfree);
+
+    hpx::future<int> f = c.get();
+    HPX_TEST_EQ(c.close(), std::size_t(1));
+
+    bool caught_exception = false;
+    try
+    {
+        f.get();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    caught_exception = false;
+    try
+    {
+        c.set(42);
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void explicit_generation_lockfree()
+{
+    bool caught_exception = false;
+    try
+    {
+        hpx::lcos::local::channel<int> c(hpx::lcos::local::channel_lockfree);
+        c.set(42, 122);    // explicit generations are not supported
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
@@ -355,6 +481,12 @@ int hpx_main()
     closed_channel_get1();
     closed_channel_set1();
 
+    calculate_sum_lockfree();
+    many_producers_lockfree();
+    channel_range_lockfree();
+    closed_channel_lockfree();
+    explicit_generation_lockfree();
+
     return hpx::local::finalize();
 }
 
@@ -142,6 +142,9 @@ namespace hpx::resource::detail {
         case resource::scheduling_policy::local_priority_lifo:
             sched = "local_priority_lifo";
             break;
+        case resource::scheduling_policy::local_workstealing:
+            sched = "local_workstealing";
+            break;
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
         case resource::scheduling_policy::local_workrequesting_fifo:
             sched = "local_workrequesting_fifo";
@@ -487,6 +490,11 @@ namespace hpx::resource::detail {
         {
             default_scheduler = scheduling_policy::local_priority_lifo;
         }
+        else if (0 ==
+            std::string("local-workstealing").find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_workstealing;
+        }
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
         else if (0 ==
             std::string("local-workrequesting-fifo")
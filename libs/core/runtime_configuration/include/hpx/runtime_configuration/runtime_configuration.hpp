@@ -89,6 +89,8 @@ namespace hpx::util {
 
         bool get_agas_range_caching_mode() const;
 
+        bool get_agas_concurrent_caching_mode() const;
+
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
         // Load application specific configuration and merge it with the
@@ -110,6 +112,13 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // Pooling of the stacks of terminated threads
+        bool use_stack_pool() const;
+        std::size_t get_stack_pool_max_size() const;
+#endif
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+        std::size_t get_stack_usage_sampling_rate() const;
 #endif
 
         // return trace_depth for stack-backtraces
@@ -214,6 +214,13 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_pool = ${HPX_USE_STACK_POOL:1}",
+            "pool_max_size = ${HPX_STACK_POOL_MAX_SIZE:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_STACK_POOL_MAX_SIZE)) "}",
+#endif
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+            "usage_sampling_rate = ${HPX_STACK_USAGE_SAMPLING_RATE:"
+            HPX_PP_STRINGIZE(HPX_PP_EXPAND(HPX_STACK_USAGE_SAMPLING_RATE)) "}",
 #endif
 
             "[hpx.threadpools]",
@@ -257,6 +264,12 @@ namespace hpx::util {
             "init_threads_count = "
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
+            "timer_wheel_resolution = "
+            "${HPX_THREAD_QUEUE_TIMER_WHEEL_RESOLUTION:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_TIMER_WHEEL_RESOLUTION)) "}",
+            "max_recycled_threads = "
+            "${HPX_THREAD_QUEUE_MAX_RECYCLED_THREADS:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_MAX_RECYCLED_THREADS)) "}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -309,6 +322,7 @@ namespace hpx::util {
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
+            "use_concurrent_cache = ${HPX_AGAS_USE_CONCURRENT_CACHE:0}",
 
             "[hpx.components]",
             "load_external = ${HPX_LOAD_EXTERNAL_COMPONENTS:1}",
@@ -908,6 +922,16 @@ namespace hpx::util {
         return false;
     }
 
+    bool runtime_configuration::get_agas_concurrent_caching_mode() const
+    {
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(
+                       *sec, "use_concurrent_cache", 0) != 0;
+        }
+        return false;
+    }
+
     std::size_t runtime_configuration::get_agas_max_pending_refcnt_requests()
         const
     {
@@ -1099,6 +1123,40 @@ namespace hpx::util {
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::use_stack_pool() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_pool", 1) != 0;
+        }
+        return true;    // default is true
+    }
+
+    std::size_t runtime_configuration::get_stack_pool_max_size() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "pool_max_size", HPX_STACK_POOL_MAX_SIZE);
+        }
+        return HPX_STACK_POOL_MAX_SIZE;
+    }
+#endif
+
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+    std::size_t runtime_configuration::get_stack_usage_sampling_rate() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(*sec,
+                "usage_sampling_rate", HPX_STACK_USAGE_SAMPLING_RATE);
+        }
+        return HPX_STACK_USAGE_SAMPLING_RATE;
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
@@ -1203,6 +1261,7 @@ namespace hpx::util {
 
         case threads::thread_stacksize::unknown:
         case threads::thread_stacksize::current:
+        case threads::thread_stacksize::automatic:
         default:
             [[fallthrough]];
         case threads::thread_stacksize::small_:
@@ -14,6 +14,7 @@
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
 #include <hpx/schedulers/local_workrequesting_scheduler.hpp>
 #endif
+#include <hpx/schedulers/local_workstealing_scheduler.hpp>
 #include <hpx/schedulers/shared_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/static_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/static_queue_scheduler.hpp>
@@ -0,0 +1,198 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/schedulers/local_priority_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::threads::policies {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The local_workstealing_scheduler maintains one Chase-Lev deque of work
+    /// items (threads) per OS thread. Each OS thread executes the work it
+    /// created itself in LIFO order, while idle OS threads steal the oldest
+    /// work items from other OS threads (FIFO order).
+    ///
+    /// New work items which were not explicitly placed on a particular OS
+    /// thread are kept on the OS thread creating them. Victims for stealing
+    /// are selected hierarchically: OS threads running on the same core are
+    /// tried first, followed by those sharing the same L3 cache, those in the
+    /// same NUMA domain, and (if stealing across NUMA domains is enabled) all
+    /// remaining OS threads. Within each level the OS threads are ordered by
+    /// the distance of their numbers to spread the thieves over the victims.
+    ///
+    /// The handling of high, low, and bound priority work items is identical
+    /// to the local_priority_queue_scheduler.
+    template <typename Mutex = std::mutex,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_local_priority_queue_scheduler_terminated_queue>
+    class local_workstealing_scheduler
+      : public local_priority_queue_scheduler<Mutex, chase_lev_lifo,
+            StagedQueuing, TerminatedQueuing>
+    {
+        using base_type = local_priority_queue_scheduler<Mutex, chase_lev_lifo,
+            StagedQueuing, TerminatedQueuing>;
+
+    public:
+        using init_parameter_type = typename base_type::init_parameter_type;
+
+        explicit local_workstealing_scheduler(init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+        {
+        }
+
+        local_workstealing_scheduler(
+            local_workstealing_scheduler const&) = delete;
+        local_workstealing_scheduler(local_workstealing_scheduler&&) = delete;
+        local_workstealing_scheduler& operator=(
+            local_workstealing_scheduler const&) = delete;
+        local_workstealing_scheduler& operator=(
+            local_workstealing_scheduler&&) = delete;
+
+        ~local_workstealing_scheduler() override = default;
+
+        static std::string_view get_scheduler_name()
+        {
+            return "local_workstealing_scheduler";
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // create a new thread and schedule it if the initial state is equal to
+        // pending
+        void create_thread(thread_init_data& data, thread_id_ref_type* id,
+            error_code& ec) override
+        {
+            // keep new work on the OS thread creating it, if possible
+            if (data.schedulehint.mode == thread_schedule_hint_mode::none)
+            {
+                std::size_t const num_thread = get_local_num_thread();
+                if (num_thread != static_cast<std::size_t>(-1))
+                {
+                    data.schedulehint.mode = thread_schedule_hint_mode::thread;
+                    data.schedulehint.hint =
+                        static_cast<std::int16_t>(num_thread);
+                }
+            }
+
+            base_type::create_thread(data, id, ec);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void on_start_thread(std::size_t num_thread) override
+        {
+            base_type::on_start_thread(num_thread);
+
+            // replace the victims selected by the base class
+            std::vector<std::size_t>& victims =
+                this->victim_threads_[num_thread].data_;
+            victims.clear();
+
+            std::size_t const num_threads = this->num_queues_;
+            auto const& topo = create_topology();
+
+            std::size_t const num_pu =
+                this->affinity_data_.get_pu_num(num_thread);
+            mask_cref_type core_mask = topo.get_core_affinity_mask(num_pu);
+            mask_cref_type cache_mask = topo.get_cache_affinity_mask(num_pu);
+            mask_cref_type numa_mask = topo.get_numa_node_affinity_mask(num_pu);
+
+            bool const enable_stealing_numa = this->has_scheduler_mode(
+                policies::scheduler_mode::enable_stealing_numa);
+
+            // Sort all other OS threads by (topological level, distance of OS
+            // thread numbers). The topology does not expose the distances
+            // between NUMA domains, all remote domains are treated alike.
+            std::vector<std::tuple<int, std::size_t, std::size_t>> candidates;
+            candidates.reserve(num_threads);
+
+            for (std::size_t i = 0; i != num_threads; ++i)
+            {
+                if (i == num_thread)
+                    continue;
+
+                std::size_t const other_pu = this->affinity_data_.get_pu_num(i);
+                mask_cref_type other_mask =
+                    topo.get_thread_affinity_mask(other_pu);
+
+                int level = 0;
+                if (any(core_mask & other_mask))
+                {
+                    level = 0;
+                }
+                else if (any(cache_mask & other_mask))
+                {
+                    level = 1;
+                }
+                else if (any(numa_mask & other_mask))
+                {
+                    level = 2;
+                }
+                else if (enable_stealing_numa)
+                {
+                    level = 3;
+                }
+                else
+                {
+                    continue;
+                }
+
+                // spread the thieves of the same level over the victims
+                std::size_t const distance =
+                    (i + num_threads - num_thread) % num_threads;
+
+                candidates.emplace_back(
+                    level, (std::min)(distance, num_threads - distance), i);
+            }
+
+            std::sort(candidates.begin(), candidates.end());
+
+            victims.reserve(candidates.size());
+            for (auto const& candidate : candidates)
+            {
+                HPX_ASSERT(std::get<2>(candidate) != num_thread);
+                victims.push_back(std::get<2>(candidate));
+            }
+        }
+
+    private:
+        // return the number of the OS thread calling this function if this
+        // OS thread belongs to the pool managed by this scheduler
+        std::size_t get_local_num_thread() const
+        {
+            std::size_t const num_thread =
+                hpx::threads::detail::get_local_thread_num_tss();
+            if (num_thread >= this->num_queues_ ||
+                this->parent_pool_ == nullptr ||
+                hpx::threads::detail::get_thread_pool_num_tss() !=
+                    this->parent_pool_->get_pool_id().index())
+            {
+                return static_cast<std::size_t>(-1);
+            }
+            return num_thread;
+        }
+    };
+}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
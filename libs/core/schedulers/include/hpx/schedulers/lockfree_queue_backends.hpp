@@ -18,12 +18,15 @@
 #endif
 
 #include <hpx/allocator_support/aligned_allocator.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
 
 // Does not rely on CXX11_STD_ATOMIC_128BIT
 #include <hpx/concurrency/concurrentqueue.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -166,6 +169,97 @@ namespace hpx::threads::policies {
         };
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // LIFO for the owning OS thread + FIFO stealing at the opposite end.
+    // Chase-Lev deque, see: http://dl.acm.org/citation.cfm?id=1073974
+    //
+    // Only one OS thread may push to and pop from the bottom of a Chase-Lev
+    // deque. The first OS thread popping without stealing becomes the owner
+    // of the queue. All items pushed by other threads (or pushed to the other
+    // end) are handed over through a separate FIFO queue which is drained by
+    // the owner and the thieves once the deque is empty.
+    template <typename T>
+    struct chase_lev_lifo_backend
+    {
+        using container_type = hpx::concurrency::chase_lev_deque<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        static constexpr bool support_bulk_dequeue = false;
+
+        explicit chase_lev_lifo_backend(size_type initial_size = 0,
+            size_type num_thread = static_cast<size_type>(-1))
+          : queue_(static_cast<std::size_t>(initial_size))
+          , inbox_(initial_size, num_thread)
+          , owner_(std::thread::id())
+        {
+        }
+
+        bool push(const_reference val, bool other_end = false)    //-V659
+        {
+            if (!other_end && is_owner(std::this_thread::get_id()))
+            {
+                queue_.push_bottom(val);
+                return true;
+            }
+            return inbox_.push(val);
+        }
+
+        bool push(rvalue_reference val, bool other_end = false)    //-V659
+        {
+            return push(static_cast<const_reference>(val), other_end);
+        }
+
+        bool pop(reference val, bool steal = true) noexcept
+        {
+            if (!steal && acquire_ownership(std::this_thread::get_id()))
+            {
+                return queue_.pop_bottom(val) || inbox_.pop(val);
+            }
+            return queue_.steal(val) || inbox_.pop(val);
+        }
+
+        bool empty() noexcept
+        {
+            return queue_.empty() && inbox_.empty();
+        }
+
+    private:
+        bool is_owner(std::thread::id id) const noexcept
+        {
+            return owner_.load(std::memory_order_relaxed) == id;
+        }
+
+        bool acquire_ownership(std::thread::id id) noexcept
+        {
+            std::thread::id owner = owner_.load(std::memory_order_relaxed);
+            if (owner == std::thread::id())
+            {
+                owner_.compare_exchange_strong(
+                    owner, id, std::memory_order_relaxed);
+                return owner == std::thread::id() || owner == id;
+            }
+            return owner == id;
+        }
+
+        container_type queue_;
+        lockfree_fifo_backend<T> inbox_;
+        std::atomic<std::thread::id> owner_;
+    };
+
+    struct chase_lev_lifo
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = chase_lev_lifo_backend<T>;
+        };
+    };
+
     // LIFO
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
     struct lockfree_lifo;
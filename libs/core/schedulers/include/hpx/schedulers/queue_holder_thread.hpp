@@ -10,6 +10,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/debugging/print.hpp>
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/detail/stack_usage.hpp>
 #include <hpx/threading_base/print.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -389,6 +390,8 @@ namespace hpx::threads::policies {
         void create_thread(thread_init_data& data, thread_id_ref_type* tid,
             std::size_t thread_num, error_code& ec)
         {
+            threads::detail::resolve_stacksize(data, parameters_);
+
             if (thread_num != thread_num_ &&
                 (data.initial_state == thread_schedule_state::pending ||
                     data.initial_state == thread_schedule_state::pending_boost))
@@ -16,6 +16,7 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/schedulers/queue_helpers.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/threading_base/detail/stack_usage.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_data_stackful.hpp>
@@ -142,28 +143,8 @@ namespace hpx::threads::policies {
                 data.scheduler_base->get_stack_size(data.stacksize);
 
 #if !defined(HPX_HAVE_ADDRESS_SANITIZER)
-            thread_heap_type* heap = nullptr;
-
-            if (stacksize == parameters_.small_stacksize_)
-            {
-                heap = &thread_heap_small_;
-            }
-            else if (stacksize == parameters_.medium_stacksize_)
-            {
-                heap = &thread_heap_medium_;
-            }
-            else if (stacksize == parameters_.large_stacksize_)
-            {
-                heap = &thread_heap_large_;
-            }
-            else if (stacksize == parameters_.huge_stacksize_)
-            {
-                heap = &thread_heap_huge_;
-            }
-            else if (stacksize == parameters_.nostack_stacksize_)
-            {
-                heap = &thread_heap_nostack_;
-            }
+            std::size_t heap_num = 0;
+            thread_heap_type* heap = get_thread_heap(stacksize, heap_num);
             HPX_ASSERT(heap);
 #endif
 
@@ -176,13 +157,23 @@ namespace hpx::threads::policies {
 
             // ASAN gets confused by reusing threads/stacks
 #if !defined(HPX_HAVE_ADDRESS_SANITIZER)
-            // Check for an unused thread object.
-            if (heap && !heap->empty())    //-V522
+            // Check for an unused thread object, take a batch of thread
+            // objects terminated on other queues if none is left.
+            threads::detail::thread_recycler& recycler =
+                data.scheduler_base->get_thread_recycler();
+            if (heap && (!heap->empty() || recycler.get(heap_num, *heap)))
             {
                 // Take ownership of the thread object and rebind it.
                 thrd = heap->back();
                 heap->pop_back();
-                get_thread_id_data(thrd)->rebind(data);
+
+                threads::thread_data* p = get_thread_id_data(thrd);
+                if (&p->get_queue<thread_queue>() != this)
+                {
+                    recycler.count_cross_queue_reuse();
+                    p->set_queue(this);
+                }
+                p->rebind(data);
             }
             else
 #endif
@@ -348,35 +339,60 @@ namespace hpx::threads::policies {
             return addednew != 0;
         }
 
-        void recycle_thread(thread_id_type const& thrd)
+        thread_heap_type* get_thread_heap(
+            std::ptrdiff_t stacksize, std::size_t& heap_num) noexcept
         {
-            std::ptrdiff_t const stacksize =
-                get_thread_id_data(thrd)->get_stack_size();
-
             if (stacksize == parameters_.small_stacksize_)
             {
-                thread_heap_small_.push_back(thrd);
+                heap_num = 0;
+                return &thread_heap_small_;
             }
-            else if (stacksize == parameters_.medium_stacksize_)
+            if (stacksize == parameters_.medium_stacksize_)
             {
-                thread_heap_medium_.push_back(thrd);
+                heap_num = 1;
+                return &thread_heap_medium_;
             }
-            else if (stacksize == parameters_.large_stacksize_)
+            if (stacksize == parameters_.large_stacksize_)
             {
-                thread_heap_large_.push_back(thrd);
+                heap_num = 2;
+                return &thread_heap_large_;
             }
-            else if (stacksize == parameters_.huge_stacksize_)
+            if (stacksize == parameters_.huge_stacksize_)
             {
-                thread_heap_huge_.push_back(thrd);
+                heap_num = 3;
+                return &thread_heap_huge_;
             }
-            else if (stacksize == parameters_.nostack_stacksize_)
+            if (stacksize == parameters_.nostack_stacksize_)
             {
-                thread_heap_nostack_.push_back(thrd);
+                heap_num = 4;
+                return &thread_heap_nostack_;
             }
-            else
+            return nullptr;
+        }
+
+        void recycle_thread(thread_id_type const& thrd)
+        {
+            threads::thread_data* p = get_thread_id_data(thrd);
+            std::ptrdiff_t const stacksize = p->get_stack_size();
+
+            std::size_t heap_num = 0;
+            thread_heap_type* heap = get_thread_heap(stacksize, heap_num);
+            if (heap == nullptr)
             {
                 HPX_ASSERT_MSG(
                     false, util::format("Invalid stack size {1}", stacksize));
+                return;
+            }
+
+            heap->push_back(thrd);
+
+            // hand over surplus thread objects to the other queues of the
+            // scheduler
+            if (heap->size() > threads::detail::thread_recycler::
+                                   max_local_threads)
+            {
+                p->get_scheduler_base()->get_thread_recycler().put(
+                    heap_num, *heap);
             }
         }
 
@@ -696,10 +712,7 @@ namespace hpx::threads::policies {
             if (id)
                 *id = invalid_thread_id;
 
-            if (data.stacksize == threads::thread_stacksize::current)
-            {
-                data.stacksize = get_self_stacksize_enum();
-            }
+            threads::detail::resolve_stacksize(data, parameters_);
 
             HPX_ASSERT(data.stacksize != threads::thread_stacksize::current);
 
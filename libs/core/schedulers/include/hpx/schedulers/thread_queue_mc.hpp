@@ -14,6 +14,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/queue_holder_thread.hpp>
+#include <hpx/threading_base/detail/stack_usage.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 
@@ -194,10 +195,7 @@ namespace hpx::threads::policies {
             if (id)
                 *id = invalid_thread_id;
 
-            if (data.stacksize == threads::thread_stacksize::current)
-            {
-                data.stacksize = get_self_stacksize_enum();
-            }
+            threads::detail::resolve_stacksize(data, parameters_);
 
             HPX_ASSERT(data.stacksize != threads::thread_stacksize::current);
 
@@ -0,0 +1,95 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Terminated thread objects are shared between the queues of a scheduler.
+// Create bursts of threads alternately on two different worker threads and
+// verify that thread objects are reused across queues and that the number of
+// thread objects kept for reuse stays bounded.
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+constexpr std::int64_t max_recycled_threads = 256;
+constexpr std::size_t num_threads = 2000;
+
+void run_burst(std::int16_t worker)
+{
+    hpx::execution::parallel_executor const exec{
+        hpx::threads::thread_schedule_hint(worker)};
+
+    // keep all threads alive at the same time
+    hpx::promise<void> p;
+    hpx::shared_future<void> sf = p.get_future();
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        futures.push_back(hpx::async(exec, [sf]() { sf.get(); }));
+    }
+
+    p.set_value();
+    hpx::wait_all(futures);
+}
+
+void cleanup(hpx::threads::policies::scheduler_base* scheduler)
+{
+    for (int i = 0; i != 100; ++i)
+    {
+        scheduler->cleanup_terminated(true);
+        hpx::this_thread::yield();
+    }
+}
+
+int hpx_main()
+{
+    hpx::threads::thread_pool_base* pool =
+        hpx::threads::detail::get_self_or_default_pool();
+    hpx::threads::policies::scheduler_base* scheduler = pool->get_scheduler();
+    hpx::threads::detail::thread_recycler& recycler =
+        scheduler->get_thread_recycler();
+
+    for (int i = 0; i != 5; ++i)
+    {
+        run_burst(0);
+        cleanup(scheduler);
+        HPX_TEST_LTE(recycler.size(), max_recycled_threads);
+
+        run_burst(1);
+        cleanup(scheduler);
+        HPX_TEST_LTE(recycler.size(), max_recycled_threads);
+    }
+
+    // thread objects not fitting into the recycler have been released
+    HPX_TEST_LT(std::int64_t(0),
+        pool->get_thread_recycler_objects_freed(std::size_t(-1), false));
+
+    // thread objects terminated on one queue have been reused by another
+    HPX_TEST_LT(std::int64_t(0),
+        pool->get_thread_recycler_cross_queue_reuses(std::size_t(-1), false));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=2",
+        "hpx.thread_queue.max_recycled_threads=" +
+            std::to_string(max_recycled_threads)};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
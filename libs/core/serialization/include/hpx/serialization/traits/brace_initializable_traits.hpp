@@ -144,4 +144,157 @@ namespace hpx::traits {
 
 #undef MAKE_ARITY_FUNC
     }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        template <typename... Ts>
+        struct struct_member_types
+        {
+        };
+
+        // Extract the declared types of the members of a brace-initializable
+        // struct. These functions are used in unevaluated contexts only.
+        template <typename T>
+        auto member_types(T&, size<0>)
+        {
+            return struct_member_types<>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<1>)
+        {
+            auto& [p1] = t;
+            return struct_member_types<decltype(p1)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<2>)
+        {
+            auto& [p1, p2] = t;
+            return struct_member_types<decltype(p1), decltype(p2)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<3>)
+        {
+            auto& [p1, p2, p3] = t;
+            return struct_member_types<decltype(p1), decltype(p2),
+                decltype(p3)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<4>)
+        {
+            auto& [p1, p2, p3, p4] = t;
+            return struct_member_types<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<5>)
+        {
+            auto& [p1, p2, p3, p4, p5] = t;
+            return struct_member_types<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<6>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6] = t;
+            return struct_member_types<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<7>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7] = t;
+            return struct_member_types<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<8>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8] = t;
+            return struct_member_types<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<9>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9] = t;
+            return struct_member_types<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<10>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10] = t;
+            return struct_member_types<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<11>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11] = t;
+            return struct_member_types<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<12>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12] = t;
+            return struct_member_types<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<13>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13] = t;
+            return struct_member_types<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12), decltype(p13)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<14>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13,
+                p14] = t;
+            return struct_member_types<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12), decltype(p13), decltype(p14)>{};
+        }
+
+        template <typename T>
+        auto member_types(T& t, size<15>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13,
+                p14, p15] = t;
+            return struct_member_types<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12), decltype(p13), decltype(p14), decltype(p15)>{};
+        }
+
+        template <typename T>
+        using member_types_t =
+            decltype(member_types(std::declval<T&>(), arity<T>()));
+    }    // namespace detail
 }    // namespace hpx::traits
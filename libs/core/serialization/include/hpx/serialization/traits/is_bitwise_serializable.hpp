@@ -10,31 +10,106 @@
 #include <hpx/config.hpp>
 #include <hpx/serialization/config/defines.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/traits/brace_initializable_traits.hpp>
+#include <hpx/serialization/traits/is_serializable.hpp>
 
+#include <cstddef>
 #include <type_traits>
 
 namespace hpx::traits {
 
+    namespace detail {
+
 #if !defined(HPX_SERIALIZATION_HAVE_ALLOW_RAW_POINTER_SERIALIZATION)
-    template <typename T, typename Enable = void>
-    struct is_bitwise_serializable
-      : std::integral_constant<bool,
-            (std::is_trivially_copy_assignable_v<T> ||
-                (std::is_copy_assignable_v<T> &&
-                    std::is_trivially_copy_constructible_v<T>) ) &&
-                !std::is_pointer_v<T>>
-    {
-    };
+        template <typename T>
+        struct is_bitwise_serializable_default
+          : std::integral_constant<bool,
+                (std::is_trivially_copy_assignable_v<T> ||
+                    (std::is_copy_assignable_v<T> &&
+                        std::is_trivially_copy_constructible_v<T>) ) &&
+                    !std::is_pointer_v<T>>
+        {
+        };
 #else
+        template <typename T>
+        struct is_bitwise_serializable_default
+          : std::integral_constant<bool,
+                std::is_trivially_copy_assignable_v<T> ||
+                    (std::is_copy_assignable_v<T> &&
+                        std::is_trivially_copy_constructible_v<T>)>
+        {
+        };
+#endif
+    }    // namespace detail
+
     template <typename T, typename Enable = void>
+    struct is_bitwise_serializable;
+
+    namespace detail {
+
+        // access is named through a template parameter, it has to be complete
+        // only once the trait is instantiated
+        template <typename T, typename Access = serialization::access>
+        struct has_serialize_member : Access::template has_serialize<T>
+        {
+        };
+
+        template <typename T, typename Members>
+        struct is_bitwise_serializable_members_impl : std::false_type
+        {
+        };
+
+        // all members have to be bitwise serializable themselves and the
+        // struct must not contain any padding
+        template <typename T, typename... Members>
+        struct is_bitwise_serializable_members_impl<T,
+            struct_member_types<Members...>>
+          : std::integral_constant<bool,
+                sizeof...(Members) != 0 &&
+                    ((!std::is_reference_v<Members> &&
+                         is_bitwise_serializable<
+                             std::remove_cv_t<Members>>::value) &&
+                        ...) &&
+                    (std::size_t(0) + ... + sizeof(Members)) == sizeof(T)>
+        {
+        };
+
+        template <typename T>
+        struct is_bitwise_serializable_members
+          : is_bitwise_serializable_members_impl<T, member_types_t<T>>
+        {
+        };
+
+        template <typename T, typename Enable = void>
+        struct is_bitwise_serializable_aggregate : std::false_type
+        {
+        };
+
+        // Aggregates that are not covered by the default (e.g. because one
+        // of their members is not trivially copyable) and that don't expose
+        // their own serialization are bitwise serializable if all of their
+        // members are.
+        template <typename T>
+        struct is_bitwise_serializable_aggregate<T,
+            std::enable_if_t<std::is_class_v<T> && std::is_aggregate_v<T>>>
+          : std::conjunction<std::negation<has_serialize_adl<T>>,
+                std::negation<has_serialize_member<T>>,
+                has_struct_serialization<T>,
+                is_bitwise_serializable_members<T>>
+        {
+        };
+    }    // namespace detail
+
+    // Aggregates are bitwise serializable by default if all of their members
+    // are. This allows for vectors, arrays, and maps of those to be
+    // serialized using bulk copies (or zero-copy chunks) instead of
+    // member-wise serialization.
+    template <typename T, typename Enable>
     struct is_bitwise_serializable
-      : std::integral_constant<bool,
-            std::is_trivially_copy_assignable_v<T> ||
-                (std::is_copy_assignable_v<T> &&
-                    std::is_trivially_copy_constructible_v<T>)>
+      : std::disjunction<detail::is_bitwise_serializable_default<T>,
+            detail::is_bitwise_serializable_aggregate<T>>
     {
     };
-#endif
 
     template <typename T>
     inline constexpr bool is_bitwise_serializable_v =
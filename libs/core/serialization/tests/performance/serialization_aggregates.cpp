@@ -0,0 +1,210 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the serialization throughput of containers of aggregates. Aggregates
+// that are bitwise serializable (either because they are trivially copyable or
+// because all of their members are bitwise serializable and they have no
+// padding) are compared against the same aggregate serialized member-wise.
+
+#include <hpx/serialization/array.hpp>
+#include <hpx/serialization/brace_initializable.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+// not trivially copyable, but explicitly marked as bitwise serializable
+struct coordinate
+{
+    coordinate() = default;
+
+    explicit coordinate(double value)
+      : value(value)
+    {
+    }
+
+    coordinate(coordinate const& rhs)
+      : value(rhs.value)
+    {
+    }
+
+    coordinate& operator=(coordinate const& rhs)
+    {
+        value = rhs.value;
+        return *this;
+    }
+
+    double value = 0.0;
+};
+
+HPX_IS_BITWISE_SERIALIZABLE(coordinate)
+
+// trivially copyable
+struct plain_particle
+{
+    double x, y, z;
+    std::int64_t id;
+};
+
+// bitwise serializable because all members are and there is no padding
+struct particle
+{
+    coordinate x, y, z;
+    std::int64_t id;
+};
+
+// same layout, serialized member-wise
+struct memberwise_particle
+{
+    coordinate x, y, z;
+    std::int64_t id;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & x & y & z & id;
+        // clang-format on
+    }
+};
+
+static_assert(hpx::traits::is_bitwise_serializable_v<plain_particle>);
+static_assert(hpx::traits::is_bitwise_serializable_v<particle>);
+static_assert(!hpx::traits::is_bitwise_serializable_v<memberwise_particle>);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T make_value(std::size_t i)
+{
+    auto const d = static_cast<double>(i);
+    return T{coordinate(d), coordinate(d + 1), coordinate(d + 2),
+        static_cast<std::int64_t>(i)};
+}
+
+template <>
+plain_particle make_value<plain_particle>(std::size_t i)
+{
+    auto const d = static_cast<double>(i);
+    return plain_particle{d, d + 1, d + 2, static_cast<std::int64_t>(i)};
+}
+
+template <typename Container>
+void measure(char const* name, Container const& data, std::size_t payload,
+    std::size_t iterations)
+{
+    std::vector<char> buffer;
+    Container result;
+
+    auto const start = std::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        buffer.clear();
+        {
+            hpx::serialization::output_archive archive(buffer);
+            archive << data;
+        }
+        {
+            hpx::serialization::input_archive archive(buffer, buffer.size());
+            archive >> result;
+        }
+    }
+
+    auto const finish = std::chrono::high_resolution_clock::now();
+    double const elapsed =
+        std::chrono::duration<double>(finish - start).count();
+
+    std::cout << name << ": size = " << buffer.size() << " bytes, throughput = "
+              << static_cast<double>(payload * iterations) / elapsed / 1e6
+              << " MB/s" << std::endl;
+}
+
+template <typename T>
+void measure_type(char const* name, std::size_t count, std::size_t iterations)
+{
+    std::cout << name << " (" << sizeof(T) << " bytes)" << std::endl;
+
+    {
+        std::vector<T> data;
+        data.reserve(count);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            data.push_back(make_value<T>(i));
+        }
+        measure("  std::vector", data, count * sizeof(T), iterations);
+    }
+
+    {
+        std::array<T, 64> data;
+        for (std::size_t i = 0; i != data.size(); ++i)
+        {
+            data[i] = make_value<T>(i);
+        }
+
+        // small containers, run more iterations
+        std::size_t const scale =
+            (std::max)(count / data.size(), std::size_t(1));
+        measure("  std::array", data, data.size() * sizeof(T),
+            iterations * scale);
+    }
+
+    {
+        std::map<std::int64_t, T> data;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            data.emplace(static_cast<std::int64_t>(i), make_value<T>(i));
+        }
+        measure("  std::map", data, count * sizeof(T), iterations);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "usage: " << argv[0] << " N [count]";
+        std::cout << std::endl << std::endl;
+        std::cout << "arguments: " << std::endl;
+        std::cout << " N      -- number of iterations" << std::endl;
+        std::cout << " count  -- number of elements (default: 10000)"
+                  << std::endl
+                  << std::endl;
+        return 0;
+    }
+
+    std::size_t iterations;
+    std::size_t count = 10000;
+    try
+    {
+        iterations = hpx::util::from_string<std::size_t>(argv[1]);
+        if (argc > 2)
+        {
+            count = hpx::util::from_string<std::size_t>(argv[2]);
+        }
+    }
+    catch (std::exception& exc)
+    {
+        std::cerr << "Error: " << exc.what() << std::endl;
+        std::cerr << "Positional arguments must be integers." << std::endl;
+        return -1;
+    }
+
+    measure_type<plain_particle>("trivially copyable", count, iterations);
+    measure_type<particle>("bitwise aggregate", count, iterations);
+    measure_type<memberwise_particle>("member-wise", count, iterations);
+
+    return 0;
+}
@@ -0,0 +1,241 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Aggregates that are not trivially copyable are serialized bitwise if all of
+// their members are bitwise serializable and if they don't contain padding.
+
+#include <hpx/config.hpp>
+
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/array.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// not trivially copyable, but explicitly marked as bitwise serializable
+struct tagged_value
+{
+    tagged_value() = default;
+
+    explicit tagged_value(std::int32_t value)
+      : value(value)
+    {
+    }
+
+    tagged_value(tagged_value const& rhs)
+      : value(rhs.value)
+    {
+    }
+
+    tagged_value& operator=(tagged_value const& rhs)
+    {
+        value = rhs.value;
+        return *this;
+    }
+
+    friend bool operator==(tagged_value const& lhs, tagged_value const& rhs)
+    {
+        return lhs.value == rhs.value;
+    }
+
+    std::int32_t value = 0;
+};
+
+HPX_IS_BITWISE_SERIALIZABLE(tagged_value)
+
+// all members are bitwise serializable, no padding
+struct point
+{
+    tagged_value x;
+    std::int32_t y;
+
+    friend bool operator==(point const& lhs, point const& rhs)
+    {
+        return lhs.x == rhs.x && lhs.y == rhs.y;
+    }
+};
+
+// all members are bitwise serializable, but the struct has padding
+struct padded_point
+{
+    tagged_value x;
+    double y;
+
+    friend bool operator==(padded_point const& lhs, padded_point const& rhs)
+    {
+        return lhs.x == rhs.x && lhs.y == rhs.y;
+    }
+};
+
+// not all members are bitwise serializable
+struct named_point
+{
+    tagged_value x;
+    std::string name;
+
+    friend bool operator==(named_point const& lhs, named_point const& rhs)
+    {
+        return lhs.x == rhs.x && lhs.name == rhs.name;
+    }
+};
+
+// nested aggregates are handled as well
+struct segment
+{
+    point first;
+    point second;
+
+    friend bool operator==(segment const& lhs, segment const& rhs)
+    {
+        return lhs.first == rhs.first && lhs.second == rhs.second;
+    }
+};
+
+// user provided partial specializations for aggregates don't conflict with
+// the automatic detection
+template <typename T>
+struct wrapped
+{
+    tagged_value x;
+    T value;
+};
+
+namespace hpx::traits {
+
+    template <typename T>
+    struct is_bitwise_serializable<wrapped<T>> : std::true_type
+    {
+    };
+}    // namespace hpx::traits
+
+static_assert(!std::is_trivially_copyable_v<point>);
+static_assert(hpx::traits::is_bitwise_serializable_v<point>);
+static_assert(!hpx::traits::is_bitwise_serializable_v<padded_point>);
+static_assert(!hpx::traits::is_bitwise_serializable_v<named_point>);
+static_assert(hpx::traits::is_bitwise_serializable_v<segment>);
+static_assert(hpx::traits::is_bitwise_serializable_v<wrapped<double>>);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void test_vector(std::vector<T> const& values, std::size_t element_size)
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+
+    std::size_t const start = oarchive.bytes_written();
+    oarchive << values;
+
+    // bitwise serialization stores the elements as they are, member-wise
+    // serialization stores every integer as 64 bit value
+    HPX_TEST_EQ(oarchive.bytes_written() - start,
+        sizeof(std::uint64_t) + values.size() * element_size);
+
+    std::vector<T> result;
+    hpx::serialization::input_archive iarchive(buffer);
+    iarchive >> result;
+
+    HPX_TEST(values == result);
+}
+
+void test_vectors()
+{
+    std::vector<point> points;
+    std::vector<padded_point> padded_points;
+    std::vector<named_point> named_points;
+    std::vector<segment> segments;
+
+    for (std::int32_t i = 0; i != 100; ++i)
+    {
+        points.push_back(point{tagged_value(i), i * 2});
+        padded_points.push_back(padded_point{tagged_value(i), i * 0.5});
+        named_points.push_back(named_point{tagged_value(i), std::to_string(i)});
+        segments.push_back(segment{points.back(), point{tagged_value(-i), i}});
+    }
+
+    test_vector(points, sizeof(point));
+    test_vector(padded_points, sizeof(std::int32_t) + sizeof(double));
+    test_vector(segments, sizeof(segment));
+
+    {
+        std::vector<char> buffer;
+        hpx::serialization::output_archive oarchive(buffer);
+        oarchive << named_points;
+
+        std::vector<named_point> result;
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> result;
+
+        HPX_TEST(named_points == result);
+    }
+}
+
+void test_array()
+{
+    std::array<point, 10> values;
+    for (std::int32_t i = 0; i != 10; ++i)
+    {
+        values[i] = point{tagged_value(i), -i};
+    }
+
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+
+    std::size_t const start = oarchive.bytes_written();
+    oarchive << values;
+
+    HPX_TEST_EQ(
+        oarchive.bytes_written() - start, values.size() * sizeof(point));
+
+    std::array<point, 10> result;
+    hpx::serialization::input_archive iarchive(buffer);
+    iarchive >> result;
+
+    HPX_TEST(values == result);
+}
+
+void test_map()
+{
+    std::map<std::int32_t, segment> values;
+    for (std::int32_t i = 0; i != 10; ++i)
+    {
+        values[i] =
+            segment{point{tagged_value(i), i}, point{tagged_value(-i), i}};
+    }
+
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+
+    std::size_t const start = oarchive.bytes_written();
+    oarchive << values;
+
+    using value_type = std::map<std::int32_t, segment>::value_type;
+    HPX_TEST_EQ(oarchive.bytes_written() - start,
+        sizeof(std::uint64_t) + values.size() * sizeof(value_type));
+
+    std::map<std::int32_t, segment> result;
+    hpx::serialization::input_archive iarchive(buffer);
+    iarchive >> result;
+
+    HPX_TEST(values == result);
+}
+
+int main()
+{
+    test_vectors();
+    test_array();
+    test_map();
+
+    return hpx::util::report_errors();
+}
@@ -1,4 +1,5 @@
 //  Copyright (c) 2019-2024 Hartmut Kaiser
+//  Copyright (c) 2024 The STE||AR-Group
 //
 //  SPDX-License-Identifier: BSL-1.0
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
@@ -10,14 +11,20 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/thread_support.hpp>
 #include <hpx/synchronization/spinlock.hpp>
+#include <hpx/type_support/construct_at.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace hpx::lcos::local {
@@ -209,11 +216,627 @@ namespace hpx::lcos::local {
     };
 
     ////////////////////////////////////////////////////////////////////////////
-    // For use with HPX threads, the channel_mpmc defined here is the fastest
-    // (even faster than the channel_spsc). Using hpx::util::spinlock as the
-    // means of synchronization enables the use of this channel with non-HPX
-    // threads, however the performance degrades by a factor of ten compared to
-    // using hpx::spinlock.
+    // A lock-free implementation of the bounded channel concept supporting
+    // multiple producers and multiple consumers. Each element of the
+    // ring-buffer carries a sequence number telling whether it is ready to be
+    // written or to be read (see D. Vyukov, "Bounded MPMC queue", available
+    // at https://www.1024cores.net).
+    // Producers and consumers synchronize only on the head or the tail index,
+    // respectively, which avoids the contention on a single lock caused by
+    // many concurrent producers. The ring-buffer is rounded up to the next
+    // power of two (at least two), while the number of buffered elements is
+    // bounded by the requested capacity.
     template <typename T>
-    using channel_mpmc = bounded_channel<T, hpx::spinlock>;
+    class lockfree_bounded_channel
+    {
+    private:
+        struct cell
+        {
+            std::atomic<std::size_t> sequence_;
+            T data_;
+        };
+
+        [[nodiscard]] static constexpr std::size_t round_up_size(
+            std::size_t size) noexcept
+        {
+            std::size_t result = 2;
+            while (result < size)
+            {
+                result *= 2;
+            }
+            return result;
+        }
+
+        [[nodiscard]] static constexpr std::ptrdiff_t distance(
+            std::size_t sequence, std::size_t pos) noexcept
+        {
+            return static_cast<std::ptrdiff_t>(sequence - pos);
+        }
+
+    public:
+        explicit lockfree_bounded_channel(std::size_t size)
+          : mask_(round_up_size(size) - 1)
+          , capacity_(size)
+          , buffer_(new cell[mask_ + 1])
+          , closed_(false)
+        {
+            HPX_ASSERT(size != 0);
+
+            for (std::size_t i = 0; i != mask_ + 1; ++i)
+            {
+                buffer_[i].sequence_.store(i, std::memory_order_relaxed);
+            }
+
+            head_.data_.store(0, std::memory_order_relaxed);
+            tail_.data_.store(0, std::memory_order_release);
+        }
+
+        lockfree_bounded_channel(lockfree_bounded_channel const& rhs) = delete;
+        lockfree_bounded_channel& operator=(
+            lockfree_bounded_channel const& rhs) = delete;
+
+        // moving a channel is not thread-safe
+        lockfree_bounded_channel(lockfree_bounded_channel&& rhs) noexcept
+          : mask_(rhs.mask_)
+          , capacity_(rhs.capacity_)
+          , buffer_(HPX_MOVE(rhs.buffer_))
+          , closed_(rhs.closed_.load(std::memory_order_relaxed))
+        {
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+
+            rhs.mask_ = 0;
+            rhs.capacity_ = 0;
+            rhs.closed_.store(true, std::memory_order_relaxed);
+        }
+
+        lockfree_bounded_channel& operator=(
+            lockfree_bounded_channel&& rhs) noexcept
+        {
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            mask_ = rhs.mask_;
+            capacity_ = rhs.capacity_;
+            buffer_ = HPX_MOVE(rhs.buffer_);
+            closed_.store(rhs.closed_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+
+            rhs.mask_ = 0;
+            rhs.capacity_ = 0;
+            rhs.closed_.store(true, std::memory_order_relaxed);
+            return *this;
+        }
+
+        ~lockfree_bounded_channel() = default;
+
+        [[nodiscard]] bool is_empty() const noexcept
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return true;
+            }
+
+            std::size_t const pos =
+                head_.data_.load(std::memory_order_relaxed);
+            return distance(buffer_[pos & mask_].sequence_.load(
+                                std::memory_order_acquire),
+                       pos + 1) < 0;
+        }
+
+        bool get(T* val = nullptr) const noexcept
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            std::size_t pos = head_.data_.load(std::memory_order_relaxed);
+            while (true)
+            {
+                cell& c = buffer_[pos & mask_];
+                std::ptrdiff_t const diff = distance(
+                    c.sequence_.load(std::memory_order_acquire), pos + 1);
+
+                if (diff == 0)
+                {
+                    if (val == nullptr)
+                    {
+                        return true;
+                    }
+
+                    if (head_.data_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        *val = HPX_MOVE(c.data_);
+                        c.sequence_.store(
+                            pos + mask_ + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // channel is empty
+                }
+                else
+                {
+                    pos = head_.data_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool set(T&& t) noexcept(std::is_nothrow_move_assignable_v<T>)
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            std::size_t pos = tail_.data_.load(std::memory_order_relaxed);
+            while (true)
+            {
+                cell& c = buffer_[pos & mask_];
+                std::ptrdiff_t const diff = distance(
+                    c.sequence_.load(std::memory_order_acquire), pos);
+
+                if (diff == 0)
+                {
+                    // the head index read here may be outdated, which can
+                    // only make the channel appear to be full
+                    if (pos - head_.data_.load(std::memory_order_acquire) >=
+                        capacity_)
+                    {
+                        return false;    // channel is full
+                    }
+
+                    if (tail_.data_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        c.data_ = HPX_MOVE(t);
+                        c.sequence_.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // channel is full
+                }
+                else
+                {
+                    pos = tail_.data_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::size_t close()
+        {
+            if (closed_.exchange(true, std::memory_order_acq_rel))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "hpx::lcos::local::lockfree_bounded_channel::close",
+                    "attempting to close an already closed channel");
+            }
+            return 0;
+        }
+
+        [[nodiscard]] constexpr std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+    private:
+        // keep the head and the tail index in separate cache lines
+        mutable hpx::util::cache_aligned_data<std::atomic<std::size_t>> head_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> tail_;
+
+        std::size_t mask_;
+
+        // the maximal number of buffered elements, at most mask_ + 1
+        std::size_t capacity_;
+
+        // channel buffer
+        std::unique_ptr<cell[]> buffer_;
+
+        // this channel was closed, i.e. no further operations are possible
+        std::atomic<bool> closed_;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // A lock-free channel without an upper bound for the number of buffered
+    // elements, supporting multiple producers and multiple consumers. The data
+    // is stored in a linked list of fixed size segments, each of which is
+    // released by the consumer reading its last element (the algorithm
+    // follows the SegQueue of the Rust crossbeam library). Setting a value
+    // fails only if the channel was closed.
+    template <typename T>
+    class lockfree_unbounded_channel
+    {
+    private:
+        static_assert(std::is_nothrow_move_constructible_v<T>,
+            "lockfree_unbounded_channel requires nothrow move constructible "
+            "elements");
+
+        // state of a slot
+        static constexpr std::size_t write = 1;
+        static constexpr std::size_t read = 2;
+        static constexpr std::size_t destroy = 4;
+
+        // each segment holds lap - 1 elements, the last index of a lap marks
+        // the transition to the next segment
+        static constexpr std::size_t lap = 32;
+        static constexpr std::size_t segment_size = lap - 1;
+
+        // the lowest bit of the head index tells whether the segment
+        // following the current head segment was already installed
+        static constexpr std::size_t shift = 1;
+        static constexpr std::size_t has_next = 1;
+
+        struct slot
+        {
+            slot() noexcept
+              : state_(0)
+            {
+            }
+
+            T* get() noexcept
+            {
+                return std::launder(reinterpret_cast<T*>(&data_));
+            }
+
+            void wait_write() const noexcept
+            {
+                for (std::size_t k = 0;
+                     (state_.load(std::memory_order_acquire) & write) == 0; ++k)
+                {
+                    hpx::execution_base::this_thread::yield_k(k % 16,
+                        "hpx::lcos::local::lockfree_unbounded_channel::get");
+                }
+            }
+
+            std::atomic<std::size_t> state_;
+            alignas(T) unsigned char data_[sizeof(T)];
+        };
+
+        struct segment
+        {
+            segment() noexcept
+              : next_(nullptr)
+            {
+            }
+
+            segment* wait_next() const noexcept
+            {
+                for (std::size_t k = 0;; ++k)
+                {
+                    segment* next = next_.load(std::memory_order_acquire);
+                    if (next != nullptr)
+                    {
+                        return next;
+                    }
+                    hpx::execution_base::this_thread::yield_k(k % 16,
+                        "hpx::lcos::local::lockfree_unbounded_channel::get");
+                }
+            }
+
+            // Release the given segment once all elements starting at 'start'
+            // were read. If an element is still being read its reader will
+            // release the segment instead.
+            static void release(segment* s, std::size_t start) noexcept
+            {
+                for (std::size_t i = start; i != segment_size - 1; ++i)
+                {
+                    slot& sl = s->slots_[i];
+                    if ((sl.state_.load(std::memory_order_acquire) & read) ==
+                            0 &&
+                        (sl.state_.fetch_or(
+                             destroy, std::memory_order_acq_rel) &
+                            read) == 0)
+                    {
+                        return;
+                    }
+                }
+                delete s;
+            }
+
+            std::atomic<segment*> next_;
+            slot slots_[segment_size];
+        };
+
+        struct position
+        {
+            position() noexcept
+              : index_(0)
+              , segment_(nullptr)
+            {
+            }
+
+            std::atomic<std::size_t> index_;
+            std::atomic<segment*> segment_;
+        };
+
+        static void backoff(std::size_t& k) noexcept
+        {
+            hpx::execution_base::this_thread::yield_k(
+                k++ % 16, "hpx::lcos::local::lockfree_unbounded_channel");
+        }
+
+    public:
+        lockfree_unbounded_channel() noexcept
+          : closed_(false)
+        {
+        }
+
+        lockfree_unbounded_channel(
+            lockfree_unbounded_channel const& rhs) = delete;
+        lockfree_unbounded_channel(lockfree_unbounded_channel&& rhs) = delete;
+        lockfree_unbounded_channel& operator=(
+            lockfree_unbounded_channel const& rhs) = delete;
+        lockfree_unbounded_channel& operator=(
+            lockfree_unbounded_channel&& rhs) = delete;
+
+        ~lockfree_unbounded_channel()
+        {
+            std::size_t head =
+                head_.data_.index_.load(std::memory_order_relaxed) &
+                ~has_next;
+            std::size_t const tail =
+                tail_.data_.index_.load(std::memory_order_relaxed) &
+                ~has_next;
+            segment* s = head_.data_.segment_.load(std::memory_order_relaxed);
+
+            // destroy all remaining elements and release all segments
+            while (head != tail)
+            {
+                std::size_t const offset = (head >> shift) % lap;
+                if (offset < segment_size)
+                {
+                    std::destroy_at(s->slots_[offset].get());
+                }
+                else
+                {
+                    segment* next = s->next_.load(std::memory_order_relaxed);
+                    delete s;
+                    s = next;
+                }
+                head += std::size_t(1) << shift;
+            }
+
+            delete s;
+        }
+
+        [[nodiscard]] bool is_empty() const noexcept
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return true;
+            }
+
+            std::size_t const head =
+                head_.data_.index_.load(std::memory_order_seq_cst);
+            std::size_t const tail =
+                tail_.data_.index_.load(std::memory_order_seq_cst);
+            return (head >> shift) == (tail >> shift);
+        }
+
+        bool get(T* val = nullptr) noexcept(
+            std::is_nothrow_move_assignable_v<T>)
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            if (val == nullptr)
+            {
+                return !is_empty();
+            }
+
+            std::size_t k = 0;
+            std::size_t head =
+                head_.data_.index_.load(std::memory_order_acquire);
+            segment* s = head_.data_.segment_.load(std::memory_order_acquire);
+
+            while (true)
+            {
+                std::size_t const offset = (head >> shift) % lap;
+
+                // wait for the next segment to be installed
+                if (offset == segment_size)
+                {
+                    backoff(k);
+                    head = head_.data_.index_.load(std::memory_order_acquire);
+                    s = head_.data_.segment_.load(std::memory_order_acquire);
+                    continue;
+                }
+
+                std::size_t new_head = head + (std::size_t(1) << shift);
+                if ((new_head & has_next) == 0)
+                {
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    std::size_t const tail =
+                        tail_.data_.index_.load(std::memory_order_relaxed);
+
+                    if ((head >> shift) == (tail >> shift))
+                    {
+                        return false;    // channel is empty
+                    }
+
+                    // head and tail are in different segments
+                    if ((head >> shift) / lap != (tail >> shift) / lap)
+                    {
+                        new_head |= has_next;
+                    }
+                }
+
+                // the first segment is being installed
+                if (s == nullptr)
+                {
+                    backoff(k);
+                    head = head_.data_.index_.load(std::memory_order_acquire);
+                    s = head_.data_.segment_.load(std::memory_order_acquire);
+                    continue;
+                }
+
+                if (head_.data_.index_.compare_exchange_weak(head, new_head,
+                        std::memory_order_seq_cst, std::memory_order_acquire))
+                {
+                    // move the head to the next segment
+                    if (offset + 1 == segment_size)
+                    {
+                        segment* next = s->wait_next();
+                        std::size_t next_index = (new_head & ~has_next) +
+                            (std::size_t(1) << shift);
+                        if (next->next_.load(std::memory_order_relaxed) !=
+                            nullptr)
+                        {
+                            next_index |= has_next;
+                        }
+
+                        head_.data_.segment_.store(
+                            next, std::memory_order_release);
+                        head_.data_.index_.store(
+                            next_index, std::memory_order_release);
+                    }
+
+                    slot& sl = s->slots_[offset];
+                    sl.wait_write();
+
+                    T* data = sl.get();
+                    *val = HPX_MOVE(*data);
+                    std::destroy_at(data);
+
+                    // release the segment if all of its elements were read
+                    if (offset + 1 == segment_size)
+                    {
+                        segment::release(s, 0);
+                    }
+                    else if ((sl.state_.fetch_or(
+                                  read, std::memory_order_acq_rel) &
+                                 destroy) != 0)
+                    {
+                        segment::release(s, offset + 1);
+                    }
+                    return true;
+                }
+
+                s = head_.data_.segment_.load(std::memory_order_acquire);
+                backoff(k);
+            }
+        }
+
+        bool set(T&& t)
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            std::size_t k = 0;
+            std::size_t tail =
+                tail_.data_.index_.load(std::memory_order_acquire);
+            segment* s = tail_.data_.segment_.load(std::memory_order_acquire);
+            std::unique_ptr<segment> next_segment;
+
+            while (true)
+            {
+                std::size_t const offset = (tail >> shift) % lap;
+
+                // wait for the next segment to be installed
+                if (offset == segment_size)
+                {
+                    backoff(k);
+                    tail = tail_.data_.index_.load(std::memory_order_acquire);
+                    s = tail_.data_.segment_.load(std::memory_order_acquire);
+                    continue;
+                }
+
+                // allocate the next segment ahead of time if we are about to
+                // fill the last slot of the current one
+                if (offset + 1 == segment_size && !next_segment)
+                {
+                    next_segment = std::make_unique<segment>();
+                }
+
+                // install the first segment
+                if (s == nullptr)
+                {
+                    auto first = std::make_unique<segment>();
+                    if (tail_.data_.segment_.compare_exchange_strong(s,
+                            first.get(), std::memory_order_release,
+                            std::memory_order_relaxed))
+                    {
+                        s = first.release();
+                        head_.data_.segment_.store(
+                            s, std::memory_order_release);
+                    }
+                    else
+                    {
+                        next_segment = HPX_MOVE(first);
+                        tail =
+                            tail_.data_.index_.load(std::memory_order_acquire);
+                        s = tail_.data_.segment_.load(
+                            std::memory_order_acquire);
+                        continue;
+                    }
+                }
+
+                std::size_t const new_tail = tail + (std::size_t(1) << shift);
+                if (tail_.data_.index_.compare_exchange_weak(tail, new_tail,
+                        std::memory_order_seq_cst, std::memory_order_acquire))
+                {
+                    // install the next segment
+                    if (offset + 1 == segment_size)
+                    {
+                        HPX_ASSERT(next_segment);
+                        segment* next = next_segment.release();
+
+                        tail_.data_.segment_.store(
+                            next, std::memory_order_release);
+                        tail_.data_.index_.store(
+                            new_tail + (std::size_t(1) << shift),
+                            std::memory_order_release);
+                        s->next_.store(next, std::memory_order_release);
+                    }
+
+                    slot& sl = s->slots_[offset];
+                    hpx::construct_at(
+                        reinterpret_cast<T*>(&sl.data_), HPX_MOVE(t));
+                    sl.state_.fetch_or(write, std::memory_order_release);
+                    return true;
+                }
+
+                s = tail_.data_.segment_.load(std::memory_order_acquire);
+                backoff(k);
+            }
+        }
+
+        std::size_t close()
+        {
+            if (closed_.exchange(true, std::memory_order_acq_rel))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "hpx::lcos::local::lockfree_unbounded_channel::close",
+                    "attempting to close an already closed channel");
+            }
+            return 0;
+        }
+
+    private:
+        // keep the head and the tail in separate cache lines
+        hpx::util::cache_aligned_data<position> head_;
+        hpx::util::cache_aligned_data<position> tail_;
+
+        // this channel was closed, i.e. no further operations are possible
+        std::atomic<bool> closed_;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // The channel_mpmc defined here is lock-free and can be used with HPX
+    // threads as well as with non-HPX threads. The mutex based bounded_channel
+    // is still available for use with a particular lock type.
+    template <typename T>
+    using channel_mpmc = lockfree_bounded_channel<T>;
 }    // namespace hpx::lcos::local
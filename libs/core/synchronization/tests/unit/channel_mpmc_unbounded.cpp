@@ -0,0 +1,156 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t NUM_PRODUCERS = 8;
+constexpr std::size_t NUM_CONSUMERS = 8;
+constexpr std::size_t NUM_ITEMS = 10000;
+
+///////////////////////////////////////////////////////////////////////////////
+void produce(hpx::lcos::local::lockfree_unbounded_channel<std::size_t>& c,
+    std::size_t producer)
+{
+    for (std::size_t i = 0; i != NUM_ITEMS; ++i)
+    {
+        HPX_TEST(c.set(producer * NUM_ITEMS + i));
+    }
+}
+
+void consume(hpx::lcos::local::lockfree_unbounded_channel<std::size_t>& c,
+    std::vector<std::atomic<int>>& received, std::atomic<std::size_t>& count)
+{
+    std::size_t value = 0;
+    while (count.load() != NUM_PRODUCERS * NUM_ITEMS)
+    {
+        if (c.get(&value))
+        {
+            ++received[value];
+            ++count;
+        }
+        else
+        {
+            hpx::this_thread::yield();
+        }
+    }
+}
+
+void test_multiple_producers_consumers()
+{
+    hpx::lcos::local::lockfree_unbounded_channel<std::size_t> c;
+
+    std::vector<std::atomic<int>> received(NUM_PRODUCERS * NUM_ITEMS);
+    std::atomic<std::size_t> count(0);
+
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t i = 0; i != NUM_CONSUMERS; ++i)
+    {
+        tasks.push_back(hpx::async(
+            &consume, std::ref(c), std::ref(received), std::ref(count)));
+    }
+    for (std::size_t i = 0; i != NUM_PRODUCERS; ++i)
+    {
+        tasks.push_back(hpx::async(&produce, std::ref(c), i));
+    }
+
+    hpx::wait_all(tasks);
+
+    // every item must have been received exactly once
+    for (auto const& r : received)
+    {
+        HPX_TEST_EQ(r.load(), 1);
+    }
+    HPX_TEST(c.is_empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_fifo_order()
+{
+    hpx::lcos::local::lockfree_unbounded_channel<std::unique_ptr<std::string>>
+        c;
+
+    // spans multiple segments
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST(c.set(std::make_unique<std::string>(std::to_string(i))));
+    }
+
+    std::unique_ptr<std::string> value;
+    for (int i = 0; i != 50; ++i)
+    {
+        HPX_TEST(c.get(&value));
+        HPX_TEST_EQ(*value, std::to_string(i));
+    }
+
+    // the remaining items are destroyed with the channel
+    HPX_TEST(!c.is_empty());
+    c.close();
+
+    HPX_TEST(!c.get(&value));
+    HPX_TEST(!c.set(std::make_unique<std::string>()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bounded()
+{
+    // the requested capacity is kept exactly, even if it is not a power of
+    // two
+    for (std::size_t capacity : {1, 3, 4})
+    {
+        hpx::lcos::local::channel_mpmc<int> c(capacity);
+        HPX_TEST_EQ(c.capacity(), capacity);
+
+        for (int i = 0; i != int(capacity); ++i)
+        {
+            HPX_TEST(c.set(int(i)));
+        }
+        HPX_TEST(!c.set(int(capacity)));
+
+        int value = 0;
+        HPX_TEST(c.get(&value));
+        HPX_TEST_EQ(value, 0);
+
+        // a freed slot can be reused
+        HPX_TEST(c.set(int(capacity)));
+        HPX_TEST(!c.set(int(capacity) + 1));
+
+        for (int i = 1; i != int(capacity) + 1; ++i)
+        {
+            HPX_TEST(c.get(&value));
+            HPX_TEST_EQ(value, i);
+        }
+        HPX_TEST(!c.get(&value));
+        HPX_TEST(c.is_empty());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_multiple_producers_consumers();
+    test_fifo_order();
+    test_bounded();
+
+    hpx::local::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
@@ -232,6 +232,38 @@ namespace hpx::threads::detail {
             return sched_->Scheduler::get_queue_length(num_thread);
         }
 
+        std::int64_t get_timer_wheel_occupancy(
+            std::size_t num_thread, bool /* reset */) override
+        {
+            return sched_->Scheduler::get_timer_wheel_occupancy(num_thread);
+        }
+
+        std::int64_t get_thread_recycler_cross_queue_reuses(
+            std::size_t /* num_thread */, bool reset) override
+        {
+            return sched_->Scheduler::get_thread_recycler_cross_queue_reuses(
+                reset);
+        }
+
+        std::int64_t get_thread_recycler_objects_freed(
+            std::size_t /* num_thread */, bool reset) override
+        {
+            return sched_->Scheduler::get_thread_recycler_objects_freed(reset);
+        }
+
+        std::int64_t get_threads_run_to_completion(
+            std::size_t num_thread, bool reset) override
+        {
+            return sched_->Scheduler::get_threads_run_to_completion(
+                num_thread, reset);
+        }
+
+        std::int64_t get_threads_promoted(
+            std::size_t num_thread, bool reset) override
+        {
+            return sched_->Scheduler::get_threads_promoted(num_thread, reset);
+        }
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::int64_t get_average_thread_wait_time(
             std::size_t num_thread, bool /* reset */) override
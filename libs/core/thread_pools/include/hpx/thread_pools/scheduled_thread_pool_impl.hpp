@@ -20,6 +20,7 @@
 #include <hpx/thread_pools/scheduling_loop.hpp>
 #include <hpx/threading_base/create_thread.hpp>
 #include <hpx/threading_base/create_work.hpp>
+#include <hpx/threading_base/memory_arena.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
@@ -65,10 +66,15 @@ namespace hpx::threads::detail {
             pool.notifier_.on_start_thread(local_thread_num_,
                 global_thread_num_, pool_.get_pool_id().name().c_str(), "");
             pool.sched_->Scheduler::on_start_thread(local_thread_num_);
+
+            // allocations on this thread are served by the arena of the pool
+            memory_arena::set_current(&pool.get_memory_arena());
         }
 
         ~init_tss_helper()
         {
+            memory_arena::set_current(nullptr);
+
             pool_.sched_->Scheduler::on_stop_thread(local_thread_num_);
             pool_.notifier_.on_stop_thread(local_thread_num_,
                 global_thread_num_, pool_.get_pool_id().name().c_str(), "");
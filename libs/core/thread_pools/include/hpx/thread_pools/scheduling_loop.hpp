@@ -143,6 +143,12 @@ namespace hpx::threads::detail {
             thread_id_ref_type thrd = HPX_MOVE(next_thrd);
             next_thrd = thread_id_ref_type();
 
+            // wake up HPX threads whose timed suspension has expired
+            if (scheduler.process_timers(num_thread) != 0)
+            {
+                idle_loop_count = 0;
+            }
+
             // Get the next HPX thread from the queue
             bool running = this_state.load(std::memory_order_relaxed) <
                 hpx::state::pre_sleep;
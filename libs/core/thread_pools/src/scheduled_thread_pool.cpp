@@ -12,6 +12,7 @@
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
 #include <hpx/schedulers/local_workrequesting_scheduler.hpp>
 #endif
+#include <hpx/schedulers/local_workstealing_scheduler.hpp>
 #include <hpx/schedulers/shared_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/static_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/static_queue_scheduler.hpp>
@@ -53,6 +54,9 @@ template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
 template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::shared_priority_queue_scheduler<>>;
 
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_workstealing_scheduler<>>;
+
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
 template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::local_workrequesting_scheduler<>>;
@@ -0,0 +1,46 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_queue_init_parameters.hpp>
+
+#include <cstddef>
+
+namespace hpx::threads::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Record the stack usage (in bytes) sampled for a thread with the given
+    // description (see HPX_COROUTINES_WITH_STACK_USAGE_SAMPLING).
+    HPX_CORE_EXPORT void record_stack_usage(
+        thread_description const& desc, std::size_t usage) noexcept;
+
+    // Return the largest stack usage recorded for threads with the given
+    // description, or zero if nothing was recorded yet.
+    HPX_CORE_EXPORT std::size_t get_recorded_stack_usage(
+        thread_description const& desc) noexcept;
+
+    // Return the smallest stack size class that was large enough for all
+    // threads with the given description sampled so far. Threads without any
+    // recorded stack usage are given a small stack.
+    HPX_CORE_EXPORT thread_stacksize get_automatic_stacksize(
+        thread_description const& desc,
+        policies::thread_queue_init_parameters const& params) noexcept;
+
+    // Resolve thread_stacksize::current and thread_stacksize::automatic into
+    // the stack size class to use for a new thread with the given
+    // description. All schedulers call this before selecting a stack.
+    HPX_CORE_EXPORT thread_stacksize resolve_stacksize(
+        thread_stacksize stacksize, thread_description const& desc,
+        policies::thread_queue_init_parameters const& params) noexcept;
+
+    HPX_CORE_EXPORT void resolve_stacksize(thread_init_data& data,
+        policies::thread_queue_init_parameters const& params) noexcept;
+}    // namespace hpx::threads::detail
@@ -0,0 +1,64 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/coroutine.hpp>
+#include <hpx/coroutines/thread_id_type.hpp>
+#include <hpx/threading_base/execution_agent.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <cstddef>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A coroutine (including its stack) used to run threads optimistically
+    // (see scheduler_mode::optimistic_stackless). Every worker thread keeps a
+    // small number of idle carriers. A thread borrows a carrier when it is
+    // run for the first time and returns it once it has terminated. A thread
+    // suspending while running on a carrier keeps it until it terminates,
+    // the worker thread uses a different carrier in the meantime.
+    struct thread_carrier
+    {
+        thread_carrier(coroutine_type::functor_type&& f, thread_id_type id,
+            std::ptrdiff_t stacksize)
+          : stacksize_(stacksize)
+          , coroutine_(HPX_MOVE(f), HPX_MOVE(id), stacksize)
+          , agent_(coroutine_.impl())
+        {
+        }
+
+        thread_carrier(thread_carrier const&) = delete;
+        thread_carrier(thread_carrier&&) = delete;
+        thread_carrier& operator=(thread_carrier const&) = delete;
+        thread_carrier& operator=(thread_carrier&&) = delete;
+
+        ~thread_carrier() = default;
+
+        std::ptrdiff_t stacksize_;
+        coroutine_type coroutine_;
+        execution_agent agent_;
+    };
+
+    // Take an idle carrier with the given stack size from the carriers kept
+    // by the current worker thread (or create a new one) and bind it to the
+    // given function.
+    HPX_CORE_EXPORT thread_carrier* acquire_thread_carrier(
+        coroutine_type::functor_type&& f, thread_id_type id,
+        std::ptrdiff_t stacksize);
+
+    // Give a carrier whose function has terminated back to the current worker
+    // thread, the carrier is destroyed if the worker keeps enough carriers
+    // already.
+    HPX_CORE_EXPORT void release_thread_carrier(
+        thread_carrier* carrier) noexcept;
+}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
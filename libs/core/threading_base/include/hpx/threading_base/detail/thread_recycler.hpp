@@ -0,0 +1,140 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/stack.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A store for terminated thread objects (including their stacks) shared
+    // by all thread queues of a scheduler. Every queue keeps a small number
+    // of terminated thread objects for reuse. Queues holding more than that
+    // hand them over to the recycler in batches, queues running out of
+    // thread objects take whole batches from the recycler before allocating
+    // new ones. This keeps the memory used for thread objects bounded if
+    // threads are created on different cores than they terminate on.
+    //
+    // The recycler holds one lock-free stack of batches for each kind of
+    // stack size (as distinguished by the queues). Thread objects that do
+    // not fit into the recycler anymore are destroyed.
+    class HPX_CORE_EXPORT thread_recycler
+    {
+    public:
+        // number of thread objects moved between queues in one go
+        static constexpr std::size_t batch_size = 32;
+
+        // number of thread objects a queue keeps before handing them over
+        static constexpr std::size_t max_local_threads = 2 * batch_size;
+
+        // small, medium, large, huge, and no stack
+        static constexpr std::size_t num_heaps = 5;
+
+        struct batch
+        {
+            std::size_t size = 0;
+            thread_id_type threads[batch_size];
+        };
+
+        explicit thread_recycler(std::int64_t max_recycled_threads);
+
+        thread_recycler(thread_recycler const&) = delete;
+        thread_recycler(thread_recycler&&) = delete;
+        thread_recycler& operator=(thread_recycler const&) = delete;
+        thread_recycler& operator=(thread_recycler&&) = delete;
+
+        // destroys all thread objects still held
+        ~thread_recycler();
+
+        // Move a batch of thread objects from the end of the given heap of a
+        // queue into the recycler. The thread objects are destroyed if the
+        // recycler is full.
+        template <typename Heap>
+        void put(std::size_t heap_num, Heap& heap)
+        {
+            batch* b = allocate_batch();
+            while (b->size != batch_size && !heap.empty())
+            {
+                b->threads[b->size++] = heap.back();
+                heap.pop_back();
+            }
+            put(heap_num, b);
+        }
+
+        // Move a batch of thread objects from the recycler to the given heap
+        // of a queue, returns false if no thread objects are available.
+        template <typename Heap>
+        bool get(std::size_t heap_num, Heap& heap)
+        {
+            batch* b = get(heap_num);
+            if (b == nullptr)
+            {
+                return false;
+            }
+
+            for (std::size_t i = 0; i != b->size; ++i)
+            {
+                heap.push_back(b->threads[i]);
+            }
+            deallocate_batch(b);
+            return true;
+        }
+
+        // Record that a thread object has been reused by a different queue
+        // than the one it was last used by.
+        void count_cross_queue_reuse() noexcept
+        {
+            cross_queue_reuses_.data_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // return the number of thread objects currently held
+        [[nodiscard]] std::int64_t size() const noexcept
+        {
+            return count_.data_.load(std::memory_order_relaxed);
+        }
+
+        // return the number of thread objects reused by a different queue
+        [[nodiscard]] std::int64_t get_cross_queue_reuses(bool reset) noexcept;
+
+        // return the number of thread objects destroyed as the recycler was
+        // full
+        [[nodiscard]] std::int64_t get_objects_freed(bool reset) noexcept;
+
+    private:
+        using batches_type = hpx::lockfree::stack<batch*>;
+
+        static batch* allocate_batch();
+        static void deallocate_batch(batch* b) noexcept;
+
+        void put(std::size_t heap_num, batch* b);
+        batch* get(std::size_t heap_num) noexcept;
+
+        std::int64_t const max_recycled_threads_;
+
+        std::array<batches_type, num_heaps> batches_;
+
+        // number of thread objects currently held (including those in
+        // batches being added or removed)
+        hpx::util::cache_line_data<std::atomic<std::int64_t>> count_;
+
+        hpx::util::cache_line_data<std::atomic<std::int64_t>>
+            cross_queue_reuses_;
+        hpx::util::cache_line_data<std::atomic<std::int64_t>> objects_freed_;
+    };
+}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
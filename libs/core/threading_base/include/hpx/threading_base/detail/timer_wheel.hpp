@@ -0,0 +1,169 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads::detail {
+
+    class timer_wheel;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // An entry of a timer_wheel. Entries are intrusive and are owned by the
+    // party arming the timer (usually an HPX thread that suspends itself for
+    // a limited amount of time), which avoids any allocation when arming or
+    // disarming a timer.
+    struct timer_wheel_entry
+    {
+        enum class entry_state : std::uint8_t
+        {
+            idle = 0,
+            armed = 1,
+            firing = 2,
+            fired = 3,
+            cancelled = 4
+        };
+
+        timer_wheel_entry(thread_id_type thrd, thread_schedule_state newstate,
+            thread_restart_state newstate_ex, thread_priority priority) noexcept
+          : thrd_(thrd)
+          , newstate_(newstate)
+          , newstate_ex_(newstate_ex)
+          , priority_(priority)
+        {
+        }
+
+        timer_wheel_entry(timer_wheel_entry const&) = delete;
+        timer_wheel_entry(timer_wheel_entry&&) = delete;
+        timer_wheel_entry& operator=(timer_wheel_entry const&) = delete;
+        timer_wheel_entry& operator=(timer_wheel_entry&&) = delete;
+
+        ~timer_wheel_entry() = default;
+
+        entry_state get_state() const noexcept
+        {
+            return state_.load(std::memory_order_acquire);
+        }
+
+        // the thread (and its new state) to set once the timer expires
+        thread_id_type thrd_;
+        thread_schedule_state newstate_;
+        thread_restart_state newstate_ex_;
+        thread_priority priority_;
+
+    private:
+        friend class timer_wheel;
+
+        std::uint64_t expiry_tick_ = 0;
+        timer_wheel_entry* next_ = nullptr;
+        timer_wheel_entry** pprev_ = nullptr;
+        timer_wheel* wheel_ = nullptr;
+        std::uint8_t level_ = 0;
+        std::atomic<entry_state> state_{entry_state::idle};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A hierarchical timer wheel (see Varghese and Lauck, "Hashed and
+    // Hierarchical Timing Wheels") used to wake up HPX threads whose timed
+    // suspension has expired. Each worker thread of a scheduler owns one
+    // wheel, which is advanced from the scheduling loop. Arming and
+    // cancelling a timer is O(1), advancing the wheel is amortized O(1) per
+    // elapsed tick.
+    class HPX_CORE_EXPORT timer_wheel
+    {
+    public:
+        static constexpr std::size_t slot_bits = 6;
+        static constexpr std::size_t num_slots = std::size_t(1) << slot_bits;
+        static constexpr std::size_t num_levels = 4;
+
+        using clock_type = std::chrono::steady_clock;
+
+        explicit timer_wheel(clock_type::duration resolution);
+
+        timer_wheel(timer_wheel const&) = delete;
+        timer_wheel(timer_wheel&&) = delete;
+        timer_wheel& operator=(timer_wheel const&) = delete;
+        timer_wheel& operator=(timer_wheel&&) = delete;
+
+        ~timer_wheel() = default;
+
+        // Arm the given entry such that it expires at the given point in
+        // time. The entry must stay valid until cancel() has returned.
+        void add(timer_wheel_entry& e, clock_type::time_point abs_time);
+
+        // Disarm the given entry. Returns true if the entry was removed
+        // before it expired. Otherwise, this waits for the expiration to be
+        // completely handled and returns false.
+        static bool cancel(timer_wheel_entry& e);
+
+        // Handle all entries that have expired, returns the number of
+        // entries that have fired.
+        std::size_t process(clock_type::time_point now);
+        std::size_t process()
+        {
+            if (empty())
+            {
+                return 0;
+            }
+            return process(clock_type::now());
+        }
+
+        // Return the number of armed entries
+        std::size_t size() const noexcept
+        {
+            return count_.load(std::memory_order_relaxed);
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        constexpr clock_type::duration resolution() const noexcept
+        {
+            return resolution_;
+        }
+
+    private:
+        std::uint64_t to_tick(
+            clock_type::time_point t, bool round_up) const noexcept;
+
+        void insert(timer_wheel_entry& e) noexcept;
+        static void unlink(timer_wheel_entry& e) noexcept;
+        void cascade(std::size_t level, std::size_t slot) noexcept;
+
+        static void fire(timer_wheel_entry& e) noexcept;
+
+        using mutex_type = hpx::util::detail::spinlock;
+
+        mutable mutex_type mtx_;
+
+        clock_type::time_point const origin_;
+        clock_type::duration const resolution_;
+
+        // all ticks up to (and including) this one have been processed
+        std::atomic<std::uint64_t> current_tick_;
+        std::atomic<std::size_t> count_;
+
+        std::array<std::size_t, num_levels> level_count_;
+        std::array<std::array<timer_wheel_entry*, num_slots>, num_levels>
+            slots_;
+    };
+}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
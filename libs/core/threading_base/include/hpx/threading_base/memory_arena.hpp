@@ -0,0 +1,221 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A memory arena handing out memory which is bound to a set of NUMA
+    /// domains. Every thread pool owns one arena bound to the NUMA domains of
+    /// its processing units, the worker threads of the pool use it as their
+    /// current arena (see \a get_current).
+    ///
+    /// Small blocks are taken from per size class free lists which are
+    /// refilled from larger slabs, larger blocks are allocated directly. Every
+    /// block records the arena it was taken from, blocks are always returned
+    /// to their own arena, independently of the thread releasing them.
+    class HPX_CORE_EXPORT memory_arena
+    {
+    public:
+        // largest alignment supported for allocations
+        static constexpr std::size_t max_alignment = 2048;
+
+        explicit memory_arena(hwloc_bitmap_ptr nodeset = hwloc_bitmap_ptr());
+
+        memory_arena(memory_arena const&) = delete;
+        memory_arena(memory_arena&&) = delete;
+        memory_arena& operator=(memory_arena const&) = delete;
+        memory_arena& operator=(memory_arena&&) = delete;
+
+        /// Allocate at least \a size bytes aligned to \a alignment.
+        ///
+        /// \throws std::bad_alloc if no memory could be allocated.
+        [[nodiscard]] void* allocate(std::size_t size,
+            std::size_t alignment = alignof(std::max_align_t));
+
+        /// Release memory previously allocated from any arena.
+        static void deallocate(void* p) noexcept;
+
+        /// Return the arena the given memory has been allocated from.
+        [[nodiscard]] static memory_arena* get_arena(void const* p) noexcept;
+
+        /// Give up ownership of the arena. The arena is destroyed as soon as
+        /// all memory allocated from it has been released.
+        void release() noexcept;
+
+        /// Return the number of bytes currently allocated from this arena
+        /// (including internal overheads).
+        [[nodiscard]] std::int64_t get_bytes_in_use() const noexcept;
+
+        /// Return the number of blocks of this arena released on threads
+        /// using a different arena as their current arena.
+        [[nodiscard]] std::int64_t get_cross_arena_deallocations(
+            bool reset) noexcept;
+
+        /// Return the arena used by the current thread. This is the arena of
+        /// the thread pool the current thread belongs to or a process-wide
+        /// arena not bound to any NUMA domain for other threads.
+        [[nodiscard]] static memory_arena& get_current() noexcept;
+
+        /// \cond NOINTERNAL
+        static void set_current(memory_arena* arena) noexcept;
+        /// \endcond
+
+    private:
+        ~memory_arena();
+
+        struct block_header;
+        struct free_block;
+
+        struct size_class
+        {
+            hpx::util::detail::spinlock mtx;
+            free_block* free_list = nullptr;
+        };
+
+        static constexpr std::size_t num_size_classes = 9;
+
+        void* allocate_slab(std::size_t size);
+        void* allocate_large(std::size_t size, std::size_t alignment);
+        void deallocate_block(void* block, block_header const& header) noexcept;
+
+        hwloc_bitmap_ptr nodeset_;
+
+        std::array<hpx::util::cache_aligned_data<size_class>, num_size_classes>
+            size_classes_;
+
+        // all slabs owned by this arena, released on destruction
+        hpx::util::detail::spinlock slabs_mtx_;
+        std::vector<void*> slabs_;
+
+        // Bytes currently allocated from this arena plus one while the arena
+        // is owned, the arena is destroyed once this drops to zero.
+        hpx::util::cache_line_data<std::atomic<std::int64_t>> in_use_;
+        hpx::util::cache_line_data<std::atomic<std::int64_t>>
+            cross_arena_deallocations_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A standard allocator taking memory from a memory_arena, by default
+    /// from the arena of the thread pool of the thread performing the
+    /// allocation. Memory can be released from any thread, it is always
+    /// returned to the arena it was allocated from.
+    template <typename T = char>
+    class pool_arena_allocator
+    {
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = T const*;
+        using reference = T&;
+        using const_reference = T const&;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = pool_arena_allocator<U>;
+        };
+
+        // memory can be released using any instance
+        using is_always_equal = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        constexpr pool_arena_allocator() noexcept = default;
+
+        constexpr explicit pool_arena_allocator(memory_arena& arena) noexcept
+          : arena_(&arena)
+        {
+        }
+
+        template <typename U>
+        constexpr explicit pool_arena_allocator(
+            pool_arena_allocator<U> const& rhs) noexcept
+          : arena_(rhs.arena_)
+        {
+        }
+
+        [[nodiscard]] pointer allocate(size_type n, void const* = nullptr)
+        {
+            if (max_size() < n)
+            {
+                throw std::bad_array_new_length();
+            }
+
+            memory_arena& arena =
+                arena_ != nullptr ? *arena_ : memory_arena::get_current();
+            return static_cast<pointer>(
+                arena.allocate(n * sizeof(T), alignof(T)));
+        }
+
+        static void deallocate(pointer p, size_type) noexcept
+        {
+            memory_arena::deallocate(p);
+        }
+
+        // Return whether the given memory has been allocated from the arena
+        // this allocator takes its memory from on the current thread. This
+        // prevents caching allocators from keeping memory of other arenas.
+        [[nodiscard]] bool is_local(void const* p) const noexcept
+        {
+            memory_arena const& arena =
+                arena_ != nullptr ? *arena_ : memory_arena::get_current();
+            return memory_arena::get_arena(p) == &arena;
+        }
+
+        [[nodiscard]] static constexpr size_type max_size() noexcept
+        {
+            return (std::numeric_limits<size_type>::max)() / sizeof(T);
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(
+            pool_arena_allocator const&, pool_arena_allocator const&) noexcept
+        {
+            return true;
+        }
+
+        [[nodiscard]] friend constexpr bool operator!=(
+            pool_arena_allocator const&, pool_arena_allocator const&) noexcept
+        {
+            return false;
+        }
+
+    private:
+        template <typename>
+        friend class pool_arena_allocator;
+
+        memory_arena* arena_ = nullptr;
+    };
+
+    namespace detail {
+
+        // Return the arena of the thread pool the given scheduler belongs to
+        // or the current arena if there is none.
+        HPX_CORE_EXPORT memory_arena& get_memory_arena(
+            policies::scheduler_base* scheduler) noexcept;
+    }    // namespace detail
+}    // namespace hpx::threads
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -12,6 +12,8 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/threading_base/detail/thread_recycler.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -24,6 +26,7 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
@@ -271,6 +274,73 @@ namespace hpx::threads::policies {
         detail::polling_status custom_polling_function() const;
         std::size_t get_polling_work_count() const;
 
+        ///////////////////////////////////////////////////////////////////////
+        // support for timed suspension of HPX threads, each worker thread
+        // owns a timer wheel that is advanced from the scheduling loop
+
+        // Arm the given timer on the wheel of the given worker thread,
+        // returns false if timer wheels are disabled for this scheduler
+        bool add_timer(std::size_t num_thread,
+            threads::detail::timer_wheel_entry& e,
+            std::chrono::steady_clock::time_point abs_time);
+
+        // Wake up all threads whose timers on the given worker thread have
+        // expired, returns the number of threads woken up. The timers of
+        // suspended worker threads are handled by the running ones.
+        std::size_t process_timers(std::size_t num_thread)
+        {
+            if (num_thread >= timer_wheels_.size())
+            {
+                return 0;
+            }
+
+            std::size_t num_fired = timer_wheels_[num_thread]->process();
+            if (suspended_timer_wheels_.load(std::memory_order_relaxed) != 0)
+            {
+                num_fired += process_suspended_timers();
+            }
+            return num_fired;
+        }
+
+        bool has_timer_wheels() const noexcept
+        {
+            return !timer_wheels_.empty();
+        }
+
+        // return the number of armed timers for the given worker thread (or
+        // all worker threads)
+        std::int64_t get_timer_wheel_occupancy(
+            std::size_t num_thread = static_cast<std::size_t>(-1)) const;
+
+        ///////////////////////////////////////////////////////////////////////
+        // terminated thread objects shared between the queues of this
+        // scheduler for reuse
+        threads::detail::thread_recycler& get_thread_recycler() noexcept
+        {
+            return thread_recycler_;
+        }
+
+        std::int64_t get_thread_recycler_cross_queue_reuses(bool reset) noexcept
+        {
+            return thread_recycler_.get_cross_queue_reuses(reset);
+        }
+
+        std::int64_t get_thread_recycler_objects_freed(bool reset) noexcept
+        {
+            return thread_recycler_.get_objects_freed(reset);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // threads run with scheduler_mode::optimistic_stackless which either
+        // ran to completion or were promoted to a stackful thread
+        void count_optimistic_thread(
+            std::size_t num_thread, bool promoted) noexcept;
+
+        std::int64_t get_threads_run_to_completion(
+            std::size_t num_thread, bool reset) noexcept;
+        std::int64_t get_threads_promoted(
+            std::size_t num_thread, bool reset) noexcept;
+
         // almost all schedulers support direct execution
         virtual bool supports_direct_execution() const noexcept
         {
@@ -278,6 +348,9 @@ namespace hpx::threads::policies {
         }
 
     protected:
+        // handle the expired timers of all suspended worker threads
+        std::size_t process_suspended_timers();
+
         // the scheduler mode, protected from false sharing
         util::cache_line_data<std::atomic<scheduler_mode>> mode_;
 
@@ -302,8 +375,25 @@ namespace hpx::threads::policies {
         std::vector<util::cache_line_data<std::atomic<hpx::state>>> states_;
         char const* description_;
 
+        // one timer wheel per worker thread (empty if disabled)
+        std::vector<std::unique_ptr<threads::detail::timer_wheel>>
+            timer_wheels_;
+
+        // number of suspended worker threads owning a timer wheel
+        std::atomic<std::size_t> suspended_timer_wheels_;
+
         thread_queue_init_parameters thread_queue_init_;
 
+        threads::detail::thread_recycler thread_recycler_;
+
+        struct optimistic_thread_counts
+        {
+            std::atomic<std::int64_t> run_to_completion_{0};
+            std::atomic<std::int64_t> promoted_{0};
+        };
+        std::vector<util::cache_line_data<optimistic_thread_counts>>
+            optimistic_thread_counts_;
+
         // the pool that owns this scheduler
         threads::thread_pool_base* parent_pool_;
 
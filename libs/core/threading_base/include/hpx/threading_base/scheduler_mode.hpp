@@ -80,6 +80,16 @@ namespace hpx::threads::policies {
         /// 'normal' work scheduling is performed.
         do_background_work_only = 0x1000,
 
+        /// This option tells the scheduler to run threads optimistically on a
+        /// stack owned by the worker thread until they suspend for the first
+        /// time. Threads running to completion without ever suspending never
+        /// need a stack of their own, all other threads are promoted to a
+        /// stackful thread at their first suspension (they keep the stack
+        /// they have been started on). This does not avoid any context
+        /// switches, the borrowed stack is the stack of a coroutine cached
+        /// by the worker thread (experimental).
+        optimistic_stackless = 0x2000,
+
         // clang-format off
         /// This option represents the default mode.
         default_ =
@@ -106,7 +116,8 @@ namespace hpx::threads::policies {
             steal_high_priority_first |
             steal_after_local |
             enable_idle_backoff |
-            do_background_work_only
+            do_background_work_only |
+            optimistic_stackless
         // clang-format on
     };
 
@@ -533,6 +533,13 @@ namespace hpx::threads {
             return *static_cast<ThreadQueue*>(queue_);
         }
 
+        // terminated thread objects may be handed over to a different queue
+        // of the same scheduler for reuse
+        void set_queue(void* queue) noexcept
+        {
+            queue_ = queue;
+        }
+
         /// \brief Execute the thread function
         ///
         /// \returns        This function returns the thread state the thread
@@ -11,9 +11,14 @@
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/config/defines.hpp>
 #include <hpx/coroutines/thread_id_type.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/config/defines.hpp>
+#include <hpx/threading_base/detail/stack_usage.hpp>
+#include <hpx/threading_base/detail/thread_carrier.hpp>
 #include <hpx/threading_base/execution_agent.hpp>
+#include <hpx/threading_base/memory_arena.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/type_support/construct_at.hpp>
@@ -63,9 +68,30 @@ namespace hpx::threads {
             HPX_ASSERT(get_state().state() == thread_schedule_state::active);
             HPX_ASSERT(this == coroutine_.get_thread_id().get());
 
+            if (runs_optimistically_)
+            {
+                return call_optimistically(agent_storage);
+            }
+
             hpx::execution_base::this_thread::reset_agent ctx(
                 agent_storage, agent_);
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+            coroutine_type::result_type result =
+                coroutine_(set_state_ex(thread_restart_state::signaled));
+
+            if (result.first == thread_schedule_state::terminated)
+            {
+                if (std::ptrdiff_t const usage = coroutine_.get_stack_usage();
+                    usage > 0)
+                {
+                    detail::record_stack_usage(this->get_description(),
+                        static_cast<std::size_t>(usage));
+                }
+            }
+            return result;
+#else
             return coroutine_(set_state_ex(thread_restart_state::signaled));
+#endif
         }
 
         HPX_FORCEINLINE coroutine_type::result_type invoke_directly()
@@ -149,9 +175,13 @@ namespace hpx::threads {
 
         void rebind(thread_init_data& init_data) override
         {
+            HPX_ASSERT(carrier_ == nullptr);
+
             this->thread_data::rebind_base(init_data);
 
             coroutine_.rebind(HPX_MOVE(init_data.func), thread_id_type(this));
+            runs_optimistically_ =
+                should_run_optimistically(get_scheduler_base());
 
             HPX_ASSERT(coroutine_.is_ready());
         }
@@ -162,6 +192,8 @@ namespace hpx::threads {
           , coroutine_(
                 HPX_MOVE(init_data.func), thread_id_type(this_()), stacksize)
           , agent_(coroutine_.impl())
+          , runs_optimistically_(
+                should_run_optimistically(get_scheduler_base()))
         {
             HPX_ASSERT(coroutine_.is_ready());
         }
@@ -180,19 +212,45 @@ namespace hpx::threads {
         void destroy() noexcept override
         {
             std::destroy_at(this);
+#if defined(HPX_THREADING_BASE_HAVE_POOL_ARENAS)
+            memory_arena::deallocate(this);
+#else
             thread_alloc_.deallocate(this, 1);
+#endif
         }
 
     private:
+        // Threads created while the scheduler is in the mode
+        // scheduler_mode::optimistic_stackless are run on a carrier borrowed
+        // from the worker thread instead of on their own stack.
+        static bool should_run_optimistically(
+            policies::scheduler_base* scheduler) noexcept;
+
+        coroutine_type::result_type call_optimistically(
+            hpx::execution_base::this_thread::detail::agent_storage*
+                agent_storage);
+
         coroutine_type coroutine_;
         execution_agent agent_;
+
+        // the carrier this thread is running on (if any)
+        detail::thread_carrier* carrier_ = nullptr;
+        bool runs_optimistically_;
     };
 
     ////////////////////////////////////////////////////////////////////////////
     inline thread_data* thread_data_stackful::create(thread_init_data& data,
         void* queue, std::ptrdiff_t stacksize, thread_id_addref addref)
     {
+#if defined(HPX_THREADING_BASE_HAVE_POOL_ARENAS)
+        // allocate the thread object close to the cores it will run on
+        auto* p = static_cast<thread_data_stackful*>(
+            detail::get_memory_arena(data.scheduler_base)
+                .allocate(sizeof(thread_data_stackful),
+                    alignof(thread_data_stackful)));
+#else
         thread_data_stackful* p = thread_alloc_.allocate(1);
+#endif
         hpx::construct_at(p, data, queue, stacksize, addref);
         return p;
     }
@@ -14,6 +14,8 @@
 #include <hpx/coroutines/stackless_coroutine.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/config/defines.hpp>
+#include <hpx/threading_base/memory_arena.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/type_support/construct_at.hpp>
@@ -154,7 +156,11 @@ namespace hpx::threads {
         void destroy() noexcept override
         {
             std::destroy_at(this);
+#if defined(HPX_THREADING_BASE_HAVE_POOL_ARENAS)
+            memory_arena::deallocate(this);
+#else
             thread_alloc_.deallocate(this, 1);
+#endif
         }
 
     private:
@@ -165,7 +171,15 @@ namespace hpx::threads {
     inline thread_data* thread_data_stackless::create(thread_init_data& data,
         void* queue, std::ptrdiff_t stacksize, thread_id_addref addref)
     {
+#if defined(HPX_THREADING_BASE_HAVE_POOL_ARENAS)
+        // allocate the thread object close to the cores it will run on
+        auto* p = static_cast<thread_data_stackless*>(
+            detail::get_memory_arena(data.scheduler_base)
+                .allocate(sizeof(thread_data_stackless),
+                    alignof(thread_data_stackless)));
+#else
         thread_data_stackless* p = thread_alloc_.allocate(1);
+#endif
         hpx::construct_at(p, data, queue, stacksize, addref);
         return p;
     }
@@ -13,6 +13,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/threading_base/callback_notifier.hpp>
 #include <hpx/threading_base/detail/get_default_pool.hpp>
+#include <hpx/threading_base/memory_arena.hpp>
 #include <hpx/threading_base/network_background_callback.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
@@ -119,7 +120,7 @@ namespace hpx::threads {
         thread_pool_base& operator=(thread_pool_base const&) = delete;
         thread_pool_base& operator=(thread_pool_base&&) = delete;
 
-        virtual ~thread_pool_base() = default;
+        virtual ~thread_pool_base();
 
         virtual void init(std::size_t num_threads, std::size_t threads_offset);
 
@@ -237,6 +238,13 @@ namespace hpx::threads {
 
         hwloc_bitmap_ptr get_numa_domain_bitmap() const;
 
+        // The memory arena of this pool, it is bound to the NUMA domains of
+        // the processing units the pool was created for.
+        [[nodiscard]] memory_arena& get_memory_arena() const noexcept
+        {
+            return *arena_;
+        }
+
         // performance counters
 #if defined(HPX_HAVE_THREAD_CUMULATIVE_COUNTS)
         virtual std::int64_t get_executed_threads(
@@ -352,6 +360,38 @@ namespace hpx::threads {
             return 0;
         }
 
+        virtual std::int64_t get_timer_wheel_occupancy(std::size_t, bool)
+        {
+            return 0;
+        }
+
+        virtual std::int64_t get_thread_recycler_cross_queue_reuses(
+            std::size_t, bool)
+        {
+            return 0;
+        }
+
+        virtual std::int64_t get_thread_recycler_objects_freed(
+            std::size_t, bool)
+        {
+            return 0;
+        }
+
+        virtual std::int64_t get_threads_run_to_completion(std::size_t, bool)
+        {
+            return 0;
+        }
+
+        virtual std::int64_t get_threads_promoted(std::size_t, bool)
+        {
+            return 0;
+        }
+
+        std::int64_t get_arena_bytes_in_use(
+            std::size_t num_thread, bool reset);
+        std::int64_t get_arena_cross_deallocations(
+            std::size_t num_thread, bool reset);
+
 #if defined(HPX_HAVE_THREAD_QUEUE_WAITTIME)
         virtual std::int64_t get_average_thread_wait_time(
             std::size_t /*thread_num*/, bool /*reset*/)
@@ -496,6 +536,9 @@ namespace hpx::threads {
 
         // callback functions to invoke at start, stop, and error
         threads::policies::callback_notifier& notifier_;
+
+        // memory arena of this pool, released on destruction
+        memory_arena* arena_;
         /// \endcond
     };
 
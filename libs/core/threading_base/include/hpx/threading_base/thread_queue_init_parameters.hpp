@@ -42,7 +42,11 @@ namespace hpx::threads::policies {
             std::ptrdiff_t small_stacksize = HPX_SMALL_STACK_SIZE,
             std::ptrdiff_t medium_stacksize = HPX_MEDIUM_STACK_SIZE,
             std::ptrdiff_t large_stacksize = HPX_LARGE_STACK_SIZE,
-            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE) noexcept
+            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE,
+            std::int64_t timer_wheel_resolution = static_cast<std::int64_t>(
+                HPX_TIMER_WHEEL_RESOLUTION),
+            std::int64_t max_recycled_threads = static_cast<std::int64_t>(
+                HPX_THREAD_QUEUE_MAX_RECYCLED_THREADS)) noexcept
           : max_thread_count_(max_thread_count)
           , min_tasks_to_steal_pending_(min_tasks_to_steal_pending)
           , min_tasks_to_steal_staged_(min_tasks_to_steal_staged)
@@ -58,6 +62,8 @@ namespace hpx::threads::policies {
           , large_stacksize_(large_stacksize)
           , huge_stacksize_(huge_stacksize)
           , nostack_stacksize_((std::numeric_limits<std::ptrdiff_t>::max)())
+          , timer_wheel_resolution_(timer_wheel_resolution)
+          , max_recycled_threads_(max_recycled_threads)
         {
         }
 
@@ -76,5 +82,7 @@ namespace hpx::threads::policies {
         std::ptrdiff_t const large_stacksize_;
         std::ptrdiff_t const huge_stacksize_;
         std::ptrdiff_t const nostack_stacksize_;
+        std::int64_t timer_wheel_resolution_;    // in microseconds
+        std::int64_t max_recycled_threads_;
     };
 }    // namespace hpx::threads::policies
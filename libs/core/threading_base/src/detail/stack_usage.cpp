@@ -0,0 +1,201 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/threading_base/detail/stack_usage.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_queue_init_parameters.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::threads::detail {
+
+    namespace {
+
+        // The recorded stack usage is kept in a fixed size open addressing
+        // hash table, which allows for lock-free lookups while creating new
+        // threads. Descriptions that don't fit into the table anymore are
+        // simply not recorded.
+        constexpr std::size_t table_bits = 12;
+        constexpr std::size_t table_size = std::size_t(1) << table_bits;
+        constexpr std::size_t max_probes = 16;
+
+        struct stack_usage_entry
+        {
+            std::atomic<std::size_t> key{0};
+            std::atomic<std::size_t> usage{0};
+        };
+
+        std::array<stack_usage_entry, table_size> stack_usage_table;
+
+        std::size_t get_key(thread_description const& desc) noexcept
+        {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            if (!desc.valid())
+            {
+                return 0;
+            }
+            if (desc.kind() == thread_description::data_type_description)
+            {
+                return reinterpret_cast<std::size_t>(desc.get_description());
+            }
+            return desc.get_address();
+#else
+            // all threads share the same history
+            (void) desc;
+            return 1;
+#endif
+        }
+
+        std::size_t get_slot(std::size_t key) noexcept
+        {
+            // Fibonacci hashing
+            return static_cast<std::size_t>(
+                (static_cast<std::uint64_t>(key) * 0x9E3779B97F4A7C15ull) >>
+                (64 - table_bits));
+        }
+
+        stack_usage_entry* find_entry(std::size_t key, bool create) noexcept
+        {
+            std::size_t slot = get_slot(key);
+            for (std::size_t i = 0; i != max_probes; ++i)
+            {
+                stack_usage_entry& e = stack_usage_table[slot];
+
+                std::size_t current = e.key.load(std::memory_order_acquire);
+                if (current == key)
+                {
+                    return &e;
+                }
+                if (current == 0)
+                {
+                    if (!create)
+                    {
+                        return nullptr;
+                    }
+                    if (e.key.compare_exchange_strong(current, key,
+                            std::memory_order_acq_rel) ||
+                        current == key)
+                    {
+                        return &e;
+                    }
+                }
+                slot = (slot + 1) % table_size;
+            }
+            return nullptr;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void record_stack_usage(
+        thread_description const& desc, std::size_t usage) noexcept
+    {
+        std::size_t const key = get_key(desc);
+        if (key == 0)
+        {
+            return;
+        }
+
+        stack_usage_entry* e = find_entry(key, true);
+        if (e == nullptr)
+        {
+            return;
+        }
+
+        std::size_t current = e->usage.load(std::memory_order_relaxed);
+        while (current < usage &&
+            !e->usage.compare_exchange_weak(
+                current, usage, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    std::size_t get_recorded_stack_usage(
+        thread_description const& desc) noexcept
+    {
+        std::size_t const key = get_key(desc);
+        if (key == 0)
+        {
+            return 0;
+        }
+
+        stack_usage_entry const* e = find_entry(key, false);
+        return e != nullptr ? e->usage.load(std::memory_order_relaxed) : 0;
+    }
+
+    thread_stacksize get_automatic_stacksize(thread_description const& desc,
+        policies::thread_queue_init_parameters const& params) noexcept
+    {
+        std::size_t const recorded = get_recorded_stack_usage(desc);
+        if (recorded == 0)
+        {
+            return thread_stacksize::small_;
+        }
+
+        // leave some headroom as not all executions of a thread function
+        // have been sampled
+        std::size_t const usage = recorded + recorded / 4;
+
+        // a thread which has overrun the painted part of its stack is
+        // recorded as having used all of it, keep it at that size
+        auto const fits = [&](std::ptrdiff_t size) {
+            return usage <= static_cast<std::size_t>(size) ||
+                recorded == static_cast<std::size_t>(size);
+        };
+
+        if (fits(params.small_stacksize_))
+        {
+            return thread_stacksize::small_;
+        }
+        if (fits(params.medium_stacksize_))
+        {
+            return thread_stacksize::medium;
+        }
+        if (fits(params.large_stacksize_))
+        {
+            return thread_stacksize::large;
+        }
+        return thread_stacksize::huge;
+    }
+
+    thread_stacksize resolve_stacksize(thread_stacksize stacksize,
+        thread_description const& desc,
+        policies::thread_queue_init_parameters const& params) noexcept
+    {
+        if (stacksize == thread_stacksize::current)
+        {
+            stacksize = get_self_stacksize_enum();
+        }
+
+        if (stacksize == thread_stacksize::automatic)
+        {
+            stacksize = get_automatic_stacksize(desc, params);
+        }
+
+        HPX_ASSERT(stacksize != thread_stacksize::current &&
+            stacksize != thread_stacksize::automatic);
+        return stacksize;
+    }
+
+    void resolve_stacksize(thread_init_data& data,
+        policies::thread_queue_init_parameters const& params) noexcept
+    {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        data.stacksize =
+            resolve_stacksize(data.stacksize, data.description, params);
+#else
+        data.stacksize =
+            resolve_stacksize(data.stacksize, thread_description(), params);
+#endif
+    }
+}    // namespace hpx::threads::detail
@@ -0,0 +1,88 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/threading_base/detail/thread_carrier.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::detail {
+
+    namespace {
+
+        // number of idle carriers kept by each worker thread
+        constexpr std::size_t max_idle_carriers = 4;
+
+        struct idle_carriers
+        {
+            idle_carriers() = default;
+
+            idle_carriers(idle_carriers const&) = delete;
+            idle_carriers(idle_carriers&&) = delete;
+            idle_carriers& operator=(idle_carriers const&) = delete;
+            idle_carriers& operator=(idle_carriers&&) = delete;
+
+            ~idle_carriers()
+            {
+                for (thread_carrier* carrier : carriers_)
+                {
+                    delete carrier;
+                }
+            }
+
+            std::vector<thread_carrier*> carriers_;
+        };
+
+        idle_carriers& get_idle_carriers()
+        {
+            thread_local idle_carriers carriers;
+            return carriers;
+        }
+    }    // namespace
+
+    thread_carrier* acquire_thread_carrier(coroutine_type::functor_type&& f,
+        thread_id_type id, std::ptrdiff_t stacksize)
+    {
+        auto& carriers = get_idle_carriers().carriers_;
+
+        // prefer the most recently used carrier, its stack is likely to be
+        // still in the cache
+        for (auto it = carriers.rbegin(); it != carriers.rend(); ++it)
+        {
+            thread_carrier* carrier = *it;
+            if (carrier->stacksize_ == stacksize)
+            {
+                carriers.erase(std::next(it).base());
+                carrier->coroutine_.rebind(HPX_MOVE(f), HPX_MOVE(id));
+                return carrier;
+            }
+        }
+
+        return new thread_carrier(HPX_MOVE(f), HPX_MOVE(id), stacksize);
+    }
+
+    void release_thread_carrier(thread_carrier* carrier) noexcept
+    {
+        HPX_ASSERT(carrier != nullptr);
+
+        auto& carriers = get_idle_carriers().carriers_;
+        if (carriers.size() < max_idle_carriers)
+        {
+            carriers.reserve(max_idle_carriers);
+            carriers.push_back(carrier);
+            return;
+        }
+
+        // the oldest carrier is released first
+        delete carriers.front();
+        carriers.erase(carriers.begin());
+        carriers.push_back(carrier);
+    }
+}    // namespace hpx::threads::detail
@@ -0,0 +1,137 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/threading_base/detail/thread_recycler.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace hpx::threads::detail {
+
+    namespace {
+
+        util::internal_allocator<thread_recycler::batch> batch_alloc;
+
+        void destroy_threads(thread_recycler::batch const& b) noexcept
+        {
+            for (std::size_t i = 0; i != b.size; ++i)
+            {
+                get_thread_id_data(b.threads[i])->destroy();
+            }
+        }
+    }    // namespace
+
+    thread_recycler::thread_recycler(std::int64_t max_recycled_threads)
+      : max_recycled_threads_(max_recycled_threads)
+      , batches_{{batches_type(0), batches_type(0), batches_type(0),
+            batches_type(0), batches_type(0)}}
+    {
+        static_assert(num_heaps == 5);
+
+        count_.data_.store(0, std::memory_order_relaxed);
+        cross_queue_reuses_.data_.store(0, std::memory_order_relaxed);
+        objects_freed_.data_.store(0, std::memory_order_relaxed);
+    }
+
+    thread_recycler::~thread_recycler()
+    {
+        for (auto& batches : batches_)
+        {
+            batch* b = nullptr;
+            while (batches.pop(b))
+            {
+                destroy_threads(*b);
+                deallocate_batch(b);
+            }
+        }
+    }
+
+    thread_recycler::batch* thread_recycler::allocate_batch()
+    {
+        batch* b = batch_alloc.allocate(1);
+        ::new (b) batch();
+        return b;
+    }
+
+    void thread_recycler::deallocate_batch(batch* b) noexcept
+    {
+        std::destroy_at(b);
+        batch_alloc.deallocate(b, 1);
+    }
+
+    void thread_recycler::put(std::size_t heap_num, batch* b)
+    {
+        HPX_ASSERT(heap_num < num_heaps);
+
+        auto const size = static_cast<std::int64_t>(b->size);
+        if (size != 0 &&
+            count_.data_.fetch_add(size, std::memory_order_relaxed) + size <=
+                max_recycled_threads_)
+        {
+            bool pushed = false;
+            try
+            {
+                pushed = batches_[heap_num].push(b);
+            }
+            catch (...)
+            {
+                pushed = false;
+            }
+
+            if (pushed)
+            {
+                return;
+            }
+        }
+
+        // the recycler is full, release the thread objects
+        count_.data_.fetch_sub(size, std::memory_order_relaxed);
+        objects_freed_.data_.fetch_add(size, std::memory_order_relaxed);
+
+        destroy_threads(*b);
+        deallocate_batch(b);
+    }
+
+    thread_recycler::batch* thread_recycler::get(std::size_t heap_num) noexcept
+    {
+        HPX_ASSERT(heap_num < num_heaps);
+
+        batch* b = nullptr;
+        if (!batches_[heap_num].pop(b))
+        {
+            return nullptr;
+        }
+
+        count_.data_.fetch_sub(
+            static_cast<std::int64_t>(b->size), std::memory_order_relaxed);
+        return b;
+    }
+
+    std::int64_t thread_recycler::get_cross_queue_reuses(bool reset) noexcept
+    {
+        if (reset)
+        {
+            return cross_queue_reuses_.data_.exchange(
+                0, std::memory_order_relaxed);
+        }
+        return cross_queue_reuses_.data_.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t thread_recycler::get_objects_freed(bool reset) noexcept
+    {
+        if (reset)
+        {
+            return objects_freed_.data_.exchange(0, std::memory_order_relaxed);
+        }
+        return objects_freed_.data_.load(std::memory_order_relaxed);
+    }
+}    // namespace hpx::threads::detail
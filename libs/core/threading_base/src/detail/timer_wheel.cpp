@@ -0,0 +1,283 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+#include <hpx/threading_base/set_thread_state.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace hpx::threads::detail {
+
+    namespace {
+
+        constexpr std::uint64_t slot_mask = timer_wheel::num_slots - 1;
+
+        // number of ticks covered by all levels of the wheel
+        constexpr std::uint64_t max_delta =
+            (std::uint64_t(1) << (timer_wheel::slot_bits *
+                                     timer_wheel::num_levels)) -
+            1;
+    }    // namespace
+
+    timer_wheel::timer_wheel(clock_type::duration resolution)
+      : origin_(clock_type::now())
+      , resolution_((std::max)(resolution,
+            clock_type::duration(std::chrono::microseconds(1))))
+      , current_tick_(0)
+      , count_(0)
+      , level_count_{}
+      , slots_{}
+    {
+    }
+
+    std::uint64_t timer_wheel::to_tick(
+        clock_type::time_point t, bool round_up) const noexcept
+    {
+        if (t <= origin_)
+        {
+            return 0;
+        }
+
+        auto elapsed = t - origin_;
+        if (round_up)
+        {
+            elapsed += resolution_ - clock_type::duration(1);
+        }
+        return static_cast<std::uint64_t>(elapsed / resolution_);
+    }
+
+    void timer_wheel::insert(timer_wheel_entry& e) noexcept
+    {
+        std::uint64_t const current =
+            current_tick_.load(std::memory_order_relaxed);
+        HPX_ASSERT(e.expiry_tick_ >= current);
+
+        std::uint64_t tick = e.expiry_tick_;
+        std::uint64_t delta = tick - current;
+        if (delta > max_delta)
+        {
+            // park far-away timers in the outermost level, they will be
+            // re-inserted when that slot is cascaded
+            delta = max_delta;
+            tick = current + max_delta;
+        }
+
+        std::size_t level = 0;
+        while (level != num_levels - 1 &&
+            delta >= (std::uint64_t(1) << (slot_bits * (level + 1))))
+        {
+            ++level;
+        }
+
+        std::size_t const slot = (tick >> (slot_bits * level)) & slot_mask;
+
+        timer_wheel_entry*& head = slots_[level][slot];
+        e.next_ = head;
+        if (head != nullptr)
+        {
+            head->pprev_ = &e.next_;
+        }
+        head = &e;
+        e.pprev_ = &head;
+        e.level_ = static_cast<std::uint8_t>(level);
+
+        ++level_count_[level];
+    }
+
+    void timer_wheel::unlink(timer_wheel_entry& e) noexcept
+    {
+        HPX_ASSERT(e.pprev_ != nullptr);
+
+        *e.pprev_ = e.next_;
+        if (e.next_ != nullptr)
+        {
+            e.next_->pprev_ = e.pprev_;
+        }
+        e.next_ = nullptr;
+        e.pprev_ = nullptr;
+
+        --e.wheel_->level_count_[e.level_];
+    }
+
+    void timer_wheel::add(timer_wheel_entry& e, clock_type::time_point abs_time)
+    {
+        HPX_ASSERT(e.get_state() == timer_wheel_entry::entry_state::idle);
+
+        // round up, a timer must never fire early
+        std::uint64_t const tick = to_tick(abs_time, true);
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        std::uint64_t current = current_tick_.load(std::memory_order_relaxed);
+        if (count_.load(std::memory_order_relaxed) == 0)
+        {
+            // the wheel is not advanced while being empty, catch up now to
+            // avoid stepping through the idle period later on
+            current = (std::max)(current, to_tick(clock_type::now(), false));
+            current_tick_.store(current, std::memory_order_relaxed);
+        }
+
+        // timers that have already expired fire on the next tick
+        e.expiry_tick_ = (std::max)(tick, current + 1);
+        e.wheel_ = this;
+
+        insert(e);
+
+        e.state_.store(
+            timer_wheel_entry::entry_state::armed, std::memory_order_release);
+        count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool timer_wheel::cancel(timer_wheel_entry& e)
+    {
+        timer_wheel* wheel = e.wheel_;
+        if (wheel == nullptr)
+        {
+            return false;    // entry was never armed
+        }
+
+        {
+            std::lock_guard<mutex_type> l(wheel->mtx_);
+            if (e.state_.load(std::memory_order_relaxed) ==
+                timer_wheel_entry::entry_state::armed)
+            {
+                unlink(e);
+                e.state_.store(timer_wheel_entry::entry_state::cancelled,
+                    std::memory_order_relaxed);
+                wheel->count_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        // The timer has expired concurrently, wait for the wheel to finish
+        // handling the entry as it may still access it.
+        hpx::util::yield_while<false>(
+            [&e]() {
+                return e.get_state() !=
+                    timer_wheel_entry::entry_state::fired;
+            },
+            "timer_wheel::cancel");
+
+        return false;
+    }
+
+    void timer_wheel::cascade(std::size_t level, std::size_t slot) noexcept
+    {
+        timer_wheel_entry* e = slots_[level][slot];
+        slots_[level][slot] = nullptr;
+
+        while (e != nullptr)
+        {
+            timer_wheel_entry* next = e->next_;
+            --level_count_[level];
+            insert(*e);
+            e = next;
+        }
+    }
+
+    void timer_wheel::fire(timer_wheel_entry& e) noexcept
+    {
+        // The owner of the entry can't leave its suspension before the state
+        // of the entry has been set to 'fired' (see cancel() above), thus the
+        // thread id stays valid while setting the new thread state.
+        error_code ec(throwmode::lightweight);    // do not throw
+        detail::set_thread_state(e.thrd_, e.newstate_, e.newstate_ex_,
+            e.priority_, thread_schedule_hint(), false, ec);
+
+        // the entry must not be accessed anymore after this
+        e.state_.store(
+            timer_wheel_entry::entry_state::fired, std::memory_order_release);
+    }
+
+    std::size_t timer_wheel::process(clock_type::time_point now)
+    {
+        std::uint64_t const target = to_tick(now, false);
+        if (target <= current_tick_.load(std::memory_order_relaxed))
+        {
+            return 0;    // nothing has expired yet
+        }
+
+        timer_wheel_entry* expired = nullptr;
+        std::size_t num_expired = 0;
+
+        {
+            std::unique_lock<mutex_type> l(mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+            {
+                return 0;    // somebody else is currently using this wheel
+            }
+
+            std::uint64_t current =
+                current_tick_.load(std::memory_order_relaxed);
+            while (current < target)
+            {
+                current_tick_.store(++current, std::memory_order_relaxed);
+
+                // move the timers of the next slot of the outer levels
+                // inwards whenever an inner level has wrapped around
+                if ((current & slot_mask) == 0)
+                {
+                    for (std::size_t level = 1; level != num_levels; ++level)
+                    {
+                        std::size_t const slot =
+                            (current >> (slot_bits * level)) & slot_mask;
+                        cascade(level, slot);
+                        if (slot != 0)
+                        {
+                            break;
+                        }
+                    }
+                }
+
+                // collect all expired timers
+                timer_wheel_entry*& head = slots_[0][current & slot_mask];
+                while (head != nullptr)
+                {
+                    timer_wheel_entry* e = head;
+                    HPX_ASSERT(e->expiry_tick_ <= current);
+
+                    unlink(*e);
+                    e->state_.store(timer_wheel_entry::entry_state::firing,
+                        std::memory_order_relaxed);
+
+                    e->next_ = expired;
+                    expired = e;
+                    ++num_expired;
+                }
+
+                // skip ahead to the next wrap-around of the innermost level if
+                // there is nothing left to do in it
+                if (level_count_[0] == 0)
+                {
+                    current = (std::min)(current | slot_mask, target);
+                    current_tick_.store(current, std::memory_order_relaxed);
+                }
+            }
+
+            count_.fetch_sub(num_expired, std::memory_order_relaxed);
+        }
+
+        // wake up the threads outside of the lock
+        while (expired != nullptr)
+        {
+            timer_wheel_entry* next = expired->next_;
+            fire(*expired);
+            expired = next;
+        }
+
+        return num_expired;
+    }
+}    // namespace hpx::threads::detail
@@ -0,0 +1,342 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/threading_base/memory_arena.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace hpx::threads {
+
+    namespace {
+
+        // Small blocks are taken from size classes of 32 bytes up to 8KiB
+        // (powers of two), including the block header.
+        constexpr std::size_t min_block_size = 32;
+        constexpr std::size_t slab_size = 64 * 1024;
+
+        thread_local memory_arena* current_arena = nullptr;
+
+        constexpr bool is_power_of_two(std::size_t n) noexcept
+        {
+            return n != 0 && (n & (n - 1)) == 0;
+        }
+
+        constexpr std::size_t get_size_class(std::size_t size) noexcept
+        {
+            std::size_t size_class = 0;
+            for (std::size_t block_size = min_block_size; block_size < size;
+                 block_size *= 2)
+            {
+                ++size_class;
+            }
+            return size_class;
+        }
+
+        constexpr std::size_t get_block_size(std::size_t size_class) noexcept
+        {
+            return min_block_size << size_class;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every block handed out is immediately preceded by its header. The
+    // header identifies the arena and size class of the block, and the offset
+    // of the returned memory from the beginning of the block.
+    struct memory_arena::block_header
+    {
+        memory_arena* arena;
+        std::uint32_t offset;
+        std::uint32_t size_class;
+    };
+
+    struct memory_arena::free_block
+    {
+        free_block* next;
+    };
+
+    static_assert(sizeof(void*) <= 8 && alignof(std::max_align_t) <= 16,
+        "memory_arena assumes block headers of at most 16 bytes");
+
+    namespace {
+
+        constexpr std::size_t header_size = 16;
+
+        // large blocks additionally store their size at their beginning
+        constexpr std::size_t large_header_size = 32;
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    memory_arena::memory_arena(hwloc_bitmap_ptr nodeset)
+      : nodeset_(HPX_MOVE(nodeset))
+    {
+        in_use_.data_.store(1, std::memory_order_relaxed);
+        cross_arena_deallocations_.data_.store(0, std::memory_order_relaxed);
+    }
+
+    memory_arena::~memory_arena()
+    {
+        auto const& topo = create_topology();
+        for (void* slab : slabs_)
+        {
+            topo.deallocate(slab, slab_size);
+        }
+    }
+
+    void memory_arena::release() noexcept
+    {
+        if (in_use_.data_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete this;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* memory_arena::allocate_slab(std::size_t size)
+    {
+        auto const& topo = create_topology();
+
+        void* p = nullptr;
+        if (nodeset_)
+        {
+            p = topo.allocate_membind(
+                size, nodeset_, hpx_hwloc_membind_policy::membind_bind, 0);
+        }
+
+        // fall back to memory not bound to the NUMA domains of the arena
+        if (p == nullptr)
+        {
+            p = topo.allocate(size);
+            if (p == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+        }
+        return p;
+    }
+
+    void* memory_arena::allocate_large(std::size_t size, std::size_t alignment)
+    {
+        std::size_t const offset =
+            alignment < large_header_size ? large_header_size : alignment;
+        if (size > (std::numeric_limits<std::size_t>::max)() - offset)
+        {
+            throw std::bad_alloc();
+        }
+
+        std::size_t const block_size = offset + size;
+        void* block = allocate_slab(block_size);
+        *static_cast<std::size_t*>(block) = block_size;
+
+        in_use_.data_.fetch_add(static_cast<std::int64_t>(block_size),
+            std::memory_order_relaxed);
+
+        void* p = static_cast<char*>(block) + offset;
+        ::new (static_cast<char*>(p) - header_size) block_header{
+            this, static_cast<std::uint32_t>(offset), num_size_classes};
+        return p;
+    }
+
+    void* memory_arena::allocate(std::size_t size, std::size_t alignment)
+    {
+        if (!is_power_of_two(alignment) || alignment > max_alignment)
+        {
+            throw std::bad_alloc();
+        }
+
+        std::size_t const offset =
+            alignment < header_size ? header_size : alignment;
+        if (size > get_block_size(num_size_classes - 1) - offset)
+        {
+            return allocate_large(size, alignment);
+        }
+
+        std::size_t const size_class = get_size_class(offset + size);
+        std::size_t const block_size = get_block_size(size_class);
+        auto& sc = size_classes_[size_class].data_;
+
+        void* block = nullptr;
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(sc.mtx);
+            if (sc.free_list != nullptr)
+            {
+                block = sc.free_list;
+                sc.free_list = sc.free_list->next;
+            }
+        }
+
+        if (block == nullptr)
+        {
+            // carve a new slab into blocks of the requested size class, all
+            // blocks but the first are added to the free list
+            void* slab = allocate_slab(slab_size);
+            {
+                std::lock_guard<hpx::util::detail::spinlock> l(slabs_mtx_);
+                try
+                {
+                    slabs_.push_back(slab);
+                }
+                catch (...)
+                {
+                    create_topology().deallocate(slab, slab_size);
+                    throw;
+                }
+            }
+
+            char* first = static_cast<char*>(slab);
+            free_block* head = nullptr;
+            free_block* tail = nullptr;
+            for (char* p = first + slab_size - block_size; p != first;
+                 p -= block_size)
+            {
+                head = ::new (p) free_block{head};
+                if (tail == nullptr)
+                {
+                    tail = head;
+                }
+            }
+
+            if (head != nullptr)
+            {
+                std::lock_guard<hpx::util::detail::spinlock> l(sc.mtx);
+                tail->next = sc.free_list;
+                sc.free_list = head;
+            }
+            block = slab;
+        }
+
+        in_use_.data_.fetch_add(
+            static_cast<std::int64_t>(block_size), std::memory_order_relaxed);
+
+        void* p = static_cast<char*>(block) + offset;
+        ::new (static_cast<char*>(p) - header_size)
+            block_header{this, static_cast<std::uint32_t>(offset),
+                static_cast<std::uint32_t>(size_class)};
+        return p;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void memory_arena::deallocate_block(
+        void* block, block_header const& header) noexcept
+    {
+        std::int64_t block_size = 0;
+        if (header.size_class == num_size_classes)
+        {
+            block_size =
+                static_cast<std::int64_t>(*static_cast<std::size_t*>(block));
+            create_topology().deallocate(
+                block, static_cast<std::size_t>(block_size));
+        }
+        else
+        {
+            block_size =
+                static_cast<std::int64_t>(get_block_size(header.size_class));
+
+            auto& sc = size_classes_[header.size_class].data_;
+            std::lock_guard<hpx::util::detail::spinlock> l(sc.mtx);
+            sc.free_list = ::new (block) free_block{sc.free_list};
+        }
+
+        if (&get_current() != this)
+        {
+            cross_arena_deallocations_.data_.fetch_add(
+                1, std::memory_order_relaxed);
+        }
+
+        if (in_use_.data_.fetch_sub(block_size, std::memory_order_acq_rel) ==
+            block_size)
+        {
+            // the arena has been released by its owner before
+            delete this;
+        }
+    }
+
+    void memory_arena::deallocate(void* p) noexcept
+    {
+        if (p == nullptr)
+        {
+            return;
+        }
+
+        auto const* header = reinterpret_cast<block_header const*>(
+            static_cast<char*>(p) - header_size);
+        HPX_ASSERT(header->arena != nullptr);
+
+        block_header const h = *header;
+        h.arena->deallocate_block(static_cast<char*>(p) - h.offset, h);
+    }
+
+    memory_arena* memory_arena::get_arena(void const* p) noexcept
+    {
+        if (p == nullptr)
+        {
+            return nullptr;
+        }
+        return reinterpret_cast<block_header const*>(
+            static_cast<char const*>(p) - header_size)
+            ->arena;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t memory_arena::get_bytes_in_use() const noexcept
+    {
+        return in_use_.data_.load(std::memory_order_relaxed) - 1;
+    }
+
+    std::int64_t memory_arena::get_cross_arena_deallocations(
+        bool reset) noexcept
+    {
+        if (reset)
+        {
+            return cross_arena_deallocations_.data_.exchange(
+                0, std::memory_order_relaxed);
+        }
+        return cross_arena_deallocations_.data_.load(std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    memory_arena& memory_arena::get_current() noexcept
+    {
+        if (current_arena != nullptr)
+        {
+            return *current_arena;
+        }
+
+        // The process-wide arena is never destroyed as memory allocated from
+        // it may be released during static destruction.
+        static memory_arena* default_arena = new memory_arena();
+        return *default_arena;
+    }
+
+    void memory_arena::set_current(memory_arena* arena) noexcept
+    {
+        current_arena = arena;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        memory_arena& get_memory_arena(
+            policies::scheduler_base* scheduler) noexcept
+        {
+            if (scheduler != nullptr)
+            {
+                return scheduler->get_parent_pool()->get_memory_arena();
+            }
+            return memory_arena::get_current();
+        }
+    }    // namespace detail
+}    // namespace hpx::threads
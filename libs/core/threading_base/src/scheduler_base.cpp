@@ -7,6 +7,8 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/execution_base/this_thread.hpp>
+#include <hpx/threading_base/detail/stack_usage.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
@@ -44,7 +46,10 @@ namespace hpx::threads::policies {
       , pu_mtxs_(num_threads)
       , states_(num_threads)
       , description_(description)
+      , suspended_timer_wheels_(0)
       , thread_queue_init_(thread_queue_init)
+      , thread_recycler_(thread_queue_init.max_recycled_threads_)
+      , optimistic_thread_counts_(num_threads)
       , parent_pool_(nullptr)
       , background_thread_count_(0)
       , polling_function_mpi_(&null_polling_function)
@@ -69,6 +74,20 @@ namespace hpx::threads::policies {
 
         for (std::size_t i = 0; i != num_threads; ++i)
             states_[i].data_.store(hpx::state::initialized);
+
+        if (thread_queue_init.timer_wheel_resolution_ > 0)
+        {
+            std::chrono::microseconds const resolution(
+                thread_queue_init.timer_wheel_resolution_);
+
+            timer_wheels_.reserve(num_threads);
+            for (std::size_t i = 0; i != num_threads; ++i)
+            {
+                timer_wheels_.push_back(
+                    std::make_unique<threads::detail::timer_wheel>(
+                        resolution));
+            }
+        }
     }
 
     void scheduler_base::idle_callback([[maybe_unused]] std::size_t num_thread)
@@ -89,9 +108,22 @@ namespace hpx::threads::policies {
                 (std::min)(static_cast<double>(data.wait_count_),
                     static_cast<double>(max_exponent - 1));
 
-            std::chrono::milliseconds const period(std::lround((std::min)(
+            std::chrono::milliseconds period(std::lround((std::min)(
                 data.max_idle_backoff_time_, std::pow(2.0, exponent))));
 
+            // don't oversleep armed timers of this worker thread or of
+            // suspended worker threads
+            if (num_thread < timer_wheels_.size() &&
+                (!timer_wheels_[num_thread]->empty() ||
+                    suspended_timer_wheels_.load(std::memory_order_relaxed) !=
+                        0))
+            {
+                period = (std::min)(period,
+                    (std::max)(std::chrono::milliseconds(1),
+                        std::chrono::duration_cast<std::chrono::milliseconds>(
+                            timer_wheels_[num_thread]->resolution())));
+            }
+
             ++data.wait_count_;
 
             std::unique_lock<pu_mutex_type> l(mtx_);
@@ -123,10 +155,23 @@ namespace hpx::threads::policies {
     {
         HPX_ASSERT(num_thread < suspend_conds_.size());
 
+        // the timers armed on this worker thread are handled by the other
+        // worker threads while this one is suspended
+        bool const has_timer_wheel = num_thread < timer_wheels_.size();
+        if (has_timer_wheel)
+        {
+            ++suspended_timer_wheels_;
+        }
+
         states_[num_thread].data_.store(hpx::state::sleeping);
         std::unique_lock<pu_mutex_type> l(suspend_mtxs_[num_thread]);
         suspend_conds_[num_thread].wait(l);    //-V1089
 
+        if (has_timer_wheel)
+        {
+            --suspended_timer_wheels_;
+        }
+
         // Only set running if still in hpx::state::sleeping. Can be set with
         // non-blocking/locking functions to stopping or terminating, in which
         // case the state is left untouched.
@@ -249,6 +294,129 @@ namespace hpx::threads::policies {
         return num_thread;
     }
 
+    bool scheduler_base::add_timer(std::size_t num_thread,
+        threads::detail::timer_wheel_entry& e,
+        std::chrono::steady_clock::time_point abs_time)
+    {
+        if (num_thread >= timer_wheels_.size())
+        {
+            return false;
+        }
+
+        timer_wheels_[num_thread]->add(e, abs_time);
+        return true;
+    }
+
+    std::size_t scheduler_base::process_suspended_timers()
+    {
+        std::size_t num_fired = 0;
+        for (std::size_t i = 0; i != timer_wheels_.size(); ++i)
+        {
+            if (states_[i].data_.load(std::memory_order_relaxed) ==
+                hpx::state::sleeping)
+            {
+                num_fired += timer_wheels_[i]->process();
+            }
+        }
+        return num_fired;
+    }
+
+    std::int64_t scheduler_base::get_timer_wheel_occupancy(
+        std::size_t num_thread) const
+    {
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            if (num_thread >= timer_wheels_.size())
+            {
+                return 0;
+            }
+            return static_cast<std::int64_t>(timer_wheels_[num_thread]->size());
+        }
+
+        std::int64_t result = 0;
+        for (auto const& wheel : timer_wheels_)
+        {
+            result += static_cast<std::int64_t>(wheel->size());
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void scheduler_base::count_optimistic_thread(
+        std::size_t num_thread, bool promoted) noexcept
+    {
+        if (num_thread >= optimistic_thread_counts_.size())
+        {
+            num_thread = 0;
+        }
+
+        auto& counts = optimistic_thread_counts_[num_thread].data_;
+        if (promoted)
+        {
+            counts.promoted_.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            counts.run_to_completion_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    namespace {
+
+        std::int64_t get_count(
+            std::atomic<std::int64_t>& count, bool reset) noexcept
+        {
+            if (reset)
+            {
+                return count.exchange(0, std::memory_order_relaxed);
+            }
+            return count.load(std::memory_order_relaxed);
+        }
+    }    // namespace
+
+    std::int64_t scheduler_base::get_threads_run_to_completion(
+        std::size_t num_thread, bool reset) noexcept
+    {
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            if (num_thread >= optimistic_thread_counts_.size())
+            {
+                return 0;
+            }
+            return get_count(
+                optimistic_thread_counts_[num_thread].data_.run_to_completion_,
+                reset);
+        }
+
+        std::int64_t result = 0;
+        for (auto& counts : optimistic_thread_counts_)
+        {
+            result += get_count(counts.data_.run_to_completion_, reset);
+        }
+        return result;
+    }
+
+    std::int64_t scheduler_base::get_threads_promoted(
+        std::size_t num_thread, bool reset) noexcept
+    {
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            if (num_thread >= optimistic_thread_counts_.size())
+            {
+                return 0;
+            }
+            return get_count(
+                optimistic_thread_counts_[num_thread].data_.promoted_, reset);
+        }
+
+        std::int64_t result = 0;
+        for (auto& counts : optimistic_thread_counts_)
+        {
+            result += get_count(counts.data_.promoted_, reset);
+        }
+        return result;
+    }
+
     // allow to access/manipulate states
     std::atomic<hpx::state>& scheduler_base::get_state(std::size_t num_thread)
     {
@@ -434,12 +602,10 @@ namespace hpx::threads::policies {
     std::ptrdiff_t scheduler_base::get_stack_size(
         threads::thread_stacksize stacksize) const noexcept
     {
-        if (stacksize == thread_stacksize::current)
-        {
-            stacksize = get_self_stacksize_enum();
-        }
-
-        HPX_ASSERT(stacksize != thread_stacksize::current);
+        // no thread description is available here, automatic stack sizes
+        // resolve to the default for threads without recorded stack usage
+        stacksize = threads::detail::resolve_stacksize(
+            stacksize, thread_description(), thread_queue_init_);
 
         switch (stacksize)
         {
@@ -6,8 +6,17 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/functional.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/threading_base/detail/thread_carrier.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+
+#include <cstddef>
 
 ////////////////////////////////////////////////////////////////////////////////
 namespace hpx::threads {
@@ -15,15 +24,90 @@ namespace hpx::threads {
     util::internal_allocator<thread_data_stackful>
         thread_data_stackful::thread_alloc_;
 
-#if !defined(HPX_HAVE_LOGGING)
-    thread_data_stackful::~thread_data_stackful() = default;
-#else
     thread_data_stackful::~thread_data_stackful()
     {
+#if defined(HPX_HAVE_LOGGING)
         LTM_(debug).format(
             "~thread_data_stackful({}), description({}), phase({})", this,
             this->get_description(),
             this->thread_data_stackful::get_thread_phase());
+#endif
+        // a thread destroyed before terminating still owns its carrier
+        delete carrier_;
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool thread_data_stackful::should_run_optimistically(
+        policies::scheduler_base* scheduler) noexcept
+    {
+        return scheduler != nullptr &&
+            scheduler->has_scheduler_mode(
+                policies::scheduler_mode::optimistic_stackless);
+    }
+
+    coroutine_type::result_type thread_data_stackful::call_optimistically(
+        hpx::execution_base::this_thread::detail::agent_storage* agent_storage)
+    {
+        bool const first_run = carrier_ == nullptr;
+        if (first_run)
+        {
+            // The thread function is invoked directly on the stack of the
+            // carrier, the thread's own stack is never allocated. Suspending
+            // the thread suspends the carrier.
+            carrier_ = detail::acquire_thread_carrier(
+                [this](thread_restart_state arg)
+                    -> coroutine_type::result_type {
+                    coroutine_.invoke_directly(arg);
+                    return {thread_schedule_state::terminated,
+                        invalid_thread_id};
+                },
+                thread_id_type(this), get_stack_size());
+        }
+
+        // a thread function exiting with an exception terminates the thread
+        // as well, the carrier has to be given back in this case too
+        bool terminated = true;
+        auto on_exit = hpx::experimental::scope_exit([&] {
+            if (terminated)
+            {
+                detail::release_thread_carrier(carrier_);
+                carrier_ = nullptr;
+            }
+
+            // a thread is promoted if it does not run to completion when it
+            // is run for the first time, it keeps its carrier until it
+            // terminates
+            if (first_run)
+            {
+                HPX_ASSERT(get_scheduler_base() != nullptr);
+                get_scheduler_base()->count_optimistic_thread(
+                    hpx::get_local_worker_thread_num(), !terminated);
+            }
+        });
+
+        coroutine_type::result_type result;
+        {
+            hpx::execution_base::this_thread::reset_agent ctx(
+                agent_storage, carrier_->agent_);
+            result = carrier_->coroutine_(
+                set_state_ex(thread_restart_state::signaled));
+        }
+
+        terminated = result.first == thread_schedule_state::terminated;
+
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+        // the thread has used the stack of its carrier
+        if (terminated)
+        {
+            if (std::ptrdiff_t const usage =
+                    carrier_->coroutine_.get_stack_usage();
+                usage > 0)
+            {
+                detail::record_stack_usage(this->get_description(),
+                    static_cast<std::size_t>(usage));
+            }
+        }
 #endif
+        return result;
+    }
 }    // namespace hpx::threads
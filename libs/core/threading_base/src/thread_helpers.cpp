@@ -11,11 +11,13 @@
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
 #include <hpx/threading_base/set_thread_state_timed.hpp>
 #include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
@@ -534,14 +536,29 @@ namespace hpx::this_thread {
 #ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
             threads::detail::reset_backtrace bt(id, ec);
 #endif
+            // prefer arming a timer on the wheel of the current worker
+            // thread, fall back to the default timer service otherwise
+            threads::detail::timer_wheel_entry timer(id.noref(),
+                threads::thread_schedule_state::pending,
+                threads::thread_restart_state::timeout,
+                threads::thread_priority::boost);
+
+            bool const use_timer_wheel =
+                get_thread_id_data(id)->get_scheduler_base()->add_timer(
+                    threads::detail::get_local_thread_num_tss(), timer,
+                    abs_time.value());
+
             std::atomic<bool> timer_started(false);
-            threads::thread_id_ref_type const timer_id =
-                threads::set_thread_state(id.noref(), abs_time, &timer_started,
-                    threads::thread_schedule_state::pending,
+            threads::thread_id_ref_type timer_id;
+            if (!use_timer_wheel)
+            {
+                timer_id = threads::set_thread_state(id.noref(), abs_time,
+                    &timer_started, threads::thread_schedule_state::pending,
                     threads::thread_restart_state::timeout,
                     threads::thread_priority::boost, true, ec);
-            if (ec)
-                return threads::thread_restart_state::unknown;
+                if (ec)
+                    return threads::thread_restart_state::unknown;
+            }
 
             // We might need to dispatch 'nextid' to it's correct scheduler only
             // if our current scheduler is the same, we should yield to the id
@@ -565,7 +582,13 @@ namespace hpx::this_thread {
                     HPX_MOVE(nextid)));
             }
 
-            if (statex != threads::thread_restart_state::timeout)
+            if (use_timer_wheel)
+            {
+                // disarm the timer, this waits for the timer to be handled if
+                // it has expired concurrently
+                threads::detail::timer_wheel::cancel(timer);
+            }
+            else if (statex != threads::thread_restart_state::timeout)
             {
                 HPX_ASSERT(statex == threads::thread_restart_state::abort ||
                     statex == threads::thread_restart_state::signaled);
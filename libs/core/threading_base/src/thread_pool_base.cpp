@@ -20,15 +20,50 @@
 namespace hpx::threads {
 
     ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        // NUMA domains of the processing units the pool is created for
+        hwloc_bitmap_ptr get_pool_numa_domains(
+            thread_pool_init_parameters const& init)
+        {
+            auto const& topo = create_topology();
+
+            auto used_processing_units = mask_type();
+            threads::resize(used_processing_units,
+                static_cast<std::size_t>(hardware_concurrency()));
+
+            for (std::size_t thread_num = 0; thread_num != init.num_threads_;
+                 ++thread_num)
+            {
+                used_processing_units |= init.affinity_data_.get_pu_mask(
+                    topo, thread_num + init.thread_offset_);
+            }
+
+            if (!threads::any(used_processing_units))
+            {
+                return hwloc_bitmap_ptr();
+            }
+            return topo.cpuset_to_nodeset(used_processing_units);
+        }
+    }    // namespace
+
     thread_pool_base::thread_pool_base(thread_pool_init_parameters const& init)
       : id_(init.index_, init.name_)
       , thread_offset_(init.thread_offset_)
       , affinity_data_(init.affinity_data_)
       , timestamp_scale_(1.0)
       , notifier_(init.notifier_)
+      , arena_(new memory_arena(get_pool_numa_domains(init)))
     {
     }
 
+    thread_pool_base::~thread_pool_base()
+    {
+        // the arena is destroyed once all memory allocated from it has been
+        // released
+        arena_->release();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     mask_type thread_pool_base::get_used_processing_units(
         std::size_t num_cores, bool full_cores) const
@@ -129,6 +164,18 @@ namespace hpx::threads {
             thread_priority::default_, num_thread, reset);
     }
 
+    std::int64_t thread_pool_base::get_arena_bytes_in_use(
+        std::size_t /*num_thread*/, bool /*reset*/)
+    {
+        return arena_->get_bytes_in_use();
+    }
+
+    std::int64_t thread_pool_base::get_arena_cross_deallocations(
+        std::size_t /*num_thread*/, bool reset)
+    {
+        return arena_->get_cross_arena_deallocations(reset);
+    }
+
     std::size_t thread_pool_base::get_active_os_thread_count() const
     {
         std::size_t active_os_thread_count = 0;
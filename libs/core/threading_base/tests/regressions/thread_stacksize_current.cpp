@@ -66,6 +66,7 @@ int main(int argc, char** argv)
     std::vector<std::string> const schedulers = {
         "local",
         "local-priority-fifo",
+        "local-workstealing",
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
         "local-priority-lifo",
 #endif
@@ -0,0 +1,179 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using hpx::threads::memory_arena;
+using hpx::threads::pool_arena_allocator;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_allocate()
+{
+    auto* arena = new memory_arena();
+    HPX_TEST_EQ(arena->get_bytes_in_use(), 0);
+
+    std::vector<void*> blocks;
+    for (std::size_t size : {1, 8, 16, 17, 100, 1000, 8000, 10000, 100000})
+    {
+        for (std::size_t alignment : {1, 8, 16, 64, 1024})
+        {
+            void* p = arena->allocate(size, alignment);
+            HPX_TEST(p != nullptr);
+            HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) % alignment,
+                std::uintptr_t(0));
+            HPX_TEST(memory_arena::get_arena(p) == arena);
+
+            // the whole block has to be usable
+            std::memset(p, 0xcd, size);
+            blocks.push_back(p);
+        }
+    }
+
+    HPX_TEST_LT(std::int64_t(0), arena->get_bytes_in_use());
+
+    for (void* p : blocks)
+    {
+        memory_arena::deallocate(p);
+    }
+    HPX_TEST_EQ(arena->get_bytes_in_use(), 0);
+
+    // released blocks are reused
+    void* p1 = arena->allocate(100);
+    memory_arena::deallocate(p1);
+    void* p2 = arena->allocate(100);
+    HPX_TEST_EQ(p1, p2);
+    memory_arena::deallocate(p2);
+
+    arena->release();
+}
+
+void test_release_with_outstanding_memory()
+{
+    auto* arena = new memory_arena();
+    void* p = arena->allocate(100);
+    void* q = arena->allocate(100000);
+
+    // the arena is destroyed only after all memory has been released
+    arena->release();
+    HPX_TEST(memory_arena::get_arena(p) == arena);
+
+    memory_arena::deallocate(p);
+    memory_arena::deallocate(q);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_pool_arena()
+{
+    memory_arena& arena =
+        hpx::threads::detail::get_self_or_default_pool()->get_memory_arena();
+
+    // worker threads use the arena of their pool
+    HPX_TEST(&memory_arena::get_current() == &arena);
+
+    std::int64_t const bytes_in_use = arena.get_bytes_in_use();
+    {
+        std::vector<int, pool_arena_allocator<int>> v;
+        for (int i = 0; i != 1000; ++i)
+        {
+            v.push_back(i);
+        }
+        HPX_TEST(memory_arena::get_arena(v.data()) == &arena);
+        HPX_TEST_LT(bytes_in_use, arena.get_bytes_in_use());
+
+        for (int i = 0; i != 1000; ++i)
+        {
+            HPX_TEST_EQ(v[i], i);
+        }
+    }
+    HPX_TEST_EQ(bytes_in_use, arena.get_bytes_in_use());
+
+    // memory released on other threads is returned to its arena
+    std::int64_t const cross_deallocations =
+        arena.get_cross_arena_deallocations(false);
+
+    pool_arena_allocator<std::string> alloc;
+    std::string* p = alloc.allocate(1);
+    std::thread([&]() {
+        HPX_TEST(&memory_arena::get_current() != &arena);
+        alloc.deallocate(p, 1);
+    }).join();
+
+    HPX_TEST_EQ(arena.get_cross_arena_deallocations(false),
+        cross_deallocations + 1);
+    HPX_TEST_EQ(bytes_in_use, arena.get_bytes_in_use());
+
+    // allocators can be bound to a specific arena
+    memory_arena& other = memory_arena::get_current();
+    hpx::async([&]() {
+        pool_arena_allocator<int> alloc(other);
+        int* p = alloc.allocate(10);
+        HPX_TEST(memory_arena::get_arena(p) == &other);
+        alloc.deallocate(p, 10);
+    }).get();
+}
+
+void test_caching_allocator()
+{
+    memory_arena& arena =
+        hpx::threads::detail::get_self_or_default_pool()->get_memory_arena();
+
+    using allocator_type = hpx::util::thread_local_caching_allocator<
+        std::string, pool_arena_allocator<std::string>>;
+
+    std::int64_t const cross_deallocations =
+        arena.get_cross_arena_deallocations(false);
+
+    allocator_type alloc;
+    std::string* p = alloc.allocate(1);
+    HPX_TEST(memory_arena::get_arena(p) == &arena);
+
+    std::int64_t const bytes_in_use = arena.get_bytes_in_use();
+
+    // blocks released on threads using a different arena are not cached by
+    // those threads, they are returned to their arena right away
+    std::thread([&]() {
+        alloc.deallocate(p, 1);
+
+        HPX_TEST_EQ(arena.get_cross_arena_deallocations(false),
+            cross_deallocations + 1);
+        HPX_TEST_LT(arena.get_bytes_in_use(), bytes_in_use);
+    }).join();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_allocate();
+    test_release_with_outstanding_memory();
+    test_pool_arena();
+    test_caching_allocator();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+
+    // threads not belonging to any pool use the process-wide arena
+    pool_arena_allocator<int> alloc;
+    int* p = alloc.allocate(1);
+    HPX_TEST(memory_arena::get_arena(p) == &memory_arena::get_current());
+    alloc.deallocate(p, 1);
+
+    return hpx::util::report_errors();
+}
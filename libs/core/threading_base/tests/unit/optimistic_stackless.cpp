@@ -0,0 +1,147 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Threads created while their scheduler is in the mode
+// scheduler_mode::optimistic_stackless are run on a stack borrowed from the
+// worker thread. This test verifies that threads which never suspend run to
+// completion and that threads suspending are promoted and resumed correctly.
+
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+using hpx::threads::policies::scheduler_base;
+using hpx::threads::policies::scheduler_mode;
+
+constexpr std::size_t num_threads = 1000;
+constexpr std::size_t all_threads = static_cast<std::size_t>(-1);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+void run_threads(F const& f)
+{
+    hpx::latch l(static_cast<std::ptrdiff_t>(num_threads + 1));
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        hpx::threads::thread_init_data data(
+            hpx::threads::make_thread_function_nullary([&l, &f]() {
+                f();
+                l.count_down(1);
+            }),
+            "optimistic_stackless_test");
+        hpx::threads::register_work(data);
+    }
+
+    l.arrive_and_wait();
+}
+
+// The counters are updated once the thread function has returned to the
+// scheduler, which may happen after the threads have signaled the latch.
+// Wait for the counter to reach the expected value instead.
+template <typename F>
+bool wait_for_count(F const& get_count, std::int64_t expected)
+{
+    auto const deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    hpx::util::yield_while([&]() {
+        return get_count() < expected &&
+            std::chrono::steady_clock::now() < deadline;
+    });
+    return get_count() >= expected;
+}
+
+void test_run_to_completion(scheduler_base* scheduler)
+{
+    std::int64_t const run_to_completion =
+        scheduler->get_threads_run_to_completion(all_threads, false);
+
+    std::atomic<std::size_t> count(0);
+    run_threads([&count]() { ++count; });
+
+    HPX_TEST_EQ(count.load(), num_threads);
+    HPX_TEST(wait_for_count(
+        [scheduler]() {
+            return scheduler->get_threads_run_to_completion(
+                all_threads, false);
+        },
+        run_to_completion + std::int64_t(num_threads)));
+}
+
+void test_promoted(scheduler_base* scheduler)
+{
+    std::int64_t const promoted =
+        scheduler->get_threads_promoted(all_threads, false);
+
+    // all threads suspend until the last one has been started
+    hpx::latch started(static_cast<std::ptrdiff_t>(num_threads));
+    std::atomic<std::size_t> count(0);
+
+    run_threads([&]() {
+        hpx::threads::thread_id_type const id = hpx::threads::get_self_id();
+
+        hpx::this_thread::yield();
+        HPX_TEST_EQ(id, hpx::threads::get_self_id());
+
+        started.arrive_and_wait();
+        HPX_TEST_EQ(id, hpx::threads::get_self_id());
+
+        ++count;
+    });
+
+    HPX_TEST_EQ(count.load(), num_threads);
+    HPX_TEST(wait_for_count(
+        [scheduler]() {
+            return scheduler->get_threads_promoted(all_threads, false);
+        },
+        promoted + std::int64_t(num_threads)));
+}
+
+void test_disabled(scheduler_base* scheduler)
+{
+    std::int64_t const run_to_completion =
+        scheduler->get_threads_run_to_completion(all_threads, false);
+    std::int64_t const promoted =
+        scheduler->get_threads_promoted(all_threads, false);
+
+    run_threads([]() { hpx::this_thread::yield(); });
+
+    HPX_TEST_EQ(run_to_completion,
+        scheduler->get_threads_run_to_completion(all_threads, false));
+    HPX_TEST_EQ(
+        promoted, scheduler->get_threads_promoted(all_threads, false));
+}
+
+int hpx_main()
+{
+    scheduler_base* scheduler =
+        hpx::threads::detail::get_self_or_default_pool()->get_scheduler();
+
+    scheduler->add_scheduler_mode(scheduler_mode::optimistic_stackless);
+
+    test_run_to_completion(scheduler);
+    test_promoted(scheduler);
+
+    scheduler->remove_scheduler_mode(scheduler_mode::optimistic_stackless);
+
+    test_disabled(scheduler);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,122 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that threads created with thread_stacksize::automatic
+// are run on one of the regular stack sizes by all schedulers, and that (if
+// enabled) the stack usage sampled for threads is used to select the stack
+// size.
+
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/coroutines.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/threading_base/detail/stack_usage.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using hpx::threads::thread_stacksize;
+
+char const* const test_description = "stack_usage_test";
+
+///////////////////////////////////////////////////////////////////////////////
+void run_threads(std::size_t num_threads)
+{
+    hpx::latch l(static_cast<std::ptrdiff_t>(num_threads + 1));
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        hpx::threads::thread_init_data data(
+            hpx::threads::make_thread_function_nullary([&l]() {
+                thread_stacksize const stacksize =
+                    hpx::threads::get_self_stacksize_enum();
+                HPX_TEST(stacksize >= thread_stacksize::minimal &&
+                    stacksize <= thread_stacksize::maximal);
+                l.count_down(1);
+            }),
+            test_description, hpx::threads::thread_priority::normal,
+            hpx::threads::thread_schedule_hint(), thread_stacksize::automatic);
+        hpx::threads::register_work(data);
+    }
+
+    l.arrive_and_wait();
+}
+
+int hpx_main()
+{
+    // threads without recorded stack usage run on a small stack
+    HPX_TEST_EQ(hpx::threads::detail::get_automatic_stacksize(
+                    "stack_usage_test_unknown",
+                    hpx::threads::policies::thread_queue_init_parameters()),
+        thread_stacksize::small_);
+
+    // the scheduler resolves automatic stack sizes as well
+    hpx::threads::policies::scheduler_base const* scheduler =
+        hpx::threads::get_self_id_data()->get_scheduler_base();
+    HPX_TEST_EQ(scheduler->get_stack_size(thread_stacksize::automatic),
+        scheduler->get_stack_size(thread_stacksize::small_));
+
+    run_threads(100);
+
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING) &&                       \
+    defined(HPX_HAVE_THREAD_DESCRIPTION)
+    // all threads above were sampled, they don't need a lot of stack space
+    HPX_TEST_NEQ(
+        hpx::threads::detail::get_recorded_stack_usage(test_description),
+        static_cast<std::size_t>(0));
+    HPX_TEST_EQ(hpx::threads::detail::get_automatic_stacksize(
+                    test_description,
+                    hpx::threads::policies::thread_queue_init_parameters()),
+        thread_stacksize::small_);
+
+    run_threads(100);
+#endif
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(
+    int argc, char* argv[], hpx::resource::scheduling_policy scheduler)
+{
+    hpx::local::init_params init_args;
+#if defined(HPX_COROUTINES_HAVE_STACK_USAGE_SAMPLING)
+    // sample the stack usage of all threads
+    init_args.cfg = {"hpx.stacks.usage_sampling_rate=1"};
+#endif
+    init_args.rp_callback = [scheduler](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default", scheduler);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<hpx::resource::scheduling_policy> schedulers = {
+        hpx::resource::scheduling_policy::local,
+        hpx::resource::scheduling_policy::local_priority_fifo,
+        hpx::resource::scheduling_policy::local_workstealing,
+        hpx::resource::scheduling_policy::static_,
+        hpx::resource::scheduling_policy::static_priority,
+        hpx::resource::scheduling_policy::shared_priority,
+#if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
+        hpx::resource::scheduling_policy::local_workrequesting_fifo,
+        hpx::resource::scheduling_policy::local_workrequesting_mc,
+#endif
+    };
+
+    for (auto const scheduler : schedulers)
+    {
+        test_scheduler(argc, argv, scheduler);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,170 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that timed suspension of HPX threads (which by default is
+// handled by the per-worker timer wheels) never wakes up threads early, and
+// that timers that are cancelled because a thread was woken up explicitly
+// don't cause spurious wakeups later on. Timers armed on a worker thread that
+// is suspended afterwards have to be handled by the other worker threads.
+
+#include <hpx/condition_variable.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/thread_pool_util.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/mutex.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sleep_for(std::chrono::milliseconds d)
+{
+    auto const start = std::chrono::steady_clock::now();
+    hpx::this_thread::sleep_for(d);
+    HPX_TEST(std::chrono::steady_clock::now() - start >= d);
+}
+
+void test_many_sleeping_threads()
+{
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(1000);
+
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        futures.push_back(
+            hpx::async(&test_sleep_for, std::chrono::milliseconds(i % 50)));
+    }
+
+    hpx::wait_all(futures);
+
+    // all timers have expired, the wheels should be empty now
+    HPX_TEST_EQ(hpx::threads::get_self_id_data()
+                    ->get_scheduler_base()
+                    ->get_timer_wheel_occupancy(),
+        0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_cancelled_timers()
+{
+    hpx::mutex mtx;
+    hpx::condition_variable cv;
+    std::atomic<std::size_t> num_timeouts(0);
+    bool ready = false;
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(100);
+
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        futures.push_back(hpx::async([&] {
+            std::unique_lock<hpx::mutex> l(mtx);
+            while (!ready)
+            {
+                if (cv.wait_for(l, std::chrono::seconds(10)) ==
+                    hpx::cv_status::timeout)
+                {
+                    ++num_timeouts;
+                }
+            }
+        }));
+    }
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    {
+        std::lock_guard<hpx::mutex> l(mtx);
+        ready = true;
+    }
+    cv.notify_all();
+
+    hpx::wait_all(futures);
+    HPX_TEST_EQ(num_timeouts.load(), static_cast<std::size_t>(0));
+
+    // the (long running) timers must have been disarmed
+    HPX_TEST_EQ(hpx::threads::get_self_id_data()
+                    ->get_scheduler_base()
+                    ->get_timer_wheel_occupancy(),
+        0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_suspended_processing_unit()
+{
+    std::size_t const num_threads = hpx::resource::get_num_threads("default");
+    if (num_threads < 2)
+    {
+        return;
+    }
+
+    hpx::threads::thread_pool_base& pool =
+        hpx::resource::get_thread_pool("default");
+
+    // let a thread arm its timer on the last worker thread, which is
+    // suspended before the timer expires
+    std::size_t const virt_core = num_threads - 1;
+    hpx::execution::parallel_executor exec(
+        hpx::threads::thread_priority::normal,
+        hpx::threads::thread_stacksize::default_,
+        hpx::threads::thread_schedule_hint(
+            hpx::threads::thread_schedule_hint_mode::thread,
+            static_cast<std::int16_t>(virt_core)));
+
+    std::atomic<bool> started(false);
+    hpx::future<void> f = hpx::async(exec, [&]() {
+        started = true;
+        test_sleep_for(std::chrono::milliseconds(100));
+    });
+
+    hpx::util::yield_while([&]() { return !started.load(); });
+    hpx::threads::suspend_processing_unit(pool, virt_core).get();
+
+    HPX_TEST(f.wait_for(std::chrono::seconds(10)) == hpx::future_status::ready);
+
+    hpx::threads::resume_processing_unit(pool, virt_core).get();
+    f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_many_sleeping_threads();
+    test_cancelled_timers();
+    test_suspended_processing_unit();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    // allow for processing units to be suspended
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default",
+            hpx::resource::scheduling_policy::local_priority_fifo,
+            hpx::threads::policies::scheduler_mode::default_ |
+                hpx::threads::policies::scheduler_mode::enable_elasticity);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -224,6 +224,13 @@ namespace hpx::threads {
     public:
         // performance counters
         std::int64_t get_queue_length(bool reset) const;
+        std::int64_t get_timer_wheel_occupancy(bool reset) const;
+        std::int64_t get_arena_bytes_in_use(bool reset) const;
+        std::int64_t get_arena_cross_deallocations(bool reset) const;
+        std::int64_t get_thread_recycler_cross_queue_reuses(bool reset) const;
+        std::int64_t get_thread_recycler_objects_freed(bool reset) const;
+        std::int64_t get_threads_run_to_completion(bool reset) const;
+        std::int64_t get_threads_promoted(bool reset) const;
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::int64_t get_average_thread_wait_time(bool reset) const;
         std::int64_t get_average_task_wait_time(bool reset) const;
@@ -316,6 +323,9 @@ namespace hpx::threads {
         void create_scheduler_local_workrequesting_mc(
             thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
+        void create_scheduler_local_workstealing(
+            thread_pool_init_parameters const&,
+            policies::thread_queue_init_parameters const&, std::size_t);
 
         mutable mutex_type mtx_;    // mutex protecting the members
 
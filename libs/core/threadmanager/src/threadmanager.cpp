@@ -132,6 +132,14 @@ namespace hpx::threads {
                 HPX_THREAD_QUEUE_INIT_THREADS_COUNT);
         double const max_idle_backoff_time = hpx::util::get_entry_as<double>(
             rtcfg_, "hpx.max_idle_backoff_time", HPX_IDLE_BACKOFF_TIME_MAX);
+        std::int64_t const timer_wheel_resolution =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.timer_wheel_resolution",
+                HPX_TIMER_WHEEL_RESOLUTION);
+        std::int64_t const max_recycled_threads =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.max_recycled_threads",
+                HPX_THREAD_QUEUE_MAX_RECYCLED_THREADS);
 
         std::ptrdiff_t const small_stacksize =
             rtcfg_.get_stack_size(thread_stacksize::small_);
@@ -147,7 +155,8 @@ namespace hpx::threads {
             min_add_new_count, max_add_new_count, min_delete_count,
             max_delete_count, max_terminated_threads, init_threads_count,
             max_idle_backoff_time, small_stacksize, medium_stacksize,
-            large_stacksize, huge_stacksize);
+            large_stacksize, huge_stacksize, timer_wheel_resolution,
+            max_recycled_threads);
     }
 
     void threadmanager::create_scheduler_user_defined(
@@ -643,6 +652,45 @@ namespace hpx::threads {
 #endif
     }
 
+    void threadmanager::create_scheduler_local_workstealing(
+        thread_pool_init_parameters const& thread_pool_init,
+        policies::thread_queue_init_parameters const& thread_queue_init,
+        std::size_t numa_sensitive)
+    {
+        // set parameters for scheduler and pool instantiation and perform
+        // compatibility checks
+        std::size_t const num_high_priority_queues =
+            hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                "hpx.thread_queue.high_priority_queues",
+                thread_pool_init.num_threads_);
+        detail::check_num_high_priority_queues(
+            thread_pool_init.num_threads_, num_high_priority_queues);
+
+        // instantiate the scheduler
+        using local_sched_type =
+            hpx::threads::policies::local_workstealing_scheduler<>;
+
+        local_sched_type::init_parameter_type const init(
+            thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+            num_high_priority_queues, thread_queue_init,
+            "core-local_workstealing_scheduler");
+
+        auto sched = std::make_unique<local_sched_type>(init);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+    }
+
     void threadmanager::create_pools()
     {
         auto& rp = hpx::resource::get_partitioner();
@@ -798,6 +846,11 @@ namespace hpx::threads {
                     thread_pool_init, thread_queue_init, numa_sensitive);
                 break;
 
+            case resource::scheduling_policy::local_workstealing:
+                create_scheduler_local_workstealing(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
             case resource::scheduling_policy::abp_priority_fifo:
                 create_scheduler_abp_priority_fifo(
                     thread_pool_init, thread_queue_init, numa_sensitive);
@@ -1193,6 +1246,68 @@ namespace hpx::threads {
         return result;
     }
 
+    std::int64_t threadmanager::get_timer_wheel_occupancy(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_timer_wheel_occupancy(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_arena_bytes_in_use(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_arena_bytes_in_use(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_arena_cross_deallocations(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_arena_cross_deallocations(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_thread_recycler_cross_queue_reuses(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_thread_recycler_cross_queue_reuses(
+                all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_thread_recycler_objects_freed(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_thread_recycler_objects_freed(
+                all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_threads_run_to_completion(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_threads_run_to_completion(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_threads_promoted(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_threads_promoted(all_threads, reset);
+        return result;
+    }
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
     std::int64_t threadmanager::get_average_thread_wait_time(bool reset) const
     {
@@ -190,6 +190,18 @@ namespace hpx::threads {
         mask_cref_type get_core_affinity_mask(
             std::size_t num_thread, error_code& ec = throws) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit available to the given thread which shares
+        ///        the L3 cache with it. This is the NUMA domain mask on
+        ///        systems that do not report an L3 cache.
+        ///
+        /// \param num_thread [in]
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        mask_cref_type get_cache_affinity_mask(
+            std::size_t num_thread, error_code& ec = throws) const;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread.
         ///
@@ -316,6 +328,7 @@ namespace hpx::threads {
             std::size_t num_numa_node) const;
         mask_type init_core_affinity_mask_from_core(std::size_t num_core,
             mask_cref_type default_mask = empty_mask) const;
+        mask_type init_cache_affinity_mask(std::size_t num_thread) const;
         mask_type init_thread_affinity_mask(std::size_t num_thread) const;
         mask_type init_thread_affinity_mask(
             std::size_t num_core, std::size_t num_pu) const;
@@ -419,6 +432,7 @@ namespace hpx::threads {
         mask_type machine_affinity_mask_ = mask_type();
         std::vector<mask_type> socket_affinity_masks_;
         std::vector<mask_type> numa_node_affinity_masks_;
+        std::vector<mask_type> cache_affinity_masks_;
         std::vector<mask_type> core_affinity_masks_;
         std::vector<mask_type> thread_affinity_masks_;
     };
@@ -289,6 +289,7 @@ namespace hpx::threads {
         machine_affinity_mask_ = init_machine_affinity_mask();
         socket_affinity_masks_.reserve(num_of_pus_);
         numa_node_affinity_masks_.reserve(num_of_pus_);
+        cache_affinity_masks_.reserve(num_of_pus_);
         core_affinity_masks_.reserve(num_of_pus_);
         thread_affinity_masks_.reserve(num_of_pus_);
 
@@ -303,6 +304,11 @@ namespace hpx::threads {
                 init_numa_node_affinity_mask(i));
         }
 
+        for (std::size_t i = 0; i < num_of_pus_; ++i)
+        {
+            cache_affinity_masks_.emplace_back(init_cache_affinity_mask(i));
+        }
+
         for (std::size_t i = 0; i < num_of_pus_; ++i)
         {
             core_affinity_masks_.emplace_back(init_core_affinity_mask(i));
@@ -344,6 +350,8 @@ namespace hpx::threads {
             "socket_affinity_mask", socket_affinity_masks_);
         detail::write_to_log_mask(
             "numa_node_affinity_mask", numa_node_affinity_masks_);
+        detail::write_to_log_mask(
+            "cache_affinity_mask", cache_affinity_masks_);
         detail::write_to_log_mask("core_affinity_mask", core_affinity_masks_);
         detail::write_to_log_mask(
             "thread_affinity_mask", thread_affinity_masks_);
@@ -445,6 +453,24 @@ namespace hpx::threads {
         return empty_mask;
     }
 
+    mask_cref_type topology::get_cache_affinity_mask(
+        std::size_t num_thread, error_code& ec) const
+    {
+        if (std::size_t const num_pu = num_thread % num_of_pus_;
+            num_pu < cache_affinity_masks_.size())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return cache_affinity_masks_[num_pu];
+        }
+
+        HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+            "hpx::threads::topology::get_cache_affinity_mask",
+            "thread number {1} is out of range", num_thread);
+        return empty_mask;
+    }
+
     mask_cref_type topology::get_core_affinity_mask(
         std::size_t num_thread, error_code& ec) const
     {
@@ -1114,6 +1140,50 @@ namespace hpx::threads {
         return default_mask;
     }
 
+    mask_type topology::init_cache_affinity_mask(std::size_t num_thread) const
+    {
+        std::size_t const num_pu = (num_thread + pu_offset) % num_of_pus_;
+        hwloc_obj_t cache_obj = nullptr;
+
+        {
+            std::unique_lock<mutex_type> lk(topo_mtx);
+            hwloc_obj_t const pu_obj = hwloc_get_obj_by_type(
+                topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+
+            if (pu_obj != nullptr)
+            {
+#if HWLOC_API_VERSION >= 0x00020000
+                cache_obj = hwloc_get_ancestor_obj_by_type(
+                    topo, HWLOC_OBJ_L3CACHE, pu_obj);
+#else
+                // traverse up until the third cache level is found
+                int levels = 0;
+                for (hwloc_obj_t obj = pu_obj; obj != nullptr;
+                     obj = obj->parent)
+                {
+                    if (obj->type == HWLOC_OBJ_CACHE && ++levels == 3)
+                    {
+                        cache_obj = obj;
+                        break;
+                    }
+                }
+#endif
+            }
+        }
+
+        // fall back to the NUMA domain if there is no L3 cache
+        if (cache_obj == nullptr)
+        {
+            return numa_node_affinity_masks_[num_thread];
+        }
+
+        auto cache_affinity_mask = mask_type();
+        resize(cache_affinity_mask, get_number_of_pus());
+
+        extract_node_mask(cache_obj, cache_affinity_mask);
+        return cache_affinity_mask;
+    }
+
     mask_type topology::init_thread_affinity_mask(std::size_t num_thread) const
     {
         if (static_cast<std::size_t>(-1) == num_thread)
@@ -1656,6 +1726,8 @@ namespace hpx::threads {
         print_mask_vector(os, socket_affinity_masks_);
         os << "numa node             : \n";
         print_mask_vector(os, numa_node_affinity_masks_);
+        os << "L3 cache              : \n";
+        print_mask_vector(os, cache_affinity_masks_);
         os << "core                  : \n";
         print_mask_vector(os, core_affinity_masks_);
         os << "PUs (/threads)        : \n";
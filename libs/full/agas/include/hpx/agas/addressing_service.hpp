@@ -11,6 +11,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
+#include <hpx/cache/concurrent_cache.hpp>
 #include <hpx/cache/lru_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
@@ -64,15 +65,24 @@ namespace hpx { namespace agas {
 
         // gva cache
         struct gva_cache_key;
+        struct gva_cache_key_hash;
 
         using gva_cache_type = hpx::util::cache::lru_cache<gva_cache_key, gva,
             hpx::util::cache::statistics::local_full_statistics>;
+        using gva_concurrent_cache_type =
+            hpx::util::cache::concurrent_cache<gva_cache_key, gva,
+                hpx::util::cache::statistics::local_full_statistics,
+                gva_cache_key_hash>;
 
         using migrated_objects_table_type = std::set<naming::gid_type>;
         using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
 
+        // Depending on the configuration, either gva_cache_ (protected by
+        // gva_cache_mtx_) or gva_concurrent_cache_ (which doesn't need any
+        // external locking) is used.
         mutable hpx::shared_mutex gva_cache_mtx_;
         std::shared_ptr<gva_cache_type> gva_cache_;
+        std::shared_ptr<gva_concurrent_cache_type> gva_concurrent_cache_;
 
         mutable mutex_type migrated_objects_mtx_;
         migrated_objects_table_type migrated_objects_table_;
@@ -265,6 +275,10 @@ namespace hpx { namespace agas {
         std::uint64_t get_cache_update_entry_time(bool reset) const;
         std::uint64_t get_cache_erase_entry_time(bool reset) const;
 
+    private:
+        template <typename F>
+        std::uint64_t get_cache_statistics(F const& f) const;
+
     public:
         /// \brief Add a locality to the runtime.
         bool register_locality(parcelset::endpoints_type const& endpoints,
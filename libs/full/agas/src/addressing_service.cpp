@@ -40,6 +40,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -115,9 +116,24 @@ namespace hpx::agas {
         }
     };
 
+    // Only single GIDs (no ranges) are stored in the concurrent cache, thus
+    // hashing the base GID is consistent with the equality of the keys.
+    struct addressing_service::gva_cache_key_hash
+    {
+        std::size_t operator()(gva_cache_key const& key) const noexcept
+        {
+            return std::hash<naming::gid_type>()(key.get_gid());
+        }
+    };
+
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
-      : gva_cache_(new gva_cache_type)
+      : gva_cache_(ini_.get_agas_concurrent_caching_mode() ?
+                nullptr :
+                new gva_cache_type)
+      , gva_concurrent_cache_(ini_.get_agas_concurrent_caching_mode() ?
+                new gva_concurrent_cache_type :
+                nullptr)
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
       , refcnt_requests_count_(0)
@@ -126,13 +142,21 @@ namespace hpx::agas {
       , service_type(ini_.get_agas_service_mode())
       , runtime_type(ini_.mode_)
       , caching_(ini_.get_agas_caching_mode())
-      , range_caching_(caching_ ? ini_.get_agas_range_caching_mode() : false)
+      , range_caching_(caching_ && !gva_concurrent_cache_ ?
+                ini_.get_agas_range_caching_mode() :
+                false)
       , action_priority_(threads::thread_priority::boost)
       , rts_lva_(0)
       , state_(hpx::state::starting)
     {
         if (caching_)
-            gva_cache_->reserve(ini_.get_agas_local_cache_size());
+        {
+            std::size_t const cache_size = ini_.get_agas_local_cache_size();
+            if (gva_concurrent_cache_)
+                gva_concurrent_cache_->reserve(cache_size);
+            else
+                gva_cache_->reserve(cache_size);
+        }
     }
 
     void addressing_service::bootstrap(
@@ -190,8 +214,17 @@ namespace hpx::agas {
         // create the hierarchy based on the topology
         if (caching_)
         {
-            std::size_t const previous = gva_cache_->size();
-            gva_cache_->reserve(cache_size);
+            std::size_t previous = 0;
+            if (gva_concurrent_cache_)
+            {
+                previous = gva_concurrent_cache_->size();
+                gva_concurrent_cache_->reserve(cache_size);
+            }
+            else
+            {
+                previous = gva_cache_->size();
+                gva_cache_->reserve(cache_size);
+            }
 
             LAGAS_(info).format(
                 "addressing_service::adjust_local_cache_size, previous size: "
@@ -1747,6 +1780,17 @@ namespace hpx::agas {
                 "addressing_service::update_cache_entry, gid({1}), count({2})",
                 gid, count);
 
+            if (gva_concurrent_cache_)
+            {
+                // The concurrent cache doesn't support ranges, a range is
+                // cached for its base GID only.
+                gva_concurrent_cache_->update(gva_cache_key(gid), g);
+
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
             gva_cache_key const key(gid, count);
 
             {
@@ -1802,28 +1846,34 @@ namespace hpx::agas {
         HPX_ASSERT(naming::detail::store_in_cache(gid));
 
         gva_cache_key const k(gid);
+        gva_cache_key idbase_key;
 
-        std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        if (gva_cache_key idbase_key; gva_cache_->get_entry(k, idbase_key, gva))
+        if (gva_concurrent_cache_)
         {
-            std::uint64_t const id_msb =
-                naming::detail::strip_internal_bits_from_gid(gid.get_msb());
-
-            if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
-            {
-                lock.unlock();
-                HPX_THROWS_IF(ec, hpx::error::internal_server_error,
-                    "addressing_service::get_cache_entry",
-                    "bad entry in cache, MSBs of GID base and GID do not "
-                    "match");
+            if (!gva_concurrent_cache_->get_entry(k, idbase_key, gva))
                 return false;
-            }
+        }
+        else
+        {
+            std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
+            if (!gva_cache_->get_entry(k, idbase_key, gva))
+                return false;
+        }
 
-            idbase = idbase_key.get_gid();
-            return true;
+        std::uint64_t const id_msb =
+            naming::detail::strip_internal_bits_from_gid(gid.get_msb());
+
+        if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
+        {
+            HPX_THROWS_IF(ec, hpx::error::internal_server_error,
+                "addressing_service::get_cache_entry",
+                "bad entry in cache, MSBs of GID base and GID do not "
+                "match");
+            return false;
         }
 
-        return false;
+        idbase = idbase_key.get_gid();
+        return true;
     }
 
     void addressing_service::clear_cache(error_code& ec) const
@@ -1841,9 +1891,15 @@ namespace hpx::agas {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
-            std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-
-            gva_cache_->clear();
+            if (gva_concurrent_cache_)
+            {
+                gva_concurrent_cache_->clear();
+            }
+            else
+            {
+                std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
+                gva_cache_->clear();
+            }
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1887,11 +1943,19 @@ namespace hpx::agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
-            std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-
-            gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
+            auto const pred = [&gid](std::pair<gva_cache_key, gva> const& p) {
                 return gid == p.first.get_gid();
-            });
+            };
+
+            if (gva_concurrent_cache_)
+            {
+                gva_concurrent_cache_->erase(pred);
+            }
+            else
+            {
+                std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
+                gva_cache_->erase(pred);
+            }
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1916,90 +1980,116 @@ namespace hpx::agas {
 
     ///////////////////////////////////////////////////////////////////////////
     // Helper functions to access the current cache statistics
+    template <typename F>
+    std::uint64_t addressing_service::get_cache_statistics(F const& f) const
+    {
+        if (gva_concurrent_cache_)
+        {
+            // accumulate the statistics of all shards
+            return gva_concurrent_cache_->accumulate_statistics(
+                [&f](auto& stats) {
+                    return static_cast<std::uint64_t>(f(stats));
+                });
+        }
+
+        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
+        return f(gva_cache_->get_statistics());
+    }
+
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */) const
     {
+        if (gva_concurrent_cache_)
+        {
+            return gva_concurrent_cache_->size();
+        }
+
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->size();
     }
 
     std::uint64_t addressing_service::get_cache_hits(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().hits(reset);
+        return get_cache_statistics(
+            [reset](auto& stats) { return stats.hits(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().misses(reset);
+        return get_cache_statistics(
+            [reset](auto& stats) { return stats.misses(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().evictions(reset);
+        return get_cache_statistics(
+            [reset](auto& stats) { return stats.evictions(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().insertions(reset);
+        return get_cache_statistics(
+            [reset](auto& stats) { return stats.insertions(reset); });
     }
 
     ///////////////////////////////////////////////////////////////////////////
     std::uint64_t addressing_service::get_cache_get_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_count(reset);
+        return get_cache_statistics(
+            [reset](auto& stats) { return stats.get_get_entry_count(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_count(reset);
+        return get_cache_statistics([reset](auto& stats) {
+            return stats.get_insert_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_count(reset);
+        return get_cache_statistics([reset](auto& stats) {
+            return stats.get_update_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_count(reset);
+        return get_cache_statistics([reset](auto& stats) {
+            return stats.get_erase_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_time(reset);
+        return get_cache_statistics(
+            [reset](auto& stats) { return stats.get_get_entry_time(reset); });
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_time(reset);
+        return get_cache_statistics([reset](auto& stats) {
+            return stats.get_insert_entry_time(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_time(reset);
+        return get_cache_statistics([reset](auto& stats) {
+            return stats.get_update_entry_time(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_time(reset);
+        return get_cache_statistics(
+            [reset](auto& stats) { return stats.get_erase_entry_time(reset); });
     }
 
     void addressing_service::register_server_instances()
@@ -105,6 +105,38 @@ namespace hpx { namespace collectives {
     all_gather(communicator comm, T&& result,
         generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// AllGather a set of values from different call sites
+    ///
+    /// This function exchanges the values directly between the participating
+    /// sites of the given channel communicator instead of sending all values
+    /// to a single site.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  algorithm   The algorithm to use for the all_gather operation
+    ///                     (default: picked based on the number of sites and
+    ///                     the type of the values). The ring algorithm is
+    ///                     used if the number of sites is not a power of two.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_gather operation performed on the
+    ///                     given communicator. This is optional and needs to
+    ///                     be supplied only if the all_gather operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    ///
+    /// \returns    This function returns a future holding a vector with all
+    ///             values send by all participating sites. It will become
+    ///             ready once the all_gather operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>>
+    all_gather(channel_communicator comm, T&& result,
+        collective_algorithm algorithm = collective_algorithm::automatic,
+        generation_arg generation = generation_arg());
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -117,7 +149,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/channel_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -233,6 +267,37 @@ namespace hpx::collectives {
                               generation, root_site),
             HPX_FORWARD(T, local_result), this_site);
     }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // all_gather exchanging data directly between the sites
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> all_gather(
+        channel_communicator comm, T&& local_result,
+        collective_algorithm algorithm = collective_algorithm::automatic,
+        generation_arg generation = generation_arg())
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == static_cast<std::size_t>(-1))
+        {
+            generation = 1;
+        }
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<std::vector<arg_type>>(
+                HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::collectives::all_gather",
+                    "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async(
+            [comm = HPX_MOVE(comm), local_result = HPX_FORWARD(T, local_result),
+                algorithm,
+                generation = static_cast<std::size_t>(generation)]() mutable {
+                return detail::channel_all_gather(HPX_MOVE(comm),
+                    arg_type(HPX_MOVE(local_result)), algorithm, generation);
+            });
+    }
 }    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -110,6 +110,43 @@ namespace hpx { namespace collectives {
     all_reduce(communicator comm,
         T&& result, F&& op, generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// AllReduce a set of values from different call sites
+    ///
+    /// This function exchanges the values directly between the participating
+    /// sites of the given channel communicator instead of sending all values
+    /// to a single site.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  op          Reduction operation to apply to all values supplied
+    ///                     from all participating sites. The ring algorithm
+    ///                     requires the values to be vectors of the same size
+    ///                     on all sites and invokes the operation on
+    ///                     sub-ranges of those, i.e. the operation has to be
+    ///                     applied element-wise.
+    /// \param  algorithm   The algorithm to use for the all_reduce operation
+    ///                     (default: recursive doubling, the ring algorithm
+    ///                     is used only if requested explicitly).
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_reduce operation performed on the
+    ///                     given communicator. This is optional and needs to
+    ///                     be supplied only if the all_reduce operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    ///
+    /// \returns    This function returns a future holding the reduced value.
+    ///             It will become ready once the all_reduce operation has
+    ///             been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>>
+    all_reduce(channel_communicator comm, T&& result, F&& op,
+        collective_algorithm algorithm = collective_algorithm::automatic,
+        generation_arg generation = generation_arg());
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -123,7 +160,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/channel_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
@@ -252,6 +291,37 @@ namespace hpx::collectives {
                               generation, root_site),
             HPX_FORWARD(T, local_result), HPX_FORWARD(F, op), this_site);
     }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // all_reduce exchanging data directly between the sites
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(channel_communicator comm,
+        T&& local_result, F&& op,
+        collective_algorithm algorithm = collective_algorithm::automatic,
+        generation_arg generation = generation_arg())
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == static_cast<std::size_t>(-1))
+        {
+            generation = 1;
+        }
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<arg_type>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::all_reduce",
+                "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async(
+            [comm = HPX_MOVE(comm), local_result = HPX_FORWARD(T, local_result),
+                op = HPX_FORWARD(F, op), algorithm,
+                generation = static_cast<std::size_t>(generation)]() mutable {
+                return detail::channel_all_reduce(HPX_MOVE(comm),
+                    arg_type(HPX_MOVE(local_result)), op, algorithm,
+                    generation);
+            });
+    }
 }    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
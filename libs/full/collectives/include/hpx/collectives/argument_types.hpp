@@ -11,6 +11,7 @@
 #include <hpx/config.hpp>
 
 #include <cstddef>
+#include <cstdint>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::collectives {
@@ -48,6 +49,7 @@ namespace hpx::collectives {
         struct root_site_tag;
         struct tag_tag;
         struct arity_tag;
+        struct segment_size_tag;
     }    // namespace detail
 
     /// The number of participating sites (default: all localities)
@@ -75,4 +77,28 @@ namespace hpx::collectives {
     /// The number of children each of the communication nodes is connected
     /// to (default: picked based on num_sites).
     using arity_arg = detail::argument_type<detail::arity_tag>;
+
+    /// The size (in bytes) of the segments a value is split into by
+    /// operations forwarding large values piece by piece (default: 1MB).
+    using segment_size_arg =
+        detail::argument_type<detail::segment_size_tag, 1024 * 1024>;
+
+    /// The algorithm used for collective operations performed on a
+    /// \a channel_communicator
+    enum class collective_algorithm : std::uint8_t
+    {
+        /// Select the algorithm based on properties all sites agree on (the
+        /// number of sites and the type of the exchanged data)
+        automatic = 0,
+
+        /// Exchange data with one partner site at a time, doubling the
+        /// distance to the partner in each step. This needs a logarithmic
+        /// number of steps and is best suited for small amounts of data.
+        recursive_doubling = 1,
+
+        /// Pass data around a ring of all sites. This needs a linear number of
+        /// steps but sends every piece of data only once per site and is best
+        /// suited for large amounts of data.
+        ring = 2
+    };
 }    // namespace hpx::collectives
@@ -185,6 +185,74 @@ namespace hpx { namespace collectives {
     hpx::future<T> broadcast_from(communicator comm,
         generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// Broadcast a large value to different call sites
+    ///
+    /// This function splits the given value into segments which are passed
+    /// down a binary tree formed by all sites of the given channel
+    /// communicator. Every site forwards each segment as soon as it has
+    /// been received, which pipelines the transfers along the tree. The
+    /// overall time approaches the time needed for sending the value once
+    /// plus the depth of the tree.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  segment_size The size of the segments (in bytes) the value is
+    ///                     split into (default: 1MB).
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given communicator. This is optional and needs to
+    ///                     be supplied only if the broadcast operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    ///
+    /// \note       The generation values from corresponding \a broadcast_to and
+    ///             \a broadcast_from have to match.
+    ///
+    /// \returns    This function returns a future holding the value that was
+    ///             sent to all participating sites. It will become ready once
+    ///             the value has been sent to the children of this site.
+    ///
+    template <typename T, typename Allocator>
+    hpx::future<serialization::serialize_buffer<T, Allocator>>
+    broadcast_to(channel_communicator comm,
+        serialization::serialize_buffer<T, Allocator> local_result,
+        segment_size_arg segment_size = segment_size_arg(),
+        generation_arg generation = generation_arg());
+
+    /// Receive a large value that was broadcast to different call sites
+    ///
+    /// This function receives the segments of a value sent by
+    /// \a broadcast_to and forwards those to the children of this site.
+    ///
+    /// \tparam T           The type of the received value, this has to be a
+    ///                     \a serialize_buffer.
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  root_site   The site that has called \a broadcast_to, this
+    ///                     must be a site other than the calling one.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given communicator. This is optional and needs to
+    ///                     be supplied only if the broadcast operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    ///
+    /// \note       The generation values from corresponding \a broadcast_to and
+    ///             \a broadcast_from have to match.
+    ///
+    /// \returns    This function returns a future holding the value that was
+    ///             sent to all participating sites. It will become
+    ///             ready once the broadcast operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<T> broadcast_from(channel_communicator comm,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg());
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -199,7 +267,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/async_local/dataflow.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/channel_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -389,6 +459,77 @@ namespace hpx::collectives {
                                      this_site, generation, root_site),
             this_site);
     }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // segmented broadcast of large values along a tree of sites
+    template <typename T, typename Allocator>
+    hpx::future<serialization::serialize_buffer<T, Allocator>> broadcast_to(
+        channel_communicator comm,
+        serialization::serialize_buffer<T, Allocator> local_result,
+        segment_size_arg segment_size = segment_size_arg(),
+        generation_arg generation = generation_arg())
+    {
+        using arg_type = serialization::serialize_buffer<T, Allocator>;
+
+        if (generation == static_cast<std::size_t>(-1))
+        {
+            generation = 1;
+        }
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<arg_type>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::broadcast_to",
+                "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              local_result = HPX_MOVE(local_result),
+                              segment_size = static_cast<std::size_t>(
+                                  segment_size),
+                              generation = static_cast<std::size_t>(
+                                  generation)]() mutable {
+            detail::channel_broadcast_to(
+                HPX_MOVE(comm), local_result, segment_size, generation);
+            return HPX_MOVE(local_result);
+        });
+    }
+
+    template <typename T>
+    hpx::future<T> broadcast_from(channel_communicator comm,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg())
+    {
+        static_assert(detail::is_serialize_buffer<T>::value,
+            "the segmented broadcast supports serialize_buffer values only");
+
+        if (generation == static_cast<std::size_t>(-1))
+        {
+            generation = 1;
+        }
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<T>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::broadcast_from",
+                "the generation number shouldn't be zero"));
+        }
+
+        auto const [num_sites, this_site] = comm.get_info();
+        if (static_cast<std::size_t>(root_site) == this_site ||
+            static_cast<std::size_t>(root_site) >= num_sites)
+        {
+            return hpx::make_exceptional_future<T>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::broadcast_from",
+                "the root site must be a valid site other than this site"));
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              root_site = static_cast<std::size_t>(root_site),
+                              generation = static_cast<std::size_t>(
+                                  generation)]() mutable {
+            return detail::channel_broadcast_from<T>(
+                HPX_MOVE(comm), root_site, generation);
+        });
+    }
 }    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
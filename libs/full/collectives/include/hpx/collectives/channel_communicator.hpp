@@ -163,6 +163,12 @@ namespace hpx { namespace collectives {
 
         HPX_EXPORT void free();
 
+        // return the number of sites and the index of this site
+        std::pair<std::size_t, std::size_t> get_info() const noexcept
+        {
+            return comm_->get_info();
+        }
+
     private:
         std::shared_ptr<detail::channel_communicator> comm_;
     };
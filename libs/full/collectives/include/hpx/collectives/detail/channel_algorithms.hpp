@@ -0,0 +1,594 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/array.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// The collective operations implemented here exchange data directly between
+// the sites of a channel_communicator instead of funneling all data through
+// a single site.
+namespace hpx::collectives::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Amount of data (in bytes) starting from which the ring algorithm is
+    // selected by collective_algorithm::automatic for all_gather. This is
+    // applied only if all sites are known to send the same amount of data.
+    inline constexpr std::size_t ring_algorithm_threshold = 64 * 1024;
+
+    enum class channel_operation : std::size_t
+    {
+        all_reduce = 0,
+        all_gather = 1,
+        broadcast = 2,
+        size_check = 3
+    };
+
+    // Every step of a collective operation uses its own tag, tags are unique
+    // for each operation and generation (up to 2^20 steps per operation).
+    inline constexpr std::size_t max_channel_steps = std::size_t(1) << 20;
+
+    constexpr std::size_t make_channel_tag(std::size_t generation,
+        channel_operation operation, std::size_t step) noexcept
+    {
+        HPX_ASSERT(step < max_channel_steps);
+        return (((generation << 2) | static_cast<std::size_t>(operation))
+                   << 20) |
+            step;
+    }
+
+    constexpr bool is_power_of_two(std::size_t n) noexcept
+    {
+        return n != 0 && (n & (n - 1)) == 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct is_std_vector : std::false_type
+    {
+    };
+
+    template <typename T, typename Allocator>
+    struct is_std_vector<std::vector<T, Allocator>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_serialize_buffer : std::false_type
+    {
+    };
+
+    template <typename T, typename Allocator>
+    struct is_serialize_buffer<serialization::serialize_buffer<T, Allocator>>
+      : std::true_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    using channel_client = hpx::collectives::channel_communicator;
+
+    template <typename T>
+    hpx::future<void> send_to(channel_client& comm, std::size_t site,
+        T const& value, std::size_t tag)
+    {
+        return hpx::collectives::set(
+            comm, that_site_arg(site), value, tag_arg(tag));
+    }
+
+    template <typename T>
+    T receive_from(channel_client& comm, std::size_t site, std::size_t tag)
+    {
+        return hpx::collectives::get<T>(
+            comm, that_site_arg(site), tag_arg(tag))
+            .get();
+    }
+
+    // Send our value to the partner site and receive its value.
+    template <typename T>
+    T exchange_with(channel_client& comm, std::size_t partner, T const& value,
+        std::size_t tag, std::vector<hpx::future<void>>& sets)
+    {
+        sets.push_back(send_to(comm, partner, value, tag));
+        return receive_from<T>(comm, partner, tag);
+    }
+
+    inline void wait_for_sets(std::vector<hpx::future<void>>& sets)
+    {
+        // rethrows the first exception, if any
+        for (auto& f : sets)
+        {
+            f.get();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // all_reduce using recursive doubling, sites beyond the largest power of
+    // two first hand their value to a neighbor and receive the result at the
+    // end.
+    template <typename T, typename F>
+    T all_reduce_recursive_doubling(channel_client comm, T value, F& op,
+        std::size_t generation,
+        channel_operation operation = channel_operation::all_reduce)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+
+        std::size_t pof2 = 1;
+        while (pof2 * 2 <= num_sites)
+        {
+            pof2 *= 2;
+        }
+        std::size_t const rem = num_sites - pof2;
+
+        std::vector<hpx::future<void>> sets;
+        std::size_t step = 0;
+
+        // fold the first 2 * rem sites into rem sites
+        std::size_t new_site = this_site - rem;
+        if (this_site < 2 * rem)
+        {
+            std::size_t const tag =
+                make_channel_tag(generation, operation, step);
+            if (this_site % 2 == 0)
+            {
+                sets.push_back(send_to(comm, this_site + 1, value, tag));
+                new_site = static_cast<std::size_t>(-1);
+            }
+            else
+            {
+                T lower = receive_from<T>(comm, this_site - 1, tag);
+                value = op(HPX_MOVE(lower), HPX_MOVE(value));
+                new_site = this_site / 2;
+            }
+        }
+        ++step;
+
+        if (new_site != static_cast<std::size_t>(-1))
+        {
+            for (std::size_t mask = 1; mask < pof2; mask *= 2, ++step)
+            {
+                std::size_t const new_partner = new_site ^ mask;
+                std::size_t const partner = new_partner < rem ?
+                    new_partner * 2 + 1 :
+                    new_partner + rem;
+
+                T other = exchange_with(comm, partner, value,
+                    make_channel_tag(generation, operation, step), sets);
+
+                // combine values in the same order on both sites to produce
+                // identical results
+                if (new_site < new_partner)
+                {
+                    value = op(HPX_MOVE(value), HPX_MOVE(other));
+                }
+                else
+                {
+                    value = op(HPX_MOVE(other), HPX_MOVE(value));
+                }
+            }
+        }
+        else
+        {
+            for (std::size_t mask = 1; mask < pof2; mask *= 2)
+            {
+                ++step;
+            }
+        }
+
+        // hand the result to the sites folded above
+        if (this_site < 2 * rem)
+        {
+            std::size_t const tag =
+                make_channel_tag(generation, operation, step);
+            if (this_site % 2 == 0)
+            {
+                value = receive_from<T>(comm, this_site + 1, tag);
+            }
+            else
+            {
+                sets.push_back(send_to(comm, this_site - 1, value, tag));
+            }
+        }
+
+        wait_for_sets(sets);
+        return value;
+    }
+
+    // Make sure all sites supply the same number of elements, all sites throw
+    // if that is not the case.
+    inline void check_same_size(
+        channel_client comm, std::size_t size, std::size_t generation)
+    {
+        using size_range = std::array<std::size_t, 2>;
+        auto op = [](size_range lhs, size_range const& rhs) {
+            return size_range{(std::min)(lhs[0], rhs[0]),
+                (std::max)(lhs[1], rhs[1])};
+        };
+
+        size_range const sizes = all_reduce_recursive_doubling(HPX_MOVE(comm),
+            size_range{size, size}, op, generation,
+            channel_operation::size_check);
+        if (sizes[0] != sizes[1])
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::collectives::all_reduce",
+                "the ring algorithm requires all sites to supply values of "
+                "the same size");
+        }
+    }
+
+    // all_reduce using a ring, a reduce-scatter is followed by an all-gather.
+    // This requires all sites to supply vectors of the same size and the
+    // reduction operation to combine those element by element (it is invoked
+    // for sub-ranges of the vectors).
+    template <typename T, typename F>
+    T all_reduce_ring(
+        channel_client comm, T value, F& op, std::size_t generation)
+    {
+        static_assert(is_std_vector<T>::value,
+            "the ring algorithm for all_reduce requires std::vector values");
+
+        auto const [num_sites, this_site] = comm.get_info();
+        if (num_sites == 1)
+        {
+            return value;
+        }
+
+        std::size_t const size = value.size();
+        check_same_size(comm, size, generation);
+        auto chunk_begin = [&](std::size_t chunk) {
+            return value.begin() +
+                static_cast<std::ptrdiff_t>(chunk * size / num_sites);
+        };
+        auto chunk_end = [&](std::size_t chunk) {
+            return value.begin() +
+                static_cast<std::ptrdiff_t>((chunk + 1) * size / num_sites);
+        };
+
+        std::size_t const right = (this_site + 1) % num_sites;
+        std::size_t const left = (this_site + num_sites - 1) % num_sites;
+
+        std::vector<hpx::future<void>> sets;
+        sets.reserve(2 * (num_sites - 1));
+
+        // reduce-scatter: afterwards this site holds the fully reduced chunk
+        // (this_site + 1) % num_sites
+        for (std::size_t step = 0; step != num_sites - 1; ++step)
+        {
+            std::size_t const send_chunk =
+                (this_site + num_sites - step) % num_sites;
+            std::size_t const recv_chunk =
+                (this_site + num_sites - step - 1) % num_sites;
+            std::size_t const tag = make_channel_tag(
+                generation, channel_operation::all_reduce, step);
+
+            sets.push_back(send_to(comm, right,
+                T(chunk_begin(send_chunk), chunk_end(send_chunk)), tag));
+
+            T received = receive_from<T>(comm, left, tag);
+            T local(chunk_begin(recv_chunk), chunk_end(recv_chunk));
+            HPX_ASSERT(received.size() == local.size());
+
+            T reduced = op(HPX_MOVE(received), HPX_MOVE(local));
+            HPX_ASSERT(reduced.size() ==
+                static_cast<std::size_t>(
+                    chunk_end(recv_chunk) - chunk_begin(recv_chunk)));
+            std::move(reduced.begin(), reduced.end(), chunk_begin(recv_chunk));
+        }
+
+        // all-gather: pass the reduced chunks around the ring
+        for (std::size_t step = 0; step != num_sites - 1; ++step)
+        {
+            std::size_t const send_chunk =
+                (this_site + 1 + num_sites - step) % num_sites;
+            std::size_t const recv_chunk =
+                (this_site + num_sites - step) % num_sites;
+            std::size_t const tag = make_channel_tag(generation,
+                channel_operation::all_reduce, num_sites - 1 + step);
+
+            sets.push_back(send_to(comm, right,
+                T(chunk_begin(send_chunk), chunk_end(send_chunk)), tag));
+
+            T received = receive_from<T>(comm, left, tag);
+            std::move(
+                received.begin(), received.end(), chunk_begin(recv_chunk));
+        }
+
+        wait_for_sets(sets);
+        return value;
+    }
+
+    template <typename T, typename F>
+    T channel_all_reduce(channel_client comm, T value, F& op,
+        collective_algorithm algorithm, std::size_t generation)
+    {
+        // The ring algorithm is supported for vectors only. It is used only
+        // if requested explicitly as it requires the operation to be applied
+        // element-wise.
+        if constexpr (is_std_vector<T>::value)
+        {
+            if (algorithm == collective_algorithm::ring)
+            {
+                return all_reduce_ring(
+                    HPX_MOVE(comm), HPX_MOVE(value), op, generation);
+            }
+        }
+
+        return all_reduce_recursive_doubling(
+            HPX_MOVE(comm), HPX_MOVE(value), op, generation);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // all_gather using recursive doubling, supported for a power of two
+    // number of sites only
+    template <typename T>
+    std::vector<T> all_gather_recursive_doubling(
+        channel_client comm, T value, std::size_t generation)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+        HPX_ASSERT(is_power_of_two(num_sites));
+
+        std::vector<T> result(num_sites);
+        result[this_site] = HPX_MOVE(value);
+
+        std::vector<hpx::future<void>> sets;
+
+        std::size_t step = 0;
+        for (std::size_t mask = 1; mask < num_sites; mask *= 2, ++step)
+        {
+            // we hold the values of the sites [first, first + mask), the
+            // partner holds the adjacent block of the same size
+            std::size_t const partner = this_site ^ mask;
+            std::size_t const first = this_site & ~(mask - 1);
+            std::size_t const partner_first = partner & ~(mask - 1);
+
+            std::vector<T> block(
+                result.begin() + static_cast<std::ptrdiff_t>(first),
+                result.begin() + static_cast<std::ptrdiff_t>(first + mask));
+
+            std::vector<T> received = exchange_with(comm, partner, block,
+                make_channel_tag(
+                    generation, channel_operation::all_gather, step),
+                sets);
+            HPX_ASSERT(received.size() == mask);
+
+            std::move(received.begin(), received.end(),
+                result.begin() + static_cast<std::ptrdiff_t>(partner_first));
+        }
+
+        wait_for_sets(sets);
+        return result;
+    }
+
+    // all_gather using a ring, every value is passed on to the next site
+    template <typename T>
+    std::vector<T> all_gather_ring(
+        channel_client comm, T value, std::size_t generation)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+
+        std::vector<T> result(num_sites);
+        result[this_site] = HPX_MOVE(value);
+
+        std::size_t const right = (this_site + 1) % num_sites;
+        std::size_t const left = (this_site + num_sites - 1) % num_sites;
+
+        std::vector<hpx::future<void>> sets;
+        sets.reserve(num_sites);
+
+        for (std::size_t step = 0; step + 1 < num_sites; ++step)
+        {
+            std::size_t const send_site =
+                (this_site + num_sites - step) % num_sites;
+            std::size_t const recv_site =
+                (this_site + num_sites - step - 1) % num_sites;
+            std::size_t const tag = make_channel_tag(
+                generation, channel_operation::all_gather, step);
+
+            sets.push_back(send_to(comm, right, result[send_site], tag));
+            result[recv_site] = receive_from<T>(comm, left, tag);
+        }
+
+        wait_for_sets(sets);
+        return result;
+    }
+
+    template <typename T>
+    std::vector<T> channel_all_gather(channel_client comm, T value,
+        collective_algorithm algorithm, std::size_t generation)
+    {
+        std::size_t const num_sites = comm.get_info().first;
+
+        // Recursive doubling is supported for a power of two number of sites
+        // only, the total amount of data sent is the same for both algorithms.
+        // All sites have to pick the same algorithm, the automatic selection
+        // therefore depends on the type of the values and on the number of
+        // sites only.
+        if (algorithm == collective_algorithm::ring ||
+            !is_power_of_two(num_sites) ||
+            (algorithm == collective_algorithm::automatic &&
+                std::is_trivially_copyable_v<T> &&
+                sizeof(T) * num_sites >= ring_algorithm_threshold))
+        {
+            return all_gather_ring(HPX_MOVE(comm), HPX_MOVE(value), generation);
+        }
+        return all_gather_recursive_doubling(
+            HPX_MOVE(comm), HPX_MOVE(value), generation);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The sites taking part in a broadcast form a binary tree rooted at the
+    // broadcasting site. Every site receives the data from its parent and
+    // forwards it to (at most) two children.
+    class broadcast_tree
+    {
+    public:
+        broadcast_tree(std::size_t num_sites, std::size_t this_site,
+            std::size_t root_site) noexcept
+          : num_sites_(num_sites)
+          , root_site_(root_site)
+          , rank_((this_site + num_sites - root_site) % num_sites)
+        {
+        }
+
+        std::size_t parent() const noexcept
+        {
+            HPX_ASSERT(rank_ != 0);
+            return site((rank_ - 1) / 2);
+        }
+
+        template <typename T>
+        void send_to_children(channel_client& comm, T const& value,
+            std::size_t tag, std::vector<hpx::future<void>>& sets) const
+        {
+            for (std::size_t child = 2 * rank_ + 1;
+                child <= 2 * rank_ + 2 && child < num_sites_; ++child)
+            {
+                sets.push_back(send_to(comm, site(child), value, tag));
+            }
+        }
+
+    private:
+        std::size_t site(std::size_t rank) const noexcept
+        {
+            return (rank + root_site_) % num_sites_;
+        }
+
+        std::size_t num_sites_;
+        std::size_t root_site_;
+        std::size_t rank_;
+    };
+
+    // The first message of a broadcast holds the number of elements of the
+    // value and the number of elements per segment.
+    using broadcast_header = std::array<std::size_t, 2>;
+
+    // Split the value into segments and send those down the tree. The
+    // segments refer to the data of the value, no copies are made.
+    template <typename T, typename Allocator>
+    void channel_broadcast_to(channel_client comm,
+        serialization::serialize_buffer<T, Allocator> const& value,
+        std::size_t segment_size, std::size_t generation)
+    {
+        using buffer_type = serialization::serialize_buffer<T, Allocator>;
+
+        auto const [num_sites, this_site] = comm.get_info();
+        broadcast_tree const tree(num_sites, this_site, this_site);
+
+        // the header and every segment use their own tag
+        std::size_t const size = value.size();
+        std::size_t segment =
+            (std::max)(segment_size / sizeof(T), std::size_t(1));
+        if ((size + segment - 1) / segment >= max_channel_steps)
+        {
+            segment =
+                (size + max_channel_steps - 2) / (max_channel_steps - 1);
+        }
+        std::size_t const num_segments = (size + segment - 1) / segment;
+
+        std::vector<hpx::future<void>> sets;
+        sets.reserve(2 * (num_segments + 1));
+
+        tree.send_to_children(comm, broadcast_header{size, segment},
+            make_channel_tag(generation, channel_operation::broadcast, 0),
+            sets);
+
+        T* data = const_cast<T*>(value.data());
+        for (std::size_t i = 0; i != num_segments; ++i)
+        {
+            std::size_t const first = i * segment;
+
+            // keep the data alive until all segments have been sent
+            buffer_type const part(data + first,
+                (std::min)(segment, size - first), buffer_type::reference,
+                [keep_alive = value](T*) noexcept { HPX_UNUSED(keep_alive); });
+
+            tree.send_to_children(comm, part,
+                make_channel_tag(
+                    generation, channel_operation::broadcast, i + 1),
+                sets);
+        }
+
+        wait_for_sets(sets);
+    }
+
+    // Receive the segments of a value from the parent site and forward each
+    // of those to the children as soon as it has arrived. This pipelines the
+    // transfer of consecutive segments along the tree.
+    template <typename Buffer>
+    Buffer channel_broadcast_from(
+        channel_client comm, std::size_t root_site, std::size_t generation)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+        HPX_ASSERT(this_site != root_site);
+
+        broadcast_tree const tree(num_sites, this_site, root_site);
+        std::size_t const parent = tree.parent();
+
+        std::vector<hpx::future<void>> sets;
+
+        std::size_t const header_tag =
+            make_channel_tag(generation, channel_operation::broadcast, 0);
+        broadcast_header const header =
+            receive_from<broadcast_header>(comm, parent, header_tag);
+        tree.send_to_children(comm, header, header_tag, sets);
+
+        std::size_t const size = header[0];
+        std::size_t const segment = header[1];
+        std::size_t const num_segments = (size + segment - 1) / segment;
+
+        // request all segments up front
+        std::vector<hpx::future<Buffer>> parts;
+        parts.reserve(num_segments);
+        for (std::size_t i = 0; i != num_segments; ++i)
+        {
+            parts.push_back(hpx::collectives::get<Buffer>(comm,
+                that_site_arg(parent),
+                tag_arg(make_channel_tag(
+                    generation, channel_operation::broadcast, i + 1))));
+        }
+
+        sets.reserve(sets.size() + 2 * num_segments);
+
+        Buffer result(size);
+        for (std::size_t i = 0; i != num_segments; ++i)
+        {
+            Buffer part = parts[i].get();
+            HPX_ASSERT(part.size() == (std::min)(segment, size - i * segment));
+
+            tree.send_to_children(comm, part,
+                make_channel_tag(
+                    generation, channel_operation::broadcast, i + 1),
+                sets);
+
+            std::copy(part.data(), part.data() + part.size(),
+                result.data() + i * segment);
+        }
+
+        wait_for_sets(sets);
+        return result;
+    }
+}    // namespace hpx::collectives::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
@@ -60,8 +60,16 @@ namespace hpx { namespace collectives { namespace detail {
                 util::ignore_while_checking il(&l);
                 HPX_UNUSED(il);
 
-                channel_type& c = data_[which].channels_[tag];
-                f = c.get();
+                auto& channels = data_[which].channels_;
+                auto it = channels.try_emplace(tag).first;
+                f = it->second.channel.get();
+
+                // the entry is not needed anymore once all values set have
+                // been retrieved
+                if (--it->second.pending == 0)
+                {
+                    channels.erase(it);
+                }
             }
 
             return f.then(
@@ -87,7 +95,16 @@ namespace hpx { namespace collectives { namespace detail {
             util::ignore_while_checking il(&l);
             HPX_UNUSED(il);
 
-            data_[which].channels_[tag].set(unique_any_nonser(HPX_MOVE(value)));
+            auto& channels = data_[which].channels_;
+            auto it = channels.try_emplace(tag).first;
+            it->second.channel.set(unique_any_nonser(HPX_MOVE(value)));
+
+            // the entry is not needed anymore if the value was requested
+            // already
+            if (++it->second.pending == 0)
+            {
+                channels.erase(it);
+            }
         }
 
         template <typename T>
@@ -100,10 +117,19 @@ namespace hpx { namespace collectives { namespace detail {
         };
 
     private:
+        struct channel_data
+        {
+            channel_type channel;
+
+            // number of values set but not retrieved yet, negative if values
+            // were requested before being set
+            std::ptrdiff_t pending = 0;
+        };
+
         struct locality_data
         {
             hpx::spinlock mtx_;
-            std::map<std::size_t, channel_type> channels_;
+            std::map<std::size_t, channel_data> channels_;
         };
 
         mutable std::vector<locality_data> data_;
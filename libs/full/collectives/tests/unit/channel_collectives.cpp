@@ -0,0 +1,264 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify all_reduce and all_gather performed on a channel_communicator for
+// all supported algorithms and the segmented broadcast, using a power of two
+// and a different number of sites. Values of different sizes passed to the
+// ring algorithm have to be reported on all sites.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr char const* channel_collectives_basename =
+    "/test/channel_collectives/";
+constexpr std::size_t ITERATIONS = 10;
+
+collective_algorithm const algorithms[] = {collective_algorithm::automatic,
+    collective_algorithm::recursive_doubling, collective_algorithm::ring};
+
+///////////////////////////////////////////////////////////////////////////////
+struct vector_plus
+{
+    std::vector<std::uint64_t> operator()(std::vector<std::uint64_t> lhs,
+        std::vector<std::uint64_t> const& rhs) const
+    {
+        HPX_TEST_EQ(lhs.size(), rhs.size());
+        for (std::size_t i = 0; i != lhs.size(); ++i)
+        {
+            lhs[i] += rhs[i];
+        }
+        return lhs;
+    }
+};
+
+// not applied element-wise, this can't be used with the ring algorithm
+struct vector_max
+{
+    std::vector<std::uint64_t> operator()(std::vector<std::uint64_t> lhs,
+        std::vector<std::uint64_t> const& rhs) const
+    {
+        return (std::max)(lhs, rhs);
+    }
+};
+
+void test_size_mismatch(
+    std::size_t site, channel_communicator comm, std::size_t& generation)
+{
+    std::vector<std::uint64_t> value(site == 0 ? 11 : 10);
+
+    bool caught_exception = false;
+    try
+    {
+        all_reduce(comm, value, vector_plus{}, collective_algorithm::ring,
+            generation_arg(++generation))
+            .get();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+// the root site of a broadcast can't receive the broadcast value
+void test_broadcast_from_root(std::size_t site, channel_communicator comm)
+{
+    using buffer_type = hpx::serialization::serialize_buffer<char>;
+
+    bool caught_exception = false;
+    try
+    {
+        broadcast_from<buffer_type>(comm, root_site_arg(site)).get();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_site(std::size_t num_sites, std::size_t site,
+    channel_communicator comm, std::size_t vector_size)
+{
+    std::size_t generation = 0;
+    for (std::size_t i = 0; i != ITERATIONS; ++i)
+    {
+        for (collective_algorithm const algorithm : algorithms)
+        {
+            // all_reduce of plain values
+            {
+                hpx::future<std::uint64_t> result = all_reduce(comm,
+                    std::uint64_t(site + i), std::plus<std::uint64_t>{},
+                    algorithm, generation_arg(++generation));
+
+                std::uint64_t expected = 0;
+                for (std::size_t j = 0; j != num_sites; ++j)
+                {
+                    expected += j + i;
+                }
+                HPX_TEST_EQ(expected, result.get());
+            }
+
+            // all_reduce of vectors, the ring algorithm splits those
+            {
+                std::vector<std::uint64_t> value(vector_size);
+                for (std::size_t k = 0; k != vector_size; ++k)
+                {
+                    value[k] = site * k + i;
+                }
+
+                std::vector<std::uint64_t> const result =
+                    all_reduce(comm, value, vector_plus{}, algorithm,
+                        generation_arg(++generation))
+                        .get();
+
+                HPX_TEST_EQ(result.size(), vector_size);
+                for (std::size_t k = 0; k != result.size(); ++k)
+                {
+                    std::uint64_t expected = 0;
+                    for (std::size_t j = 0; j != num_sites; ++j)
+                    {
+                        expected += j * k + i;
+                    }
+                    HPX_TEST_EQ(expected, result[k]);
+                }
+            }
+
+            // all_reduce of vectors using an operation which is not
+            // applied element-wise
+            if (algorithm != collective_algorithm::ring)
+            {
+                std::vector<std::uint64_t> value(vector_size);
+                for (std::size_t k = 0; k != vector_size; ++k)
+                {
+                    value[k] = site * k + i;
+                }
+
+                std::vector<std::uint64_t> const result =
+                    all_reduce(comm, value, vector_max{}, algorithm,
+                        generation_arg(++generation))
+                        .get();
+
+                HPX_TEST_EQ(result.size(), vector_size);
+                for (std::size_t k = 0; k != result.size(); ++k)
+                {
+                    HPX_TEST_EQ((num_sites - 1) * k + i, result[k]);
+                }
+            }
+
+            // all_gather
+            {
+                std::vector<std::uint64_t> const result =
+                    all_gather(comm, std::uint64_t(site + i), algorithm,
+                        generation_arg(++generation))
+                        .get();
+
+                HPX_TEST_EQ(result.size(), num_sites);
+                for (std::size_t j = 0; j != result.size(); ++j)
+                {
+                    HPX_TEST_EQ(j + i, result[j]);
+                }
+            }
+        }
+
+        // segmented broadcast from a different site each time
+        if (num_sites > 1)
+        {
+            using buffer_type = hpx::serialization::serialize_buffer<char>;
+
+            std::size_t const root = i % num_sites;
+            if (site == root)
+            {
+                buffer_type value(vector_size);
+                for (std::size_t k = 0; k != vector_size; ++k)
+                {
+                    value[k] = static_cast<char>(k + i);
+                }
+
+                broadcast_to(comm, value, segment_size_arg(1000),
+                    generation_arg(++generation))
+                    .get();
+            }
+            else
+            {
+                hpx::future<buffer_type> f = broadcast_from<buffer_type>(
+                    comm, root_site_arg(root), generation_arg(++generation));
+
+                buffer_type const result = f.get();
+
+                HPX_TEST_EQ(result.size(), vector_size);
+                for (std::size_t k = 0; k != result.size(); ++k)
+                {
+                    HPX_TEST_EQ(result[k], static_cast<char>(k + i));
+                }
+            }
+        }
+    }
+
+    if (num_sites > 1)
+    {
+        test_size_mismatch(site, comm, generation);
+    }
+    test_broadcast_from_root(site, comm);
+}
+
+void test_channel_collectives(std::size_t num_sites, std::size_t vector_size)
+{
+    std::string const basename = std::string(channel_collectives_basename) +
+        std::to_string(num_sites) + "/" + std::to_string(vector_size);
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_sites);
+
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        tasks.push_back(hpx::async([=]() {
+            auto comm = create_channel_communicator(hpx::launch::sync,
+                basename.c_str(), num_sites_arg(num_sites),
+                this_site_arg(site));
+
+            test_site(num_sites, site, comm, vector_size);
+        }));
+    }
+
+    hpx::wait_all(tasks);
+}
+
+int hpx_main()
+{
+    for (std::size_t num_sites : {1, 2, 5, 8})
+    {
+        // less elements than sites and a lot of elements
+        test_channel_collectives(num_sites, 3);
+        test_channel_collectives(num_sites, 10000);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+
+#endif
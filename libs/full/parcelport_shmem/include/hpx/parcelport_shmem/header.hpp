@@ -0,0 +1,45 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <cstdint>
+#include <type_traits>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // Each message written to a ring starts with this header. It is followed
+    // by the transmission chunks (if there are zero-copy chunks), the
+    // non-zero-copy data, and all zero-copy chunks. Each zero-copy chunk is
+    // preceded by a chunk_reference: a non-zero address refers to the chunk
+    // data in the address space of the sender (which the receiver copies
+    // directly), otherwise the chunk data follows in the ring.
+    struct header
+    {
+        // size of the non-zero-copy data
+        std::uint64_t size;
+
+        // overall number of bytes serialized
+        std::uint64_t data_size;
+
+        // number of zero-copy and non-zero-copy chunks
+        std::uint32_t num_zero_copy_chunks;
+        std::uint32_t num_non_zero_copy_chunks;
+    };
+
+    struct chunk_reference
+    {
+        std::uint64_t address;
+    };
+
+    static_assert(std::is_trivially_copyable_v<header> &&
+        std::is_trivially_copyable_v<chunk_reference>);
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
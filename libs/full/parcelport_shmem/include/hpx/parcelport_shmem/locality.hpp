@@ -0,0 +1,85 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // A shared memory endpoint is identified by the node it runs on and by
+    // the process owning the shared memory segment other localities on the
+    // same node send their messages to.
+    class locality
+    {
+    public:
+        constexpr locality() noexcept
+          : host_id_(0)
+          , pid_(-1)
+        {
+        }
+
+        constexpr locality(std::uint64_t host_id, std::int32_t pid) noexcept
+          : host_id_(host_id)
+          , pid_(pid)
+        {
+        }
+
+        // The host id is zero if the locality was not able to set up its
+        // shared memory segment, nobody is able to connect to it in this
+        // case.
+        [[nodiscard]] constexpr std::uint64_t host_id() const noexcept
+        {
+            return host_id_;
+        }
+
+        [[nodiscard]] constexpr std::int32_t pid() const noexcept
+        {
+            return pid_;
+        }
+
+        [[nodiscard]] static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        [[nodiscard]] explicit constexpr operator bool() const noexcept
+        {
+            return pid_ != -1;
+        }
+
+        HPX_EXPORT void save(serialization::output_archive& ar) const;
+        HPX_EXPORT void load(serialization::input_archive& ar);
+
+    private:
+        friend constexpr bool operator==(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.host_id_ == rhs.host_id_ && lhs.pid_ == rhs.pid_;
+        }
+
+        friend constexpr bool operator<(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.host_id_ < rhs.host_id_ ||
+                (lhs.host_id_ == rhs.host_id_ && lhs.pid_ < rhs.pid_);
+        }
+
+        friend HPX_EXPORT std::ostream& operator<<(
+            std::ostream& os, locality const& loc) noexcept;
+
+        std::uint64_t host_id_;
+        std::int32_t pid_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,123 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/thread_support.hpp>
+#include <hpx/parcelport_shmem/receiver_connection.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // Polls the rings of the shared memory segment of this locality for
+    // incoming messages.
+    template <typename Parcelport>
+    struct receiver
+    {
+        using connection_type = receiver_connection<Parcelport>;
+        using connection_ptr = std::unique_ptr<connection_type>;
+
+        receiver(Parcelport& pp, shared_memory_segment const& segment)
+          : pp_(pp)
+          , segment_(segment)
+          , slots_(segment ? new slot[segment.ring_count()] : nullptr)
+          , next_slot_(0)
+        {
+        }
+
+        void run() noexcept {}
+
+        bool background_work(std::size_t num_thread = -1)
+        {
+            if (!segment_)
+            {
+                return false;
+            }
+
+            std::size_t const count = segment_.rings_in_use();
+            if (count == 0)
+            {
+                return false;
+            }
+
+            // let concurrent callers start at different rings
+            std::size_t const start =
+                next_slot_.fetch_add(1, std::memory_order_relaxed) % count;
+
+            bool has_work = false;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                has_work =
+                    receive_messages((start + i) % count, num_thread) ||
+                    has_work;
+            }
+            return has_work;
+        }
+
+    private:
+        struct slot
+        {
+            hpx::spinlock mtx;
+            connection_ptr connection;
+        };
+
+        bool receive_messages(std::size_t index, std::size_t num_thread)
+        {
+            ring const r = segment_.get_ring(index);
+            ring_control& ctrl = r.control();
+
+            std::uint32_t const state =
+                ctrl.state.load(std::memory_order_acquire);
+            if (state != ring_control::active && state != ring_control::closed)
+            {
+                return false;
+            }
+
+            slot& s = slots_[index];
+
+            std::unique_lock const l(s.mtx, std::try_to_lock);
+            if (!l.owns_lock())
+            {
+                return false;
+            }
+
+            if (!s.connection)
+            {
+                s.connection = std::make_unique<connection_type>(r, pp_);
+            }
+
+            bool const has_work = s.connection->receive(num_thread);
+
+            // the sender has written everything before closing the ring, the
+            // ring can be reused once all of that has been received
+            if (state == ring_control::closed && r.empty() &&
+                s.connection->idle())
+            {
+                s.connection.reset();
+                segment_.release_ring(index);
+            }
+
+            return has_work;
+        }
+
+        Parcelport& pp_;
+        shared_memory_segment const& segment_;
+
+        std::unique_ptr<slot[]> slots_;
+        std::atomic<std::size_t> next_slot_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
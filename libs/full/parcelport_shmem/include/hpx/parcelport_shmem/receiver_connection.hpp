@@ -0,0 +1,388 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/parcelport_shmem/header.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // Receives the messages written to one of the rings of the shared memory
+    // segment of this locality, one message after the other.
+    template <typename Parcelport>
+    struct receiver_connection
+    {
+    private:
+        enum connection_state
+        {
+            initialized,
+            rcvd_header,
+            rcvd_transmission_chunks,
+            rcvd_data,
+            rcvd_chunks
+        };
+
+        using data_type = std::vector<char>;
+        using buffer_type =
+            parcel_buffer<data_type, serialization::serialization_chunk>;
+
+        struct chunk_target
+        {
+            void* data;
+            std::size_t size;
+        };
+
+    public:
+        receiver_connection(ring r, Parcelport& pp) noexcept
+          : state_(initialized)
+          , ring_(r)
+          , header_()
+          , reference_()
+          , transferred_(0)
+          , chunks_idx_(0)
+          , reading_reference_(true)
+          , pp_(pp)
+        {
+            decide_on_references();
+        }
+
+        // whether there is no partially received message
+        [[nodiscard]] bool idle() const noexcept
+        {
+            return state_ == initialized && transferred_ == 0;
+        }
+
+        // Receive and handle as many messages as are available, returns
+        // whether any data was consumed.
+        bool receive(std::size_t num_thread = -1)
+        {
+            std::uint64_t const start =
+                ring_.control().tail.load(std::memory_order_relaxed);
+
+            while (receive_message(num_thread))
+            {
+            }
+
+            return ring_.control().tail.load(std::memory_order_relaxed) !=
+                start;
+        }
+
+    private:
+        // Allow the sender to hand off chunks by reference if this process
+        // is able to read the senders memory (this might be prohibited by the
+        // system configuration, e.g. by the Yama security module).
+        void decide_on_references() noexcept
+        {
+            ring_control& ctrl = ring_.control();
+            if (ctrl.references.load(std::memory_order_relaxed) !=
+                ring_control::undecided)
+            {
+                return;
+            }
+
+            std::uint64_t value = 0;
+            bool const enabled = read_process_memory(ctrl.sender_pid,
+                                     ctrl.probe_address, &value,
+                                     sizeof(value)) &&
+                value == ctrl.probe_value;
+
+            ctrl.references.store(
+                enabled ? ring_control::enabled : ring_control::disabled,
+                std::memory_order_release);
+        }
+
+        bool receive_message(std::size_t num_thread)
+        {
+            switch (state_)
+            {
+            case initialized:
+                return receive_header();
+
+            case rcvd_header:
+                return receive_transmission_chunks();
+
+            case rcvd_transmission_chunks:
+                return receive_data(num_thread);
+
+            case rcvd_data:
+                return receive_chunks(num_thread);
+
+            case rcvd_chunks:
+                return done(num_thread);
+
+            default:
+                HPX_ASSERT(false);
+            }
+            return false;
+        }
+
+        bool receive_header()
+        {
+            HPX_ASSERT(state_ == initialized);
+            if (!ring_.read_some(&header_, sizeof(header_), transferred_))
+            {
+                return false;
+            }
+            transferred_ = 0;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.bytes_ = static_cast<std::size_t>(header_.size);
+#endif
+            buffer_.size_ = header_.size;
+            buffer_.data_size_ = header_.data_size;
+            buffer_.num_chunks_.first = header_.num_zero_copy_chunks;
+            buffer_.num_chunks_.second = header_.num_non_zero_copy_chunks;
+
+            buffer_.data_.resize(static_cast<std::size_t>(header_.size));
+            if (header_.num_zero_copy_chunks != 0)
+            {
+                buffer_.transmission_chunks_.resize(
+                    static_cast<std::size_t>(header_.num_zero_copy_chunks) +
+                    header_.num_non_zero_copy_chunks);
+            }
+
+            state_ = rcvd_header;
+            return receive_transmission_chunks();
+        }
+
+        bool receive_transmission_chunks()
+        {
+            HPX_ASSERT(state_ == rcvd_header);
+
+            auto& tchunks = buffer_.transmission_chunks_;
+            if (!ring_.read_some(tchunks.data(),
+                    tchunks.size() *
+                        sizeof(buffer_type::transmission_chunk_type),
+                    transferred_))
+            {
+                return false;
+            }
+            transferred_ = 0;
+
+            state_ = rcvd_transmission_chunks;
+            return true;
+        }
+
+        bool receive_data(std::size_t num_thread)
+        {
+            HPX_ASSERT(state_ == rcvd_transmission_chunks);
+            if (!ring_.read_some(
+                    buffer_.data_.data(), buffer_.data_.size(), transferred_))
+            {
+                return false;
+            }
+            transferred_ = 0;
+
+            // determine where the zero-copy chunks have to be placed
+            auto const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+
+            chunks_idx_ = 0;
+            reading_reference_ = true;
+            targets_.clear();
+
+            if (num_zero_copy_chunks != 0)
+            {
+                buffer_.chunks_.resize(num_zero_copy_chunks);
+                targets_.reserve(num_zero_copy_chunks);
+
+                if (pp_.allow_zero_copy_receive_optimizations())
+                {
+                    // De-serialize the parcels such that all data but the
+                    // zero-copy chunks are in place. This de-serialization
+                    // also allocates all zero-chunk buffers and stores those
+                    // in the chunks array for the chunk data to be placed
+                    // there directly.
+                    for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                    {
+                        auto const chunk_size = static_cast<std::size_t>(
+                            buffer_.transmission_chunks_[i].second);
+                        buffer_.chunks_[i] =
+                            serialization::create_pointer_chunk(
+                                nullptr, chunk_size);
+                    }
+
+                    parcels_ =
+                        decode_parcels_zero_copy(pp_, buffer_, num_thread);
+
+                    // note that at this point, buffer_.chunks_ will have
+                    // entries for all chunks, including the non-zero-copy ones
+                    std::size_t zero_copy_chunks = 0;
+                    for (auto& c : buffer_.chunks_)
+                    {
+                        if (c.type_ ==
+                            serialization::chunk_type::chunk_type_index)
+                        {
+                            continue;    // skip non-zero-copy chunks
+                        }
+
+                        auto const chunk_size = static_cast<std::size_t>(
+                            buffer_.transmission_chunks_[zero_copy_chunks++]
+                                .second);
+
+                        HPX_ASSERT_MSG(
+                            c.data() != nullptr && c.size() == chunk_size,
+                            "zero-copy chunk buffers should have been "
+                            "initialized during de-serialization");
+
+                        targets_.push_back(chunk_target{c.data(), chunk_size});
+                    }
+                    HPX_ASSERT(zero_copy_chunks == num_zero_copy_chunks);
+                }
+                else
+                {
+                    chunk_buffers_.resize(num_zero_copy_chunks);
+                    for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                    {
+                        auto const chunk_size = static_cast<std::size_t>(
+                            buffer_.transmission_chunks_[i].second);
+
+                        auto& c = chunk_buffers_[i];
+                        c.resize(chunk_size);
+
+                        // store buffer for decode_parcels below
+                        buffer_.chunks_[i] =
+                            serialization::create_pointer_chunk(
+                                c.data(), chunk_size);
+
+                        targets_.push_back(chunk_target{c.data(), chunk_size});
+                    }
+                }
+            }
+
+            state_ = rcvd_data;
+            return true;
+        }
+
+        bool receive_chunks(std::size_t num_thread)
+        {
+            HPX_ASSERT(state_ == rcvd_data);
+
+            while (chunks_idx_ != targets_.size())
+            {
+                chunk_target const& target = targets_[chunks_idx_];
+
+                if (reading_reference_)
+                {
+                    if (!ring_.read_some(
+                            &reference_, sizeof(reference_), transferred_))
+                    {
+                        return false;
+                    }
+                    transferred_ = 0;
+
+                    if (reference_.address != 0)
+                    {
+                        // the sender keeps the chunk alive until the message
+                        // has been consumed completely
+                        if (!read_process_memory(
+                                ring_.control().sender_pid, reference_.address,
+                                target.data, target.size))
+                        {
+                            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                                "shmem::receiver_connection::receive_chunks",
+                                "could not copy chunk data from process {}",
+                                ring_.control().sender_pid);
+                        }
+
+                        ++chunks_idx_;
+                        continue;
+                    }
+
+                    reading_reference_ = false;
+                }
+
+                // the chunk data follows in the ring
+                if (!ring_.read_some(target.data, target.size, transferred_))
+                {
+                    return false;
+                }
+                transferred_ = 0;
+
+                reading_reference_ = true;
+                ++chunks_idx_;
+            }
+
+            state_ = rcvd_chunks;
+            return done(num_thread);
+        }
+
+        bool done(std::size_t num_thread)
+        {
+            HPX_ASSERT(state_ == rcvd_chunks);
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds() - data.time_;
+#endif
+            if (parcels_.empty())
+            {
+                // decode and handle received data
+                HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
+                    !pp_.allow_zero_copy_receive_optimizations());
+                handle_received_parcels(
+                    decode_parcels(pp_, HPX_MOVE(buffer_), num_thread),
+                    num_thread);
+                chunk_buffers_.clear();
+            }
+            else
+            {
+                // handle the received zero-copy parcels.
+                HPX_ASSERT(buffer_.num_chunks_.first != 0 &&
+                    pp_.allow_zero_copy_receive_optimizations());
+                handle_received_parcels(HPX_MOVE(parcels_), num_thread);
+            }
+
+            buffer_ = buffer_type{};
+            parcels_.clear();
+            targets_.clear();
+
+            state_ = initialized;
+            return true;
+        }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+        connection_state state_;
+
+        ring ring_;
+        header header_;
+        chunk_reference reference_;
+        std::size_t transferred_;
+        std::size_t chunks_idx_;
+        bool reading_reference_;
+
+        buffer_type buffer_;
+        std::vector<chunk_target> targets_;
+
+        Parcelport& pp_;
+
+        std::vector<parcelset::parcel> parcels_;
+        std::vector<std::vector<char>> chunk_buffers_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
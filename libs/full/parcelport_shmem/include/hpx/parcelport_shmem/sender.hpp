@@ -0,0 +1,186 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/thread_support.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/sender_connection.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    struct sender
+    {
+        using connection_type = sender_connection;
+        using connection_ptr = std::shared_ptr<connection_type>;
+        using connection_list = std::deque<connection_ptr>;
+
+        sender(std::int32_t pid, std::size_t reference_threshold) noexcept
+          : pid_(pid)
+          , reference_threshold_(reference_threshold)
+          , probe_(static_cast<std::uint64_t>(pid) ^ 0x5a5a'5a5a'0000'0000ULL)
+        {
+        }
+
+        void run() noexcept {}
+
+        // the destination can be reached only if its shared memory segment
+        // can be mapped into this process
+        bool can_connect(parcelset::locality const& dest)
+        {
+            error_code ec(throwmode::lightweight);
+            return get_segment(dest.get<locality>().pid(), ec) != nullptr;
+        }
+
+        connection_ptr create_connection(parcelset::locality const& dest,
+            parcelset::parcelport* pp, error_code& ec)
+        {
+            std::shared_ptr<shared_memory_segment> segment =
+                get_segment(dest.get<locality>().pid(), ec);
+            if (ec)
+            {
+                return {};
+            }
+
+            // the receiver verifies that it can access the memory of this
+            // process by reading the probe value
+            std::size_t const ring_index = segment->claim_ring(pid_,
+                static_cast<std::uint64_t>(
+                    reinterpret_cast<std::uintptr_t>(&probe_)),
+                probe_);
+            if (ring_index == segment->ring_count())
+            {
+                HPX_THROWS_IF(ec, hpx::error::network_error,
+                    "shmem::sender::create_connection",
+                    "all {} rings of the shared memory segment of locality {} "
+                    "are in use (consider increasing "
+                    "hpx.parcel.shmem.ring_count)",
+                    segment->ring_count(), dest);
+                return {};
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return std::make_shared<connection_type>(this, HPX_MOVE(segment),
+                ring_index, reference_threshold_, dest, pp);
+        }
+
+        void add(connection_ptr const& ptr)
+        {
+            std::unique_lock l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        void send_messages(connection_ptr connection)
+        {
+            // Check if sending has been completed....
+            if (connection->send())
+            {
+                error_code const ec(throwmode::lightweight);
+                hpx::move_only_function<void(error_code const&,
+                    parcelset::locality const&, connection_ptr)>
+                    postprocess_handler;
+                std::swap(
+                    postprocess_handler, connection->postprocess_handler_);
+                if (postprocess_handler)
+                    postprocess_handler(
+                        ec, connection->destination(), connection);
+            }
+            else
+            {
+                std::unique_lock l(connections_mtx_);
+                connections_.push_back(HPX_MOVE(connection));
+            }
+        }
+
+        bool background_work() noexcept
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock const l(connections_mtx_, std::try_to_lock);
+                if (l && !connections_.empty())
+                {
+                    connection = HPX_MOVE(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+
+            bool has_work = false;
+            if (connection)
+            {
+                send_messages(HPX_MOVE(connection));
+                has_work = true;
+            }
+            return has_work;
+        }
+
+    private:
+        // all connections to the same locality share the mapping of its
+        // shared memory segment, segments which could not be mapped are
+        // remembered as well to avoid retrying this for every parcel
+        std::shared_ptr<shared_memory_segment> get_segment(
+            std::int32_t pid, error_code& ec)
+        {
+            std::unique_lock l(segments_mtx_);
+
+            auto it = segments_.find(pid);
+            if (it == segments_.end())
+            {
+                shared_memory_segment segment =
+                    shared_memory_segment::open(pid, ec);
+
+                std::shared_ptr<shared_memory_segment> ptr;
+                if (!ec)
+                {
+                    ptr = std::make_shared<shared_memory_segment>(
+                        HPX_MOVE(segment));
+                }
+                it = segments_.emplace(pid, HPX_MOVE(ptr)).first;
+            }
+            else if (!it->second)
+            {
+                l.unlock();
+                HPX_THROWS_IF(ec, hpx::error::network_error,
+                    "shmem::sender::get_segment",
+                    "the shared memory segment of process {} could not be "
+                    "mapped",
+                    pid);
+                return {};
+            }
+            return it->second;
+        }
+
+        std::int32_t pid_;
+        std::size_t reference_threshold_;
+        std::uint64_t probe_;
+
+        hpx::spinlock segments_mtx_;
+        std::map<std::int32_t, std::shared_ptr<shared_memory_segment>>
+            segments_;
+
+        hpx::spinlock connections_mtx_;
+        connection_list connections_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,276 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/parcelport_shmem/header.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset/parcelset_fwd.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    struct sender;
+    struct sender_connection;
+
+    void add_connection(sender*, std::shared_ptr<sender_connection> const&);
+
+    // An outgoing connection owns one of the rings of the shared memory
+    // segment of the destination locality for as long as it exists.
+    struct sender_connection
+      : parcelset::parcelport_connection<sender_connection, std::vector<char>>
+    {
+    private:
+        using sender_type = sender;
+
+        using data_type = std::vector<char>;
+
+        using base_type =
+            parcelset::parcelport_connection<sender_connection, data_type>;
+
+        struct piece
+        {
+            void const* data;
+            std::size_t size;
+        };
+
+    public:
+        sender_connection(sender_type* s,
+            std::shared_ptr<shared_memory_segment> segment,
+            std::size_t ring_index, std::size_t reference_threshold,
+            parcelset::locality there, parcelset::parcelport* pp)
+          : sender_(s)
+          , segment_(HPX_MOVE(segment))
+          , ring_(segment_->get_ring(ring_index))
+          , reference_threshold_(reference_threshold)
+          , header_()
+          , pieces_idx_(0)
+          , transferred_(0)
+          , message_end_(0)
+          , has_references_(false)
+          , pp_(pp)
+          , there_(HPX_MOVE(there))
+        {
+        }
+
+        sender_connection(sender_connection const&) = delete;
+        sender_connection(sender_connection&&) = delete;
+        sender_connection& operator=(sender_connection const&) = delete;
+        sender_connection& operator=(sender_connection&&) = delete;
+
+        ~sender_connection() override
+        {
+            // let the receiver know that it can reuse the ring
+            ring_.control().state.store(
+                ring_control::closed, std::memory_order_release);
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        static constexpr void verify_(
+            parcelset::locality const& /* parcel_locality_id */) noexcept
+        {
+        }
+
+        using handler_type = hpx::move_only_function<void(error_code const&)>;
+        using post_handler_type = hpx::move_only_function<void(
+            error_code const&, parcelset::locality const&,
+            std::shared_ptr<sender_connection>)>;
+
+        void async_write(
+            handler_type&& handler, post_handler_type&& parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now());
+#endif
+            prepare_pieces();
+
+            handler_ = HPX_MOVE(handler);
+
+            if (!send())
+            {
+                postprocess_handler_ = HPX_MOVE(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                error_code const ec;
+                if (parcel_postprocess)
+                    parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        // Copy as much of the message into the ring as possible, returns
+        // true once the message was completely sent.
+        bool send()
+        {
+            while (pieces_idx_ != pieces_.size())
+            {
+                piece const& p = pieces_[pieces_idx_];
+                if (!ring_.write_some(p.data, p.size, transferred_))
+                {
+                    return false;
+                }
+
+                transferred_ = 0;
+                ++pieces_idx_;
+
+                if (pieces_idx_ == pieces_.size())
+                {
+                    message_end_ = ring_.written();
+                }
+            }
+
+            // chunks that were handed off by reference have to be kept alive
+            // until the receiver has copied them
+            if (has_references_ && !ring_.consumed(message_end_))
+            {
+                return false;
+            }
+
+            return done();
+        }
+
+        bool done()
+        {
+            error_code const ec(throwmode::lightweight);
+            handler_(ec);
+            handler_.reset();
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ =
+                static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now()) -
+                buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+#endif
+            buffer_.clear();
+            pieces_.clear();
+            references_.clear();
+
+            return true;
+        }
+
+    private:
+        void prepare_pieces()
+        {
+            pieces_idx_ = 0;
+            transferred_ = 0;
+            message_end_ = 0;
+            has_references_ = false;
+
+            auto const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+
+            header_.size = buffer_.size_;
+            header_.data_size = buffer_.data_size_;
+            header_.num_zero_copy_chunks =
+                static_cast<std::uint32_t>(num_zero_copy_chunks);
+            header_.num_non_zero_copy_chunks = buffer_.num_chunks_.second;
+
+            pieces_.clear();
+            pieces_.reserve(3 + 2 * num_zero_copy_chunks);
+            pieces_.push_back(piece{&header_, sizeof(header_)});
+
+            if (num_zero_copy_chunks != 0)
+            {
+                auto const& tchunks = buffer_.transmission_chunks_;
+                pieces_.push_back(piece{tchunks.data(),
+                    tchunks.size() *
+                        sizeof(parcel_buffer_type::transmission_chunk_type)});
+            }
+
+            pieces_.push_back(piece{buffer_.data_.data(), buffer_.data_.size()});
+
+            if (num_zero_copy_chunks == 0)
+            {
+                return;
+            }
+
+            // large chunks are not copied through the ring if the receiver is
+            // able to read them from this process directly
+            bool const use_references = reference_threshold_ != 0 &&
+                ring_.control().references.load(std::memory_order_acquire) ==
+                    ring_control::enabled;
+
+            // the pieces refer to the elements of references_
+            references_.clear();
+            references_.reserve(num_zero_copy_chunks);
+
+            for (auto const& c : buffer_.chunks_)
+            {
+                if (c.type_ != serialization::chunk_type::chunk_type_pointer)
+                {
+                    continue;
+                }
+
+                if (use_references && c.size_ >= reference_threshold_)
+                {
+                    references_.push_back(chunk_reference{
+                        static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(
+                            c.data_.cpos_))});
+                    pieces_.push_back(
+                        piece{&references_.back(), sizeof(chunk_reference)});
+                    has_references_ = true;
+                }
+                else
+                {
+                    references_.push_back(chunk_reference{0});
+                    pieces_.push_back(
+                        piece{&references_.back(), sizeof(chunk_reference)});
+                    pieces_.push_back(piece{c.data_.cpos_, c.size_});
+                }
+            }
+        }
+
+        sender_type* sender_;
+
+        std::shared_ptr<shared_memory_segment> segment_;
+        ring ring_;
+        std::size_t reference_threshold_;
+
+        header header_;
+        std::vector<chunk_reference> references_;
+        std::vector<piece> pieces_;
+        std::size_t pieces_idx_;
+        std::size_t transferred_;
+        std::uint64_t message_end_;
+        bool has_references_;
+
+        parcelset::parcelport* pp_;
+        parcelset::locality there_;
+
+    public:
+        handler_type handler_;
+        post_handler_type postprocess_handler_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,249 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Shared state of a single-producer/single-consumer byte ring. The
+    // positions are running byte counts, the producer only ever modifies
+    // head, the consumer only ever modifies tail.
+    struct ring_control
+    {
+        enum ring_state : std::uint32_t
+        {
+            free = 0,       // not in use, may be claimed by a sender
+            claimed = 1,    // a sender is initializing the ring
+            active = 2,     // the ring is connected to a sender
+            closed = 3      // the sender has gone away
+        };
+
+        enum reference_state : std::uint32_t
+        {
+            undecided = 0,    // the receiver has not seen the ring yet
+            enabled = 1,      // the receiver is able to read the senders memory
+            disabled = 2      // all data has to be copied through the ring
+        };
+
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint64_t> head;
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint64_t> tail;
+
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint32_t> state;
+        std::atomic<std::uint32_t> references;
+
+        // used by the receiver to verify whether it can access the memory of
+        // the sending process directly
+        std::int32_t sender_pid;
+        std::uint64_t probe_address;
+        std::uint64_t probe_value;
+    };
+
+    class ring
+    {
+    public:
+        constexpr ring() noexcept
+          : ctrl_(nullptr)
+          , data_(nullptr)
+          , size_(0)
+        {
+        }
+
+        constexpr ring(
+            ring_control* ctrl, char* data, std::size_t size) noexcept
+          : ctrl_(ctrl)
+          , data_(data)
+          , size_(size)
+        {
+            HPX_ASSERT((size & (size - 1)) == 0);
+        }
+
+        [[nodiscard]] ring_control& control() const noexcept
+        {
+            HPX_ASSERT(ctrl_ != nullptr);
+            return *ctrl_;
+        }
+
+        // producer side: append as much of the given data as fits into the
+        // ring, returns the number of bytes written
+        std::size_t write(void const* data, std::size_t size) noexcept
+        {
+            std::uint64_t const head =
+                ctrl_->head.load(std::memory_order_relaxed);
+            std::uint64_t const tail =
+                ctrl_->tail.load(std::memory_order_acquire);
+
+            std::size_t const count = (std::min)(
+                size, size_ - static_cast<std::size_t>(head - tail));
+            if (count != 0)
+            {
+                std::size_t const offset =
+                    static_cast<std::size_t>(head) & (size_ - 1);
+                std::size_t const first = (std::min)(count, size_ - offset);
+
+                std::memcpy(data_ + offset, data, first);
+                std::memcpy(
+                    data_, static_cast<char const*>(data) + first, count - first);
+
+                ctrl_->head.store(head + count, std::memory_order_release);
+            }
+            return count;
+        }
+
+        // producer side: the position right after the last byte written
+        [[nodiscard]] std::uint64_t written() const noexcept
+        {
+            return ctrl_->head.load(std::memory_order_relaxed);
+        }
+
+        // producer side: whether the receiver has consumed everything up to
+        // the given position
+        [[nodiscard]] bool consumed(std::uint64_t pos) const noexcept
+        {
+            return ctrl_->tail.load(std::memory_order_acquire) >= pos;
+        }
+
+        // consumer side: take as much of the requested data from the ring as
+        // is available, returns the number of bytes read
+        std::size_t read(void* data, std::size_t size) noexcept
+        {
+            std::uint64_t const tail =
+                ctrl_->tail.load(std::memory_order_relaxed);
+            std::uint64_t const head =
+                ctrl_->head.load(std::memory_order_acquire);
+
+            std::size_t const count =
+                (std::min)(size, static_cast<std::size_t>(head - tail));
+            if (count != 0)
+            {
+                std::size_t const offset =
+                    static_cast<std::size_t>(tail) & (size_ - 1);
+                std::size_t const first = (std::min)(count, size_ - offset);
+
+                std::memcpy(data, data_ + offset, first);
+                std::memcpy(static_cast<char*>(data) + first, data_,
+                    count - first);
+
+                ctrl_->tail.store(tail + count, std::memory_order_release);
+            }
+            return count;
+        }
+
+        // consumer side: whether there is data waiting to be read
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return ctrl_->tail.load(std::memory_order_relaxed) ==
+                ctrl_->head.load(std::memory_order_acquire);
+        }
+
+        // Helpers continuing a (partial) transfer of a contiguous piece of
+        // data, transferred holds the number of bytes already processed.
+        // Return whether the piece was completely transferred.
+        bool write_some(
+            void const* data, std::size_t size, std::size_t& transferred)
+        {
+            HPX_ASSERT(transferred <= size);
+            transferred += write(
+                static_cast<char const*>(data) + transferred, size - transferred);
+            return transferred == size;
+        }
+
+        bool read_some(void* data, std::size_t size, std::size_t& transferred)
+        {
+            HPX_ASSERT(transferred <= size);
+            transferred += read(
+                static_cast<char*>(data) + transferred, size - transferred);
+            return transferred == size;
+        }
+
+    private:
+        ring_control* ctrl_;
+        char* data_;
+        std::size_t size_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Each locality creates one shared memory segment holding a number of
+    // rings, all other localities on the same node claim one of those rings
+    // per outgoing connection.
+    class HPX_EXPORT shared_memory_segment
+    {
+    public:
+        shared_memory_segment() noexcept;
+        ~shared_memory_segment();
+
+        shared_memory_segment(shared_memory_segment&& rhs) noexcept;
+        shared_memory_segment& operator=(shared_memory_segment&& rhs) noexcept;
+
+        shared_memory_segment(shared_memory_segment const&) = delete;
+        shared_memory_segment& operator=(
+            shared_memory_segment const&) = delete;
+
+        // create the segment receiving the messages sent to the given
+        // process, ring_size has to be a power of two
+        static shared_memory_segment create(std::int32_t pid,
+            std::size_t ring_count, std::size_t ring_size,
+            error_code& ec = throws);
+
+        // map the segment created by another process on the same node
+        static shared_memory_segment open(
+            std::int32_t pid, error_code& ec = throws);
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return base_ != nullptr;
+        }
+
+        [[nodiscard]] std::size_t ring_count() const noexcept;
+
+        // the number of rings which may have been claimed so far
+        [[nodiscard]] std::size_t rings_in_use() const noexcept;
+
+        [[nodiscard]] ring get_ring(std::size_t index) const noexcept;
+
+        // claim an unused ring, returns ring_count() if none is available
+        std::size_t claim_ring(std::int32_t sender_pid,
+            std::uint64_t probe_address, std::uint64_t probe_value) noexcept;
+
+        // give a ring back after it was closed by its sender
+        void release_ring(std::size_t index) const noexcept;
+
+    private:
+        void reset() noexcept;
+
+        std::string name_;
+        void* base_;
+        std::size_t size_;
+        bool owner_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Identify the node this process runs on, returns zero if no identifier
+    // could be established.
+    HPX_EXPORT std::uint64_t get_host_id();
+
+    // Copy data directly out of the address space of another process
+    // (without the data having to pass through the shared memory segment).
+    // Returns false if this is not possible.
+    HPX_EXPORT bool read_process_memory(std::int32_t pid,
+        std::uint64_t address, void* data, std::size_t size) noexcept;
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,358 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/command_line_handling/command_line_handling.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+        class HPX_EXPORT parcelport;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        using connection_type = policies::shmem::sender_connection;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+        using is_connectionless = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        void add_connection(
+            sender* s, std::shared_ptr<sender_connection> const& ptr)
+        {
+            s->add(ptr);
+        }
+
+        class HPX_EXPORT parcelport : public parcelport_impl<parcelport>
+        {
+            using base_type = parcelport_impl<parcelport>;
+
+            static std::size_t ring_count(
+                util::runtime_configuration const& ini)
+            {
+                return (std::max)(hpx::util::get_entry_as<std::size_t>(ini,
+                                      "hpx.parcel.shmem.ring_count", 64),
+                    static_cast<std::size_t>(1));
+            }
+
+            static std::size_t ring_size(util::runtime_configuration const& ini)
+            {
+                // the rings have to be a power of two in size
+                std::size_t const size = hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.ring_size", 256 * 1024);
+
+                std::size_t result = 4096;
+                while (result < size)
+                {
+                    result *= 2;
+                }
+                return result;
+            }
+
+            static std::size_t reference_threshold(
+                util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.reference_threshold", 16384);
+            }
+
+            static std::size_t background_threads(
+                util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(ini,
+                    "hpx.parcel.shmem.background_threads",
+                    static_cast<std::size_t>(-1));
+            }
+
+            static shared_memory_segment create_segment(
+                util::runtime_configuration const& ini)
+            {
+                // localities on other nodes are never going to connect, this
+                // parcelport is still functional if the segment is missing
+                error_code ec(throwmode::lightweight);
+                shared_memory_segment segment = shared_memory_segment::create(
+                    static_cast<std::int32_t>(::getpid()), ring_count(ini),
+                    ring_size(ini), ec);
+                if (ec)
+                {
+                    LPT_(warning).format(
+                        "shmem::parcelport: {}, connections from localities "
+                        "on the same node will use other parcelports",
+                        ec.get_message());
+                }
+                return segment;
+            }
+
+            static parcelset::locality here(
+                shared_memory_segment const& segment, std::uint64_t host_id)
+            {
+                return parcelset::locality(locality(segment ? host_id : 0,
+                    static_cast<std::int32_t>(::getpid())));
+            }
+
+            // the segment has to be created before the base class is
+            // initialized with the locality of this parcelport
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier,
+                shared_memory_segment&& segment, std::uint64_t host_id)
+              : base_type(ini, here(segment, host_id), notifier)
+              , segment_(HPX_MOVE(segment))
+              , host_id_(segment_ ? host_id : 0)
+              , stopped_(false)
+              , sender_(static_cast<std::int32_t>(::getpid()),
+                    reference_threshold(ini))
+              , receiver_(*this, segment_)
+              , background_threads_(background_threads(ini))
+            {
+            }
+
+        public:
+            using sender_type = sender;
+
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier)
+              : parcelport(ini, notifier, create_segment(ini), get_host_id())
+            {
+            }
+
+            parcelport(parcelport const&) = delete;
+            parcelport(parcelport&&) = delete;
+            parcelport& operator=(parcelport const&) = delete;
+            parcelport& operator=(parcelport&&) = delete;
+
+            ~parcelport() override = default;
+
+            // Start the handling of connections.
+            bool do_run()
+            {
+                receiver_.run();
+                sender_.run();
+
+                for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+                {
+                    io_service_pool_.get_io_service(static_cast<int>(i))
+                        .post(hpx::bind(&parcelport::io_service_work, this));
+                }
+                return true;
+            }
+
+            // Stop the handling of connections.
+            void do_stop()
+            {
+                while (do_background_work(0, parcelport_background_mode::all))
+                {
+                    if (threads::get_self_ptr())
+                    {
+                        hpx::this_thread::suspend(
+                            hpx::threads::thread_schedule_state::pending,
+                            "shmem::parcelport::do_stop");
+                    }
+                }
+                stopped_.store(true, std::memory_order_release);
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                return hpx::util::format("shmem-{}", ::getpid());
+            }
+
+            // Only localities on the same node can be reached through shared
+            // memory, all others (and those whose shared memory segment can't
+            // be mapped) are handled by the next parcelport in line. This
+            // parcelport is not used before all localities have been
+            // bootstrapped.
+            bool can_connect(parcelset::locality const& dest,
+                bool use_alternative_parcelport) override
+            {
+                return use_alternative_parcelport && host_id_ != 0 &&
+                    dest.get<locality>().host_id() == host_id_ &&
+                    sender_.can_connect(dest);
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec)
+            {
+                return sender_.create_connection(l, this, ec);
+            }
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const&) const override
+            {
+                // this parcelport is never used for bootstrapping
+                return {};
+            }
+
+            parcelset::locality create_locality() const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode)
+            {
+                if (stopped_.load(std::memory_order_acquire) ||
+                    num_thread >= background_threads_)
+                {
+                    return false;
+                }
+
+                bool has_work = false;
+                if (mode & parcelport_background_mode::send)
+                {
+                    has_work = sender_.background_work();
+                }
+                if (mode & parcelport_background_mode::receive)
+                {
+                    has_work = receiver_.background_work(num_thread) || has_work;
+                }
+                return has_work;
+            }
+
+        private:
+            void io_service_work()
+            {
+                std::size_t k = 0;
+
+                // We only execute work on the IO service while HPX is starting
+                while (hpx::is_starting())
+                {
+                    bool has_work = sender_.background_work();
+                    has_work = receiver_.background_work() || has_work;
+                    if (has_work)
+                    {
+                        k = 0;
+                    }
+                    else
+                    {
+                        ++k;
+                        util::detail::yield_k(k,
+                            "hpx::parcelset::policies::shmem::parcelport::"
+                            "io_service_work");
+                    }
+                }
+            }
+
+            // the segment receiving the messages sent to this locality
+            shared_memory_segment segment_;
+            std::uint64_t host_id_;
+
+            std::atomic<bool> stopped_;
+
+            sender sender_;
+            receiver<parcelport> receiver_;
+
+            std::size_t background_threads_;
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+// Inject additional configuration data into the factory registry for this
+// type. This information ends up in the system wide configuration database
+// under the plugin specific section:
+//
+//      [hpx.parcel.shmem]
+//      ...
+//      priority = 2000
+//
+template <>
+struct hpx::traits::plugin_config_data<
+    hpx::parcelset::policies::shmem::parcelport>
+{
+    // prefer this parcelport over all others for localities on the same node,
+    // even if the priority of those has been raised (e.g. by hpxrun.py)
+    static constexpr char const* priority() noexcept
+    {
+        return "2000";
+    }
+
+    static constexpr void init(int* /* argc */, char*** /* argv */,
+        util::command_line_handling& /* cfg */) noexcept
+    {
+    }
+
+    // by default no additional initialization using the resource
+    // partitioner is required
+    static constexpr void init(hpx::resource::partitioner&) noexcept {}
+
+    static constexpr void destroy() noexcept {}
+
+    static constexpr char const* call() noexcept
+    {
+        return
+            // number of rings (incoming connections) of the shared memory
+            // segment and the size of each of those (in bytes)
+            "ring_count = ${HPX_PARCEL_SHMEM_RING_COUNT:64}\n"
+            "ring_size = ${HPX_PARCEL_SHMEM_RING_SIZE:262144}\n"
+
+            // zero-copy chunks of at least this size are read by the
+            // receiver directly from the memory of the sender (if the system
+            // allows for this), zero disables this
+            "reference_threshold = "
+            "${HPX_PARCEL_SHMEM_REFERENCE_THRESHOLD:16384}\n"
+
+            // number of cores that do background work, default: all
+            "background_threads = "
+            "${HPX_PARCEL_SHMEM_BACKGROUND_THREADS:-1}\n";
+    }
+};    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(hpx::parcelset::policies::shmem::parcelport, shmem)
+
+#endif
@@ -0,0 +1,422 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <sys/uio.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        // 'HPXSHMEM'
+        constexpr std::uint64_t segment_magic = 0x4850'5853'484d'454dULL;
+
+        struct segment_header
+        {
+            std::atomic<std::uint64_t> magic;
+            std::uint64_t ring_count;
+            std::uint64_t ring_size;
+
+            // upper bound of the indices of the rings claimed so far
+            alignas(threads::get_cache_line_size())
+                std::atomic<std::uint64_t> rings_in_use;
+        };
+
+        constexpr std::size_t round_up(std::size_t size) noexcept
+        {
+            constexpr std::size_t alignment = threads::get_cache_line_size();
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+
+        constexpr std::size_t controls_offset() noexcept
+        {
+            return round_up(sizeof(segment_header));
+        }
+
+        constexpr std::size_t data_offset(std::size_t ring_count) noexcept
+        {
+            return controls_offset() + round_up(ring_count * sizeof(ring_control));
+        }
+
+        std::string segment_name(std::int32_t pid)
+        {
+            return hpx::util::format("/hpx.shmem.{}", pid);
+        }
+
+        segment_header* get_header(void* base) noexcept
+        {
+            return static_cast<segment_header*>(base);
+        }
+
+        ring_control* get_controls(void* base) noexcept
+        {
+            return reinterpret_cast<ring_control*>(
+                static_cast<char*>(base) + controls_offset());
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    shared_memory_segment::shared_memory_segment() noexcept
+      : base_(nullptr)
+      , size_(0)
+      , owner_(false)
+    {
+    }
+
+    shared_memory_segment::~shared_memory_segment()
+    {
+        reset();
+    }
+
+    shared_memory_segment::shared_memory_segment(
+        shared_memory_segment&& rhs) noexcept
+      : name_(HPX_MOVE(rhs.name_))
+      , base_(rhs.base_)
+      , size_(rhs.size_)
+      , owner_(rhs.owner_)
+    {
+        rhs.base_ = nullptr;
+        rhs.size_ = 0;
+        rhs.owner_ = false;
+    }
+
+    shared_memory_segment& shared_memory_segment::operator=(
+        shared_memory_segment&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            reset();
+
+            name_ = HPX_MOVE(rhs.name_);
+            base_ = rhs.base_;
+            size_ = rhs.size_;
+            owner_ = rhs.owner_;
+
+            rhs.base_ = nullptr;
+            rhs.size_ = 0;
+            rhs.owner_ = false;
+        }
+        return *this;
+    }
+
+    void shared_memory_segment::reset() noexcept
+    {
+        if (base_ != nullptr)
+        {
+            ::munmap(base_, size_);
+            base_ = nullptr;
+            size_ = 0;
+        }
+        if (owner_)
+        {
+            ::shm_unlink(name_.c_str());
+            owner_ = false;
+        }
+    }
+
+    shared_memory_segment shared_memory_segment::create(std::int32_t pid,
+        std::size_t ring_count, std::size_t ring_size, error_code& ec)
+    {
+        HPX_ASSERT(ring_count != 0);
+        HPX_ASSERT(ring_size != 0 && (ring_size & (ring_size - 1)) == 0);
+
+        shared_memory_segment segment;
+        segment.name_ = segment_name(pid);
+        segment.size_ = data_offset(ring_count) + ring_count * ring_size;
+
+        // remove leftovers of a crashed process that happened to have the
+        // same process id
+        ::shm_unlink(segment.name_.c_str());
+
+        int const fd = ::shm_open(
+            segment.name_.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::create",
+                "could not create shared memory segment {}: {}", segment.name_,
+                std::strerror(errno));
+            return {};
+        }
+        segment.owner_ = true;
+
+        // the pages of the rings are allocated only once they are touched
+        if (::ftruncate(fd, static_cast<off_t>(segment.size_)) == -1)
+        {
+            int const error = errno;
+            ::close(fd);
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::create",
+                "could not resize shared memory segment {}: {}", segment.name_,
+                std::strerror(error));
+            return {};
+        }
+
+        segment.base_ = ::mmap(nullptr, segment.size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED, fd, 0);
+        int const error = errno;
+        ::close(fd);
+
+        if (segment.base_ == MAP_FAILED)
+        {
+            segment.base_ = nullptr;
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::create",
+                "could not map shared memory segment {}: {}", segment.name_,
+                std::strerror(error));
+            return {};
+        }
+
+        // the segment is zero-initialized, which leaves all rings free
+        segment_header* header =
+            new (segment.base_) segment_header{{0}, ring_count, ring_size, {0}};
+
+        ring_control* controls = get_controls(segment.base_);
+        for (std::size_t i = 0; i != ring_count; ++i)
+        {
+            new (&controls[i]) ring_control{{0}, {0}, {ring_control::free},
+                {ring_control::undecided}, 0, 0, 0};
+        }
+
+        // make the segment visible to other processes
+        header->magic.store(segment_magic, std::memory_order_release);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return segment;
+    }
+
+    shared_memory_segment shared_memory_segment::open(
+        std::int32_t pid, error_code& ec)
+    {
+        shared_memory_segment segment;
+        segment.name_ = segment_name(pid);
+
+        int const fd = ::shm_open(segment.name_.c_str(), O_RDWR, 0);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "could not open shared memory segment {}: {}", segment.name_,
+                std::strerror(errno));
+            return {};
+        }
+
+        struct stat st = {};
+        if (::fstat(fd, &st) == -1 ||
+            static_cast<std::size_t>(st.st_size) < sizeof(segment_header))
+        {
+            ::close(fd);
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "shared memory segment {} has an unexpected size",
+                segment.name_);
+            return {};
+        }
+
+        segment.size_ = static_cast<std::size_t>(st.st_size);
+        segment.base_ = ::mmap(nullptr, segment.size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED, fd, 0);
+        int const error = errno;
+        ::close(fd);
+
+        if (segment.base_ == MAP_FAILED)
+        {
+            segment.base_ = nullptr;
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "could not map shared memory segment {}: {}", segment.name_,
+                std::strerror(error));
+            return {};
+        }
+
+        segment_header const* header = get_header(segment.base_);
+        if (header->magic.load(std::memory_order_acquire) != segment_magic ||
+            data_offset(header->ring_count) +
+                    header->ring_count * header->ring_size !=
+                segment.size_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "shared memory segment {} was not initialized properly",
+                segment.name_);
+            return {};
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return segment;
+    }
+
+    std::size_t shared_memory_segment::ring_count() const noexcept
+    {
+        HPX_ASSERT(base_ != nullptr);
+        return static_cast<std::size_t>(get_header(base_)->ring_count);
+    }
+
+    std::size_t shared_memory_segment::rings_in_use() const noexcept
+    {
+        HPX_ASSERT(base_ != nullptr);
+        return static_cast<std::size_t>(
+            get_header(base_)->rings_in_use.load(std::memory_order_acquire));
+    }
+
+    ring shared_memory_segment::get_ring(std::size_t index) const noexcept
+    {
+        HPX_ASSERT(base_ != nullptr && index < ring_count());
+
+        auto const ring_size =
+            static_cast<std::size_t>(get_header(base_)->ring_size);
+        char* data = static_cast<char*>(base_) + data_offset(ring_count()) +
+            index * ring_size;
+
+        return {&get_controls(base_)[index], data, ring_size};
+    }
+
+    std::size_t shared_memory_segment::claim_ring(std::int32_t sender_pid,
+        std::uint64_t probe_address, std::uint64_t probe_value) noexcept
+    {
+        HPX_ASSERT(base_ != nullptr);
+
+        segment_header* header = get_header(base_);
+        ring_control* controls = get_controls(base_);
+
+        std::size_t const count = ring_count();
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            ring_control& ctrl = controls[i];
+
+            std::uint32_t expected = ring_control::free;
+            if (!ctrl.state.compare_exchange_strong(expected,
+                    ring_control::claimed, std::memory_order_acquire))
+            {
+                continue;
+            }
+
+            ctrl.head.store(0, std::memory_order_relaxed);
+            ctrl.tail.store(0, std::memory_order_relaxed);
+            ctrl.references.store(
+                ring_control::undecided, std::memory_order_relaxed);
+            ctrl.sender_pid = sender_pid;
+            ctrl.probe_address = probe_address;
+            ctrl.probe_value = probe_value;
+
+            // make sure the receiver scans this ring
+            std::uint64_t in_use =
+                header->rings_in_use.load(std::memory_order_relaxed);
+            while (in_use < i + 1 &&
+                !header->rings_in_use.compare_exchange_weak(
+                    in_use, i + 1, std::memory_order_release))
+            {
+            }
+
+            ctrl.state.store(ring_control::active, std::memory_order_release);
+            return i;
+        }
+        return count;
+    }
+
+    void shared_memory_segment::release_ring(
+        std::size_t index) const noexcept
+    {
+        HPX_ASSERT(base_ != nullptr && index < ring_count());
+        get_controls(base_)[index].state.store(
+            ring_control::free, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t get_host_id()
+    {
+        char hostname[256] = {};
+        if (::gethostname(hostname, sizeof(hostname) - 1) != 0)
+        {
+            return 0;
+        }
+
+        std::string id(hostname);
+
+        // distinguish between several instances of a system running under
+        // the same name (e.g. virtual machines)
+        std::ifstream boot_id("/proc/sys/kernel/random/boot_id");
+        if (boot_id)
+        {
+            std::string line;
+            std::getline(boot_id, line);
+            id += line;
+        }
+
+        // FNV-1a, this has to yield the same value in all processes
+        std::uint64_t hash = 0xcbf2'9ce4'8422'2325ULL;
+        for (char const c : id)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x0000'0100'0000'01b3ULL;
+        }
+        return hash != 0 ? hash : 1;
+    }
+
+    bool read_process_memory([[maybe_unused]] std::int32_t pid,
+        [[maybe_unused]] std::uint64_t address, [[maybe_unused]] void* data,
+        [[maybe_unused]] std::size_t size) noexcept
+    {
+#if defined(__linux) || defined(linux) || defined(__linux__)
+        auto* dest = static_cast<char*>(data);
+        while (size != 0)
+        {
+            iovec local = {dest, size};
+            iovec remote = {
+                reinterpret_cast<void*>(static_cast<std::uintptr_t>(address)),
+                size};
+
+            ssize_t const count =
+                ::process_vm_readv(static_cast<pid_t>(pid), &local, 1, &remote,
+                    1, 0);
+            if (count <= 0)
+            {
+                if (count == -1 && errno == EINTR)
+                    continue;
+                return false;
+            }
+
+            dest += count;
+            address += static_cast<std::uint64_t>(count);
+            size -= static_cast<std::size_t>(count);
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,155 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that messages exchanged between two localities running on the same
+// node are carried by the shared memory parcelport and not by the TCP
+// parcelport used for bootstrapping the localities. The messages are smaller
+// and larger than the rings and than the reference threshold.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/parcelhandler.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+#include <hpx/runtime_distributed.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using buffer_type = hpx::serialization::serialize_buffer<char>;
+
+// send the buffer back, it is serialized as a zero-copy chunk both ways
+buffer_type echo(buffer_type const& b)
+{
+    return b;
+}
+
+HPX_PLAIN_ACTION(echo)
+
+// messages without any zero-copy chunks
+std::size_t count_characters(std::string const& s, char c)
+{
+    return static_cast<std::size_t>(std::count(s.begin(), s.end(), c));
+}
+
+HPX_PLAIN_ACTION(count_characters)
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+// number of parcels received by the given parcelport of this locality
+std::int64_t parcels_received(std::string const& pp_type)
+{
+    return hpx::get_runtime_distributed()
+        .get_parcel_handler()
+        .get_parcel_receive_count(pp_type, false);
+}
+
+HPX_PLAIN_ACTION(parcels_received)
+
+std::int64_t parcels_sent(std::string const& pp_type)
+{
+    return hpx::get_runtime_distributed()
+        .get_parcel_handler()
+        .get_parcel_send_count(pp_type, false);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t shmem_connections_created()
+{
+    return hpx::get_runtime_distributed()
+        .get_parcel_handler()
+        .get_connection_cache_statistics("shmem",
+            hpx::parcelset::parcelport::connection_cache_insertions, false);
+}
+
+// returns the number of requests sent
+std::size_t test_send_receive(hpx::id_type const& id, std::size_t size)
+{
+    std::size_t requests = 0;
+
+    buffer_type b(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        b.data()[i] = static_cast<char>('a' + i % 26);
+    }
+
+    // keep several connections busy at the same time
+    std::vector<hpx::future<buffer_type>> echoed;
+    for (int i = 0; i != 4; ++i)
+    {
+        echoed.push_back(hpx::async(echo_action(), id, b));
+        ++requests;
+    }
+
+    for (hpx::future<buffer_type>& f : echoed)
+    {
+        buffer_type const result = f.get();
+        HPX_TEST_EQ(result.size(), size);
+        HPX_TEST(std::equal(b.data(), b.data() + size, result.data()));
+    }
+
+    std::string const s(b.data(), b.data() + size);
+    HPX_TEST_EQ(hpx::async(count_characters_action(), id, s, 'a').get(),
+        static_cast<std::size_t>(std::count(s.begin(), s.end(), 'a')));
+    ++requests;
+
+    return requests;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::vector<hpx::id_type> const localities = hpx::find_remote_localities();
+    HPX_TEST(!localities.empty());
+
+    for (hpx::id_type const& id : localities)
+    {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        std::int64_t const shmem_sent = parcels_sent("shmem");
+        std::int64_t const tcp_sent = parcels_sent("tcp");
+        std::int64_t const shmem_received =
+            hpx::async(parcels_received_action(), id, "shmem").get();
+#endif
+
+        // messages smaller and larger than the rings (256 kB by default)
+        [[maybe_unused]] std::size_t requests = 0;
+        for (std::size_t size : {1, 1024, 64 * 1024, 1024 * 1024})
+        {
+            requests += test_send_receive(id, size);
+        }
+
+        // the connections to the other locality have to be shared memory
+        // connections
+        HPX_TEST_LT(std::int64_t(0), shmem_connections_created());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        // all requests were sent and received through shared memory
+        auto const num_requests = static_cast<std::int64_t>(requests);
+        HPX_TEST_LTE(shmem_sent + num_requests, parcels_sent("shmem"));
+        HPX_TEST_LT(parcels_sent("tcp") - tcp_sent, num_requests);
+        HPX_TEST_LTE(shmem_received + num_requests,
+            hpx::async(parcels_received_action(), id, "shmem").get());
+#endif
+    }
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -22,6 +22,7 @@
 
 #include <hpx/parcelport_tcp/connection_handler.hpp>
 #include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/encode_parcels.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 
@@ -99,7 +100,7 @@ namespace hpx::parcelset::policies::tcp {
             data.num_parcels_ = 0;
 #endif
             parcels_.clear();
-            chunk_buffers_.clear();
+            release_chunk_buffers();
 
             // Issue a read operation to read the message size.
             using asio::buffer;
@@ -213,8 +214,7 @@ namespace hpx::parcelset::policies::tcp {
                         chunks.size() * sizeof(transmission_chunk_type));
 
                     // add main buffer holding data that was serialized normally
-                    buffer_.data_.resize(
-                        static_cast<std::size_t>(inbound_size));
+                    resize_data(static_cast<std::size_t>(inbound_size));
                     buffers.emplace_back(asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
@@ -223,8 +223,7 @@ namespace hpx::parcelset::policies::tcp {
                 else
                 {
                     // add main buffer holding data that was serialized normally
-                    buffer_.data_.resize(
-                        static_cast<std::size_t>(inbound_size));
+                    resize_data(static_cast<std::size_t>(inbound_size));
                     buffers.emplace_back(asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
@@ -338,7 +337,7 @@ namespace hpx::parcelset::policies::tcp {
                         auto const chunk_size = static_cast<std::size_t>(
                             buffer_.transmission_chunks_[i].second);
 
-                        chunk_buffers_[i].resize(chunk_size);
+                        acquire_chunk_buffer(chunk_buffers_[i], chunk_size);
                         buffers.emplace_back(
                             chunk_buffers_[i].data(), chunk_size);
 
@@ -388,7 +387,7 @@ namespace hpx::parcelset::policies::tcp {
                 --operation_in_flight_;
                 buffer_ = parcel_buffer_type();
                 parcels_.clear();
-                chunk_buffers_.clear();
+                release_chunk_buffers();
             }
             else
             {
@@ -450,7 +449,7 @@ namespace hpx::parcelset::policies::tcp {
 
             buffer_ = parcel_buffer_type();
             parcels_.clear();
-            chunk_buffers_.clear();
+            release_chunk_buffers();
 
             // Issue a read operation to read the next parcel.
             if (!e)
@@ -459,6 +458,42 @@ namespace hpx::parcelset::policies::tcp {
             }
         }
 
+        // Make the main receive buffer hold the given number of bytes. The
+        // buffer is taken from the buffer pool of the parcelport (if enabled)
+        // and is given back to it once the message has been decoded.
+        void resize_data(std::size_t size)
+        {
+            HPX_ASSERT(buffer_.data_.empty());
+
+            parcelset::detail::reserve_buffer(parcelport_, buffer_, size);
+            buffer_.data_.resize(size);
+        }
+
+        // Prepare a buffer receiving a zero-copy chunk if the received data
+        // can't be placed into its final destination directly.
+        void acquire_chunk_buffer(std::vector<char>& buffer, std::size_t size)
+        {
+            auto const& pool = parcelport_.get_buffer_pool();
+            if (pool)
+            {
+                bool reused = false;
+                buffer = pool->acquire(size, reused);
+            }
+            buffer.resize(size);
+        }
+
+        void release_chunk_buffers() noexcept
+        {
+            if (auto const& pool = parcelport_.get_buffer_pool())
+            {
+                for (auto& buffer : chunk_buffers_)
+                {
+                    pool->release(HPX_MOVE(buffer));
+                }
+            }
+            chunk_buffers_.clear();
+        }
+
         // Socket for the parcelport_connection.
         asio::ip::tcp::socket socket_;
 
@@ -20,6 +20,7 @@
 #include <hpx/modules/timing.hpp>
 
 #include <hpx/parcelport_tcp/locality.hpp>
+#include <hpx/parcelport_tcp/zero_copy_send.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/gatherer.hpp>
@@ -32,7 +33,9 @@
 #include <asio/buffer.hpp>
 #include <asio/io_context.hpp>
 #include <asio/ip/tcp.hpp>
+#include <asio/post.hpp>
 #include <asio/read.hpp>
+#include <asio/socket_base.hpp>
 #include <asio/write.hpp>
 
 // The asio support includes termios.h.
@@ -43,6 +46,7 @@
 #undef VT2
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <system_error>
 #include <utility>
@@ -94,6 +98,25 @@ namespace hpx::parcelset::policies::tcp {
             return there_;
         }
 
+        // Send buffers of at least the given size using MSG_ZEROCOPY, zero
+        // disables zero-copy sends. This has to be called on a connected
+        // socket, returns whether zero-copy sends are supported.
+        bool set_zero_copy_send_threshold(std::size_t threshold) noexcept
+        {
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+            if (threshold != 0 &&
+                !detail::enable_zero_copy_send(socket_.native_handle()))
+            {
+                threshold = 0;
+            }
+            zero_copy_send_threshold_ = threshold;
+            return zero_copy_send_threshold_ != 0;
+#else
+            HPX_UNUSED(threshold);
+            return false;
+#endif
+        }
+
         void verify_(parcelset::locality const& parcel_locality_id) const
         {
 #if defined(HPX_DEBUG)
@@ -178,6 +201,16 @@ namespace hpx::parcelset::policies::tcp {
                 buffers.emplace_back(asio::buffer(buffer_.data_));
             }
 
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+            if (zero_copy_send_threshold_ != 0 && make_write_segments(buffers))
+            {
+                // at least one of the buffers is large enough to be sent
+                // using MSG_ZEROCOPY
+                write_next_segment();
+                return;
+            }
+#endif
+
             // this additional wrapping of the handler into a bind object is
             // needed to keep  this parcelport_connection object alive for the
             // whole write operation
@@ -195,6 +228,199 @@ namespace hpx::parcelset::policies::tcp {
             handler.reset();
         }
 
+        void release_handler(postprocess_handler_type handler)
+        {
+            if (threads::threadmanager_is(hpx::state::running))
+            {
+                // the handler needs to be reset on an HPX thread (it destroys
+                // the parcel, which in turn might invoke HPX functions)
+                threads::thread_init_data data(
+                    threads::make_thread_function_nullary(util::deferred_call(
+                        &sender::reset_handler, HPX_MOVE(handler))),
+                    "sender::reset_handler");
+                threads::register_thread(data);
+            }
+            else
+            {
+                reset_handler(HPX_MOVE(handler));
+            }
+        }
+
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+        // Split the buffers into consecutive segments that are either
+        // written normally or using MSG_ZEROCOPY. Returns whether any of the
+        // segments is to be sent using MSG_ZEROCOPY.
+        bool make_write_segments(
+            std::vector<asio::const_buffer> const& buffers)
+        {
+            segments_.clear();
+            current_segment_ = 0;
+            segment_offset_ = 0;
+            bytes_written_ = 0;
+
+            bool has_zero_copy_segment = false;
+            for (asio::const_buffer const& b : buffers)
+            {
+                bool const zero_copy = b.size() >= zero_copy_send_threshold_;
+                if (segments_.empty() ||
+                    segments_.back().zero_copy_ != zero_copy)
+                {
+                    segments_.emplace_back(write_segment{{}, zero_copy});
+                }
+                segments_.back().buffers_.push_back(b);
+                has_zero_copy_segment = has_zero_copy_segment || zero_copy;
+            }
+            return has_zero_copy_segment;
+        }
+
+        void write_next_segment()
+        {
+            while (current_segment_ != segments_.size())
+            {
+                write_segment& segment = segments_[current_segment_];
+                if (!segment.zero_copy_)
+                {
+                    void (sender::*f)(std::error_code const&, std::size_t) =
+                        &sender::handle_write_segment;
+
+                    asio::async_write(socket_, segment.buffers_,
+                        hpx::bind(f, shared_from_this(), hpx::placeholders::_1,
+                            hpx::placeholders::_2));
+                    return;
+                }
+
+                std::error_code ec;
+                std::size_t const sent = detail::zero_copy_send(
+                    socket_.native_handle(), segment.buffers_, segment_offset_,
+                    ec);
+
+                if (ec == std::errc::operation_would_block ||
+                    ec == std::errc::resource_unavailable_try_again)
+                {
+                    // the socket buffer is full, wait for it to drain
+                    void (sender::*f)(std::error_code const&) =
+                        &sender::handle_wait_write;
+
+                    socket_.async_wait(asio::socket_base::wait_write,
+                        hpx::bind(f, shared_from_this(), hpx::placeholders::_1));
+                    return;
+                }
+
+                if (ec == std::errc::no_buffer_space)
+                {
+                    // the kernel refuses to pin more pages for this socket,
+                    // send the remainder of this segment normally
+                    segment.zero_copy_ = false;
+                    std::size_t offset = segment_offset_;
+                    auto it = segment.buffers_.begin();
+                    while (offset != 0 && offset >= it->size())
+                    {
+                        offset -= it->size();
+                        ++it;
+                    }
+                    segment.buffers_.erase(segment.buffers_.begin(), it);
+                    if (offset != 0)
+                    {
+                        segment.buffers_.front() += offset;
+                    }
+                    segment_offset_ = 0;
+                    continue;
+                }
+
+                if (ec)
+                {
+                    complete_write_segments(ec);
+                    return;
+                }
+
+                ++zero_copy_sends_;
+                bytes_written_ += sent;
+                segment_offset_ += sent;
+                if (segment_offset_ == asio::buffer_size(segment.buffers_))
+                {
+                    ++current_segment_;
+                    segment_offset_ = 0;
+                }
+            }
+
+            complete_write_segments(std::error_code());
+        }
+
+        void handle_write_segment(std::error_code const& e, std::size_t bytes)
+        {
+            bytes_written_ += bytes;
+            if (e)
+            {
+                complete_write_segments(e);
+                return;
+            }
+
+            ++current_segment_;
+            segment_offset_ = 0;
+            write_next_segment();
+        }
+
+        void handle_wait_write(std::error_code const& e)
+        {
+            if (e)
+            {
+                complete_write_segments(e);
+                return;
+            }
+            write_next_segment();
+        }
+
+        void complete_write_segments(std::error_code const& e)
+        {
+            segments_.clear();
+
+            // make sure the write handler is never invoked directly from
+            // inside async_write
+            void (sender::*f)(std::error_code const&, std::size_t) =
+                &sender::handle_write;
+
+            asio::post(socket_.get_executor(),
+                hpx::bind(f, shared_from_this(), e, bytes_written_));
+        }
+
+        // Wait for the kernel to release all data sent using MSG_ZEROCOPY.
+        void wait_for_zero_copy_completions()
+        {
+            std::error_code ec;
+            zero_copy_completions_ +=
+                detail::zero_copy_completions(socket_.native_handle(), ec);
+
+            if (!ec && zero_copy_completions_ != zero_copy_sends_)
+            {
+                void (sender::*f)(std::error_code const&) =
+                    &sender::handle_wait_zero_copy_completions;
+
+                // pending notifications are signaled as socket errors
+                socket_.async_wait(asio::socket_base::wait_error,
+                    hpx::bind(f, shared_from_this(), hpx::placeholders::_1));
+                return;
+            }
+
+            if (!ec)
+            {
+                zero_copy_sends_ = 0;
+                zero_copy_completions_ = 0;
+                release_handler(HPX_MOVE(zero_copy_handler_));
+            }
+            complete_write(ec);
+        }
+
+        void handle_wait_zero_copy_completions(std::error_code const& e)
+        {
+            if (e)
+            {
+                complete_write(e);
+                return;
+            }
+            wait_for_zero_copy_completions();
+        }
+#endif
+
         /// handle completed write operation
         void handle_write(std::error_code const& e, std::size_t /* bytes */)
         {
@@ -207,19 +433,18 @@ namespace hpx::parcelset::policies::tcp {
             postprocess_handler_type handler;
             std::swap(handler, handler_);
 
-            if (threads::threadmanager_is(hpx::state::running))
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+            if (zero_copy_sends_ != zero_copy_completions_)
             {
-                // the handler needs to be reset on an HPX thread (it destroys
-                // the parcel, which in turn might invoke HPX functions)
-                threads::thread_init_data data(
-                    threads::make_thread_function_nullary(util::deferred_call(
-                        &sender::reset_handler, HPX_MOVE(handler))),
-                    "sender::reset_handler");
-                threads::register_thread(data);
+                // The kernel may still reference the data of the parcels that
+                // was sent using MSG_ZEROCOPY, keep them alive until all
+                // completion notifications have been received.
+                zero_copy_handler_ = HPX_MOVE(handler);
             }
             else
+#endif
             {
-                reset_handler(HPX_MOVE(handler));
+                release_handler(HPX_MOVE(handler));
             }
 
             if (e)
@@ -251,7 +476,7 @@ namespace hpx::parcelset::policies::tcp {
                 &sender::handle_read_ack;
 
             asio::async_read(socket_, asio::buffer(&ack_, sizeof(ack_)),
-                hpx::bind(f, shared_from_this(), placeholders::_1));
+                hpx::bind(f, shared_from_this(), hpx::placeholders::_1));
         }
 
         void handle_read_ack(std::error_code const& e)
@@ -259,6 +484,20 @@ namespace hpx::parcelset::policies::tcp {
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             state_ = state_handle_read_ack;
 #endif
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+            if (!e && zero_copy_sends_ != zero_copy_completions_)
+            {
+                // the buffer may not be released before the kernel is done
+                // with it
+                wait_for_zero_copy_completions();
+                return;
+            }
+#endif
+            complete_write(e);
+        }
+
+        void complete_write(std::error_code const& e)
+        {
             buffer_.clear();
 
             // Call post-processing handler, which will send remaining pending
@@ -289,6 +528,30 @@ namespace hpx::parcelset::policies::tcp {
         hpx::move_only_function<void(std::error_code const&,
             parcelset::locality const&, std::shared_ptr<sender>)>
             postprocess_handler_;
+
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+        struct write_segment
+        {
+            std::vector<asio::const_buffer> buffers_;
+            bool zero_copy_;
+        };
+
+        std::size_t zero_copy_send_threshold_ = 0;
+
+        // state of the current segmented write operation
+        std::vector<write_segment> segments_;
+        std::size_t current_segment_ = 0;
+        std::size_t segment_offset_ = 0;
+        std::size_t bytes_written_ = 0;
+
+        // number of MSG_ZEROCOPY sends and of the corresponding completion
+        // notifications received so far
+        std::uint32_t zero_copy_sends_ = 0;
+        std::uint32_t zero_copy_completions_ = 0;
+
+        // keeps the parcels alive while the kernel references their data
+        postprocess_handler_type zero_copy_handler_;
+#endif
     };
 }    // namespace hpx::parcelset::policies::tcp
 
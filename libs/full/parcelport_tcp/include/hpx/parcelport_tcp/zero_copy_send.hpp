@@ -0,0 +1,161 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP)
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <time.h>
+
+// linux/errqueue.h relies on struct timespec being defined
+#include <linux/errqueue.h>
+
+// MSG_ZEROCOPY is supported starting Linux V4.14, the C library has to know
+// about it as well.
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY) &&                           \
+    defined(SO_EE_ORIGIN_ZEROCOPY)
+#define HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND
+#endif
+#endif
+
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+#include <asio/buffer.hpp>
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <vector>
+
+namespace hpx::parcelset::policies::tcp::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Allow for MSG_ZEROCOPY sends on the given socket.
+    inline bool enable_zero_copy_send(int fd) noexcept
+    {
+        int one = 1;
+        return ::setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) ==
+            0;
+    }
+
+    // Send (parts of) the given buffers skipping the first offset bytes
+    // without copying the data into the socket buffers. The kernel
+    // references the data until it has sent a completion notification
+    // (see zero_copy_completions below). Returns the number of bytes sent,
+    // this never blocks.
+    inline std::size_t zero_copy_send(int fd,
+        std::vector<asio::const_buffer> const& buffers, std::size_t offset,
+        std::error_code& ec) noexcept
+    {
+        constexpr std::size_t max_iov = 64;
+        std::array<iovec, max_iov> iov;
+
+        std::size_t count = 0;
+        for (asio::const_buffer const& b : buffers)
+        {
+            if (count == max_iov)
+                break;
+
+            std::size_t const size = b.size();
+            if (offset >= size)
+            {
+                offset -= size;
+                continue;
+            }
+
+            iov[count].iov_base = const_cast<char*>(
+                static_cast<char const*>(b.data()) + offset);
+            iov[count].iov_len = size - offset;
+            offset = 0;
+            ++count;
+        }
+
+        msghdr msg = {};
+        msg.msg_iov = iov.data();
+        msg.msg_iovlen = count;
+
+        while (true)
+        {
+            ssize_t const sent = ::sendmsg(
+                fd, &msg, MSG_ZEROCOPY | MSG_DONTWAIT | MSG_NOSIGNAL);
+            if (sent >= 0)
+            {
+                ec = std::error_code();
+                return static_cast<std::size_t>(sent);
+            }
+
+            if (errno != EINTR)
+            {
+                ec = std::error_code(errno, std::system_category());
+                return 0;
+            }
+        }
+    }
+
+    // Each successful MSG_ZEROCOPY send is assigned a consecutive (32 bit)
+    // id, the kernel notifies about the ranges of ids whose data is not
+    // referenced anymore through the error queue of the socket. Read all
+    // available notifications and return the number of completed sends.
+    inline std::uint32_t zero_copy_completions(
+        int fd, std::error_code& ec) noexcept
+    {
+        ec = std::error_code();
+
+        std::uint32_t completed = 0;
+        while (true)
+        {
+            alignas(cmsghdr) char control[128];
+
+            msghdr msg = {};
+            msg.msg_control = control;
+            msg.msg_controllen = sizeof(control);
+
+            if (::recvmsg(fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) == -1)
+            {
+                if (errno == EINTR)
+                    continue;
+
+                if (errno != EAGAIN && errno != EWOULDBLOCK)
+                    ec = std::error_code(errno, std::system_category());
+                break;
+            }
+
+            for (cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm != nullptr;
+                 cm = CMSG_NXTHDR(&msg, cm))
+            {
+                if ((cm->cmsg_level != SOL_IP || cm->cmsg_type != IP_RECVERR) &&
+                    (cm->cmsg_level != SOL_IPV6 ||
+                        cm->cmsg_type != IPV6_RECVERR))
+                {
+                    continue;
+                }
+
+                sock_extended_err serr;
+                std::memcpy(&serr, CMSG_DATA(cm), sizeof(serr));
+
+                if (serr.ee_errno == 0 &&
+                    serr.ee_origin == SO_EE_ORIGIN_ZEROCOPY)
+                {
+                    // ee_info and ee_data hold the inclusive range of ids
+                    completed += serr.ee_data - serr.ee_info + 1;
+                }
+            }
+        }
+        return completed;
+    }
+}    // namespace hpx::parcelset::policies::tcp::detail
+
+#endif
+#endif
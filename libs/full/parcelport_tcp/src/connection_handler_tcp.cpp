@@ -67,6 +67,8 @@ namespace hpx::parcelset::policies::tcp {
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
       , acceptor_(nullptr)
+      , zero_copy_send_threshold_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.tcp.zero_copy_send_threshold", 0))
     {
         if (here_.type() != std::string("tcp"))
         {
@@ -231,6 +233,16 @@ namespace hpx::parcelset::policies::tcp {
         s.set_option(asio::ip::tcp::no_delay(true));
         s.set_option(asio::socket_base::linger(true, 0));
 
+        if (zero_copy_send_threshold_ != 0 &&
+            !sender_connection->set_zero_copy_send_threshold(
+                zero_copy_send_threshold_))
+        {
+            LPT_(warning).format("tcp::connection_handler::get_connection: "
+                                 "zero-copy sends are not supported by the "
+                                 "system (while connecting to: {})",
+                l);
+        }
+
 #if defined(HPX_HOLDON_TO_OUTGOING_CONNECTIONS)
         {
             std::lock_guard<hpx::spinlock> lock(connections_mtx_);
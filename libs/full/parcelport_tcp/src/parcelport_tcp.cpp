@@ -19,6 +19,7 @@
 //      [hpx.parcel.tcp]
 //      ...
 //      priority = 1
+//      zero_copy_send_threshold = 0
 //
 template <>
 struct hpx::traits::plugin_config_data<
@@ -42,7 +43,10 @@ struct hpx::traits::plugin_config_data<
 
     static constexpr char const* call() noexcept
     {
-        return "";
+        // buffers of at least this size are sent using MSG_ZEROCOPY (if
+        // supported by the system), zero disables zero-copy sends
+        return "zero_copy_send_threshold = "
+               "${HPX_PARCEL_TCP_ZERO_COPY_SEND_THRESHOLD:0}\n";
     }
 };    // namespace hpx::traits
 
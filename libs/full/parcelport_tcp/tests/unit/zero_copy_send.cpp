@@ -0,0 +1,181 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Exchange large zero-copy serialized buffers between two localities. This
+// test is run with hpx.parcel.tcp.zero_copy_send_threshold set, which makes
+// the TCP parcelport send those using MSG_ZEROCOPY (where supported).
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/parcelhandler.hpp>
+#include <hpx/runtime_distributed.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using buffer_type = hpx::serialization::serialize_buffer<std::uint64_t>;
+
+// return the buffer with every element incremented by one
+buffer_type increment(buffer_type const& b)
+{
+    buffer_type result(b.size());
+    std::transform(b.data(), b.data() + b.size(), result.data(),
+        [](std::uint64_t v) { return v + 1; });
+    return result;
+}
+
+HPX_PLAIN_ACTION(increment)
+
+// concatenate several buffers, each of those is sent as a separate chunk
+buffer_type concatenate(std::vector<buffer_type> const& buffers)
+{
+    std::size_t size = 0;
+    for (buffer_type const& b : buffers)
+    {
+        size += b.size();
+    }
+
+    buffer_type result(size);
+    std::uint64_t* dest = result.data();
+    for (buffer_type const& b : buffers)
+    {
+        dest = std::copy(b.data(), b.data() + b.size(), dest);
+    }
+    return result;
+}
+
+HPX_PLAIN_ACTION(concatenate)
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+// the zero-copy chunk counters of the TCP parcelport of this locality
+struct zero_copy_counters
+{
+    zero_copy_counters()
+    {
+        hpx::parcelset::parcelhandler const& ph =
+            hpx::get_runtime_distributed().get_parcel_handler();
+
+        sent = ph.get_zchunks_send_count("tcp", false);
+        sent_size = ph.get_zchunks_send_size("tcp", false);
+        received = ph.get_zchunks_recv_count("tcp", false);
+        received_size = ph.get_zchunks_recv_size("tcp", false);
+    }
+
+    std::int64_t sent;
+    std::int64_t sent_size;
+    std::int64_t received;
+    std::int64_t received_size;
+};
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+buffer_type make_buffer(std::size_t size, std::uint64_t start)
+{
+    buffer_type b(size);
+    std::iota(b.data(), b.data() + size, start);
+    return b;
+}
+
+void test_zero_copy_send(hpx::id_type const& id, std::size_t size)
+{
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+    zero_copy_counters const before;
+#endif
+
+    // send a couple of requests concurrently to keep several zero-copy sends
+    // in flight
+    std::vector<hpx::future<buffer_type>> results;
+    for (std::uint64_t i = 0; i != 4; ++i)
+    {
+        results.push_back(
+            hpx::async(increment_action(), id, make_buffer(size, i * size)));
+    }
+
+    for (std::uint64_t i = 0; i != 4; ++i)
+    {
+        buffer_type const result = results[i].get();
+        HPX_TEST_EQ(result.size(), size);
+
+        buffer_type const expected = make_buffer(size, i * size + 1);
+        HPX_TEST(std::equal(
+            result.data(), result.data() + size, expected.data()));
+    }
+
+    // mix buffers above and below the threshold
+    std::vector<buffer_type> buffers;
+    buffers.push_back(make_buffer(size, 0));
+    buffers.push_back(make_buffer(16, size));
+    buffers.push_back(make_buffer(size, size + 16));
+
+    buffer_type const result =
+        hpx::async(concatenate_action(), id, buffers).get();
+    buffer_type const expected = make_buffer(2 * size + 16, 0);
+
+    HPX_TEST_EQ(result.size(), expected.size());
+    HPX_TEST(std::equal(
+        result.data(), result.data() + result.size(), expected.data()));
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+    // all large buffers have to be transferred as zero-copy chunks: four
+    // arguments and two parts of the concatenated arguments were sent, four
+    // results and the concatenated result were received
+    auto const bytes = static_cast<std::int64_t>(size * sizeof(std::uint64_t));
+    auto const done = [&](zero_copy_counters const& after) {
+        return before.sent + 6 <= after.sent &&
+            before.sent_size + 6 * bytes <= after.sent_size &&
+            before.received + 5 <= after.received &&
+            before.received_size + 6 * bytes <= after.received_size;
+    };
+
+    // the counters are updated only after a message has been handled
+    // completely, which may happen after the future has become ready
+    zero_copy_counters after;
+    for (int i = 0; i != 1000 && !done(after); ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        after = zero_copy_counters();
+    }
+
+    HPX_TEST_LTE(before.sent + 6, after.sent);
+    HPX_TEST_LTE(before.sent_size + 6 * bytes, after.sent_size);
+    HPX_TEST_LTE(before.received + 5, after.received);
+    HPX_TEST_LTE(before.received_size + 6 * bytes, after.received_size);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        // buffers of 8 kB, 512 kB, and 8 MB
+        for (std::size_t size : {1024, 64 * 1024, 1024 * 1024})
+        {
+            test_zero_copy_send(id, size);
+        }
+    }
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
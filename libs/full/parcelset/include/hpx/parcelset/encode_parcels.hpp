@@ -81,6 +81,35 @@ namespace hpx::parcelset {
         }
 #endif
 
+        // Make sure the buffer is able to hold the predicted amount of data.
+        // Buffers that are too small are replaced by a buffer taken from the
+        // buffer pool of the parcelport (if enabled).
+        template <typename Buffer>
+        void reserve_buffer(parcelport& pp, Buffer& buffer, std::size_t size)
+        {
+            if constexpr (Buffer::is_poolable)
+            {
+                auto const& pool = pp.get_buffer_pool();
+                if (pool && buffer.data_.capacity() < size)
+                {
+                    buffer.release_data();
+
+                    bool reused = false;
+                    buffer.data_ = pool->acquire(size, reused);
+                    buffer.pool_ = pool;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                    if (reused)
+                    {
+                        ++buffer.data_point_.buffer_pool_hits_;
+                    }
+#endif
+                    return;
+                }
+            }
+            buffer.data_.reserve(size);
+        }
+
         template <typename Buffer>
         void encode_finalize(Buffer& buffer, std::size_t arg_size)
         {
@@ -192,9 +221,13 @@ namespace hpx::parcelset {
                     num_chunks += ps[parcels_sent].num_chunks();
                 }
 
-                buffer.data_.reserve(arg_size);
+                detail::reserve_buffer(pp, buffer, arg_size);
                 buffer.chunks_.reserve(num_chunks);
 
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                std::size_t const capacity = buffer.data_.capacity();
+#endif
+
                 // mark start of serialization
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                 hpx::chrono::high_resolution_timer const timer;
@@ -248,6 +281,14 @@ namespace hpx::parcelset {
                     arg_size = archive.bytes_written();
                 }
 
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                // the predicted size was too small
+                if (buffer.data_.capacity() > capacity)
+                {
+                    ++buffer.data_point_.buffer_reallocations_;
+                }
+#endif
+
                 // store the time required for serialization
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                 buffer.data_point_.serialization_time_ =
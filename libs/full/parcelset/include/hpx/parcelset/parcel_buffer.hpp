@@ -12,9 +12,12 @@
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/modules/serialization.hpp>
 
+#include <hpx/parcelset_base/detail/buffer_pool.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 
 #include <cstdint>
+#include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -27,6 +30,12 @@ namespace hpx::parcelset {
         using count_chunks_type = std::pair<std::uint32_t, std::uint32_t>;
         using transmission_chunk_type = std::pair<std::uint64_t, std::uint64_t>;
         using allocator_type = typename BufferType::allocator_type;
+        using buffer_type = BufferType;
+
+        // only plain byte vectors can be taken from (and given back to) the
+        // buffer pool of a parcelport
+        static constexpr bool is_poolable =
+            std::is_same_v<BufferType, detail::buffer_pool::buffer_type>;
 
         explicit parcel_buffer(
             allocator_type const& allocator = allocator_type())
@@ -59,7 +68,45 @@ namespace hpx::parcelset {
         }
 
         parcel_buffer(parcel_buffer&& other) = default;
-        parcel_buffer& operator=(parcel_buffer&& other) = default;
+        parcel_buffer& operator=(parcel_buffer&& other)
+        {
+            if (this != &other)
+            {
+                release_data();
+
+                data_ = HPX_MOVE(other.data_);
+                pool_ = HPX_MOVE(other.pool_);
+                chunks_ = HPX_MOVE(other.chunks_);
+                transmission_chunks_ = HPX_MOVE(other.transmission_chunks_);
+                num_chunks_ = other.num_chunks_;
+                size_ = other.size_;
+                data_size_ = other.data_size_;
+                header_size_ = other.header_size_;
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                data_point_ = other.data_point_;
+#endif
+            }
+            return *this;
+        }
+
+        ~parcel_buffer()
+        {
+            release_data();
+        }
+
+        // give the data buffer back to the pool it was taken from, if any
+        void release_data() noexcept
+        {
+            if constexpr (is_poolable)
+            {
+                if (pool_)
+                {
+                    pool_->release(HPX_MOVE(data_));
+                    data_ = BufferType();
+                    pool_.reset();
+                }
+            }
+        }
 
         void clear()
         {
@@ -77,6 +124,9 @@ namespace hpx::parcelset {
 
         BufferType data_;
 
+        // the pool the data buffer was taken from (if any)
+        std::shared_ptr<detail::buffer_pool> pool_;
+
         std::vector<ChunkType> chunks_;
         std::vector<transmission_chunk_type> transmission_chunks_;
 
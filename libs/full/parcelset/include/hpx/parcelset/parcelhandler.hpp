@@ -347,6 +347,14 @@ namespace hpx::parcelset {
         // the maximum size of zero-copy chunks per message received
         std::int64_t get_zchunks_recv_size_max(
             std::string const& pp_type, bool reset) const;
+
+        // the number of serialization buffers reused from the buffer pool
+        std::int64_t get_buffer_pool_hits(
+            std::string const& pp_type, bool reset) const;
+
+        // the number of serialization buffers grown while serializing
+        std::int64_t get_buffer_reallocations(
+            std::string const& pp_type, bool reset) const;
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -1263,6 +1263,24 @@ namespace hpx::parcelset {
         return pp ? pp->get_zchunks_recv_size_max(reset) : 0;
     }
 
+    // the number of serialization buffers reused from the buffer pool
+    std::int64_t parcelhandler::get_buffer_pool_hits(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_buffer_pool_hits(reset) : 0;
+    }
+
+    // the number of serialization buffers grown while serializing
+    std::int64_t parcelhandler::get_buffer_reallocations(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_buffer_reallocations(reset) : 0;
+    }
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
@@ -1410,6 +1428,7 @@ namespace hpx::parcelset {
                               "$[hpx.parcel.zero_copy_optimization]}");
         ini_defs.emplace_back(
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}");
+        ini_defs.emplace_back("buffer_pool = ${HPX_PARCEL_BUFFER_POOL:1}");
 #if defined(HPX_HAVE_PARCEL_COALESCING)
         ini_defs.emplace_back(
             "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:1}");
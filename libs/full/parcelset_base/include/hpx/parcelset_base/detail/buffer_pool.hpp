@@ -0,0 +1,86 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/synchronization.hpp>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::detail {
+
+    /// A pool of buffers used for serializing outgoing parcels and for
+    /// receiving incoming messages, every parcelport keeps its own pool. The
+    /// buffers are sorted into size classes (powers of two), a buffer taken
+    /// from the pool for a given size has at least that capacity.
+    class HPX_EXPORT buffer_pool
+    {
+    public:
+        using buffer_type = std::vector<char>;
+
+        buffer_pool();
+
+        buffer_pool(buffer_pool const&) = delete;
+        buffer_pool(buffer_pool&&) = delete;
+        buffer_pool& operator=(buffer_pool const&) = delete;
+        buffer_pool& operator=(buffer_pool&&) = delete;
+
+        ~buffer_pool() = default;
+
+        /// Return an empty buffer with a capacity of at least the given size.
+        /// The flag \a reused is set if the buffer was taken from the pool.
+        buffer_type acquire(std::size_t size, bool& reused);
+
+        /// Give a buffer back to the pool, the buffer is released if the pool
+        /// holds enough buffers of its size class already.
+        void release(buffer_type buffer) noexcept;
+
+        /// The number of buffers currently held by the pool
+        std::size_t size() const noexcept;
+
+    private:
+        // buffers between 1kB and 64MB are pooled
+        static constexpr std::size_t min_size_class = 10;
+        static constexpr std::size_t max_size_class = 26;
+
+        // the maximum number of buffers (and bytes) kept per size class
+        static constexpr std::size_t max_buffers_per_size_class = 16;
+        static constexpr std::size_t max_bytes_per_size_class =
+            std::size_t(64) * 1024 * 1024;
+
+        static constexpr std::size_t max_buffers(
+            std::size_t size_class) noexcept
+        {
+            std::size_t const count =
+                max_bytes_per_size_class >> size_class;
+            if (count == 0)
+                return 1;
+            return count < max_buffers_per_size_class ?
+                count :
+                max_buffers_per_size_class;
+        }
+
+        struct size_class
+        {
+            mutable hpx::spinlock mtx_;
+            std::vector<buffer_type> buffers_;
+        };
+
+        std::array<size_class, max_size_class - min_size_class + 1>
+            size_classes_;
+    };
+}    // namespace hpx::parcelset::detail
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -46,5 +46,12 @@ namespace hpx::parcelset {
 
         //// maximum size of zero-copy chunks
         std::int64_t size_zchunks_max_ = 0;
+
+        /// number of serialization buffers reused from the buffer pool
+        std::int64_t buffer_pool_hits_ = 0;
+
+        /// number of serialization buffers that had to be grown while
+        /// serializing
+        std::int64_t buffer_reallocations_ = 0;
     };
 }    // namespace hpx::parcelset
@@ -40,6 +40,8 @@ namespace hpx::parcelset {
             inline std::int64_t num_zchunks_per_msg_max(bool reset);
             inline std::int64_t size_zchunks_total(bool reset);
             inline std::int64_t size_zchunks_max(bool reset);
+            inline std::int64_t buffer_pool_hits(bool reset);
+            inline std::int64_t buffer_reallocations(bool reset);
 
         private:
             std::int64_t overall_bytes_ = 0;
@@ -53,6 +55,8 @@ namespace hpx::parcelset {
             std::int64_t num_zchunks_per_msg_max_ = 0;
             std::int64_t size_zchunks_total_ = 0;
             std::int64_t size_zchunks_max_ = 0;
+            std::int64_t buffer_pool_hits_ = 0;
+            std::int64_t buffer_reallocations_ = 0;
 
             // Create mutex for accumulator functions.
             Mutex acc_mtx;
@@ -76,6 +80,8 @@ namespace hpx::parcelset {
             size_zchunks_total_ += x.size_zchunks_total_;
             size_zchunks_max_ =
                 (std::max)(size_zchunks_max_, x.size_zchunks_max_);
+            buffer_pool_hits_ += x.buffer_pool_hits_;
+            buffer_reallocations_ += x.buffer_reallocations_;
         }
 
         template <typename Mutex>
@@ -154,6 +160,20 @@ namespace hpx::parcelset {
             std::lock_guard l(acc_mtx);
             return util::get_and_reset_value(size_zchunks_max_, reset);
         }
+
+        template <typename Mutex>
+        std::int64_t gatherer<Mutex>::buffer_pool_hits(bool reset)
+        {
+            std::lock_guard l(acc_mtx);
+            return util::get_and_reset_value(buffer_pool_hits_, reset);
+        }
+
+        template <typename Mutex>
+        std::int64_t gatherer<Mutex>::buffer_reallocations(bool reset)
+        {
+            std::lock_guard l(acc_mtx);
+            return util::get_and_reset_value(buffer_reallocations_, reset);
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -19,6 +19,7 @@
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/modules/synchronization.hpp>
 
+#include <hpx/parcelset_base/detail/buffer_pool.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/gatherer.hpp>
 #include <hpx/parcelset_base/detail/per_action_data_counter.hpp>
@@ -258,6 +259,13 @@ namespace hpx::parcelset {
 
         //// the maximum size of zero-copy chunks per message received
         std::int64_t get_zchunks_recv_size_max(bool reset);
+
+        /// number of serialization buffers reused from the buffer pool
+        std::int64_t get_buffer_pool_hits(bool reset);
+
+        /// number of serialization buffers that had to be grown while
+        /// serializing
+        std::int64_t get_buffer_reallocations(bool reset);
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -324,6 +332,11 @@ namespace hpx::parcelset {
 
         bool async_serialization() const noexcept;
 
+        /// Return the pool of buffers used for serializing outgoing parcels
+        /// and for receiving messages (empty if pooling buffers was disabled)
+        std::shared_ptr<detail::buffer_pool> const&
+        get_buffer_pool() const noexcept;
+
         // callback while bootstrap the parcel layer
         static void early_pending_parcel_handler(
             std::error_code const& ec, parcel const& p);
@@ -374,6 +387,9 @@ namespace hpx::parcelset {
         std::string type_;
 
         std::size_t zero_copy_serialization_threshold_;
+
+        /// buffers used for serializing outgoing and receiving parcels
+        std::shared_ptr<detail::buffer_pool> buffer_pool_;
     };
 }    // namespace hpx::parcelset
 
@@ -0,0 +1,129 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/parcelset_base/detail/buffer_pool.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+namespace hpx::parcelset::detail {
+
+    namespace {
+
+        // smallest n with 2^n >= size
+        std::size_t ceil_log2(std::size_t size) noexcept
+        {
+            std::size_t n = 0;
+            while ((std::size_t(1) << n) < size)
+            {
+                ++n;
+            }
+            return n;
+        }
+
+        // largest n with 2^n <= size
+        std::size_t floor_log2(std::size_t size) noexcept
+        {
+            HPX_ASSERT(size != 0);
+
+            std::size_t n = 0;
+            while ((size >>= 1) != 0)
+            {
+                ++n;
+            }
+            return n;
+        }
+    }    // namespace
+
+    buffer_pool::buffer_pool()
+    {
+        // make sure releasing buffers never allocates
+        for (std::size_t i = 0; i != size_classes_.size(); ++i)
+        {
+            size_classes_[i].buffers_.reserve(
+                max_buffers(i + min_size_class));
+        }
+    }
+
+    buffer_pool::buffer_type buffer_pool::acquire(
+        std::size_t size, bool& reused)
+    {
+        reused = false;
+
+        std::size_t n = ceil_log2(size);
+        if (n > max_size_class)
+        {
+            // very large buffers are not pooled
+            buffer_type buffer;
+            buffer.reserve(size);
+            return buffer;
+        }
+        if (n < min_size_class)
+        {
+            n = min_size_class;
+        }
+
+        size_class& c = size_classes_[n - min_size_class];
+        {
+            std::lock_guard l(c.mtx_);
+            if (!c.buffers_.empty())
+            {
+                buffer_type buffer = HPX_MOVE(c.buffers_.back());
+                c.buffers_.pop_back();
+
+                HPX_ASSERT(buffer.empty() && buffer.capacity() >= size);
+                reused = true;
+                return buffer;
+            }
+        }
+
+        buffer_type buffer;
+        buffer.reserve(std::size_t(1) << n);
+        return buffer;
+    }
+
+    void buffer_pool::release(buffer_type buffer) noexcept
+    {
+        std::size_t const capacity = buffer.capacity();
+        if (capacity < (std::size_t(1) << min_size_class))
+        {
+            return;
+        }
+
+        std::size_t const n = floor_log2(capacity);
+        if (n > max_size_class)
+        {
+            return;
+        }
+
+        buffer.clear();
+
+        size_class& c = size_classes_[n - min_size_class];
+        std::lock_guard l(c.mtx_);
+        if (c.buffers_.size() < max_buffers(n))
+        {
+            c.buffers_.push_back(HPX_MOVE(buffer));
+        }
+    }
+
+    std::size_t buffer_pool::size() const noexcept
+    {
+        std::size_t result = 0;
+        for (size_class const& c : size_classes_)
+        {
+            std::lock_guard l(c.mtx_);
+            result += c.buffers_.size();
+        }
+        return result;
+    }
+}    // namespace hpx::parcelset::detail
+
+#endif
@@ -25,6 +25,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <memory>
 #include <string>
 #include <system_error>
 #include <utility>
@@ -77,6 +78,14 @@ namespace hpx::parcelset {
         {
             async_serialization_ = true;
         }
+
+        int const use_buffer_pool =
+            hpx::util::get_entry_as<int>(ini, "hpx.parcel.buffer_pool", 1);
+        if (hpx::util::get_entry_as<int>(
+                ini, key + ".buffer_pool", use_buffer_pool) != 0)
+        {
+            buffer_pool_ = std::make_shared<detail::buffer_pool>();
+        }
     }
 
     int parcelport::priority() const noexcept
@@ -271,6 +280,18 @@ namespace hpx::parcelset {
     {
         return parcels_received_.size_zchunks_max(reset);
     }
+
+    // number of serialization buffers reused from the buffer pool
+    std::int64_t parcelport::get_buffer_pool_hits(bool reset)
+    {
+        return parcels_sent_.buffer_pool_hits(reset);
+    }
+
+    // number of serialization buffers that had to be grown while serializing
+    std::int64_t parcelport::get_buffer_reallocations(bool reset)
+    {
+        return parcels_sent_.buffer_reallocations(reset);
+    }
 #endif
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
@@ -381,6 +402,12 @@ namespace hpx::parcelset {
         return async_serialization_;
     }
 
+    std::shared_ptr<detail::buffer_pool> const& parcelport::get_buffer_pool()
+        const noexcept
+    {
+        return buffer_pool_;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // the code below is needed to bootstrap the parcel layer
     void parcelport::early_pending_parcel_handler(
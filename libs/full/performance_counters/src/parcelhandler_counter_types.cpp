@@ -129,6 +129,12 @@ namespace hpx::performance_counters {
             hpx::bind_front(
                 &parcelhandler::get_zchunks_recv_size_max, &ph, pp_type));
 
+        hpx::function<std::int64_t(bool)> buffer_pool_hits(hpx::bind_front(
+            &parcelhandler::get_buffer_pool_hits, &ph, pp_type));
+        hpx::function<std::int64_t(bool)> buffer_reallocations(
+            hpx::bind_front(
+                &parcelhandler::get_buffer_reallocations, &ph, pp_type));
+
         performance_counters::generic_counter_type_data const counter_types[] =
             {
                 {hpx::util::format("/parcels/count/{}/sent", pp_type),
@@ -476,6 +482,35 @@ namespace hpx::performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         HPX_MOVE(size_zchunks_recv_per_msg_max), _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/buffer_pool/hits", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of serialization buffers reused "
+                        "from the buffer pool of the {} connection type for "
+                        "the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(buffer_pool_hits), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/buffer_pool/reallocations",
+                     pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of serialization buffers which "
+                        "had to be grown while serializing parcels sent using "
+                        "the {} connection type for the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(buffer_reallocations), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
             };
 
         performance_counters::install_counter_types(
@@ -10,6 +10,11 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
+#include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
@@ -354,6 +359,10 @@ namespace hpx::performance_counters {
     ///////////////////////////////////////////////////////////////////////////
     void register_threadmanager_counter_types(threads::threadmanager& tm)
     {
+#if defined(HPX_COROUTINES_HAVE_STACK_POOL)
+        using hpx::placeholders::_1;
+        using hpx::placeholders::_2;
+#endif
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
         create_counter_func counts_creator(
             hpx::bind_front(&detail::thread_counts_counter_creator));
@@ -368,6 +377,86 @@ namespace hpx::performance_counters {
                     &tm, &threads::threadmanager::get_queue_length,
                     &threads::thread_pool_base::get_queue_length),
                 &locality_pool_thread_counter_discoverer, ""},
+            // number of armed timers in the timer wheel(s)
+            {"/threadqueue/timer-wheel/occupancy", counter_type::raw,
+                "returns the current number of timers armed in the timer "
+                "wheel(s) of the referenced worker thread(s)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_timer_wheel_occupancy,
+                    &threads::thread_pool_base::get_timer_wheel_occupancy),
+                &locality_pool_thread_counter_discoverer, ""},
+            // memory allocated from the memory arena(s) of the thread pool(s)
+            {"/threads/arena/bytes-in-use", counter_type::raw,
+                "returns the number of bytes currently allocated from the "
+                "memory arena(s) of the referenced thread pool(s)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_arena_bytes_in_use,
+                    &threads::thread_pool_base::get_arena_bytes_in_use),
+                &locality_pool_counter_discoverer, "bytes"},
+            // memory released on threads of other thread pools
+            {"/threads/count/arena-cross-deallocations",
+                counter_type::monotonically_increasing,
+                "returns the number of memory blocks allocated from the memory "
+                "arena(s) of the referenced thread pool(s) which were released "
+                "by threads not belonging to the same thread pool",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_arena_cross_deallocations,
+                    &threads::thread_pool_base::get_arena_cross_deallocations),
+                &locality_pool_counter_discoverer, ""},
+            // thread objects reused by a different queue than the one they
+            // terminated on
+            {"/threads/count/objects-reused-cross-queue",
+                counter_type::monotonically_increasing,
+                "returns the number of terminated HPX-thread objects which "
+                "were reused by a different thread queue of the referenced "
+                "thread pool(s) than the one they have been terminated on",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::
+                        get_thread_recycler_cross_queue_reuses,
+                    &threads::thread_pool_base::
+                        get_thread_recycler_cross_queue_reuses),
+                &locality_pool_counter_discoverer, ""},
+            // thread objects destroyed instead of being kept for reuse
+            {"/threads/count/objects-freed",
+                counter_type::monotonically_increasing,
+                "returns the number of terminated HPX-thread objects of the "
+                "referenced thread pool(s) which were destroyed as the limit "
+                "of thread objects kept for reuse was exceeded",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_thread_recycler_objects_freed,
+                    &threads::thread_pool_base::
+                        get_thread_recycler_objects_freed),
+                &locality_pool_counter_discoverer, ""},
+            // threads run optimistically which never suspended
+            {"/threads/count/run-to-completion",
+                counter_type::monotonically_increasing,
+                "returns the number of HPX-threads run optimistically on a "
+                "stack borrowed from the worker thread which terminated "
+                "without ever suspending for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_threads_run_to_completion,
+                    &threads::thread_pool_base::get_threads_run_to_completion),
+                &locality_pool_thread_counter_discoverer, ""},
+            // threads run optimistically which suspended
+            {"/threads/count/promoted",
+                counter_type::monotonically_increasing,
+                "returns the number of HPX-threads run optimistically on a "
+                "stack borrowed from the worker thread which were promoted to "
+                "a stackful thread as they suspended for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_threads_promoted,
+                    &threads::thread_pool_base::get_threads_promoted),
+                &locality_pool_thread_counter_discoverer, ""},
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
             // average thread wait time for queue(s)
             {"/threads/wait-time/pending", counter_type::average_timer,
@@ -616,6 +705,38 @@ namespace hpx::performance_counters {
                 &locality_counter_discoverer, ""},
 #endif
 #endif
+#if defined(HPX_COROUTINES_HAVE_STACK_POOL)
+            {"/threads/count/stack-pool-hits",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stacks taken from the "
+                "stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&locality_raw_counter_creator, _1,
+                    &threads::coroutines::detail::posix::
+                        get_stack_pool_hit_count,
+                    _2),
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-misses",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stacks which had to be "
+                "newly allocated for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&locality_raw_counter_creator, _1,
+                    &threads::coroutines::detail::posix::
+                        get_stack_pool_miss_count,
+                    _2),
+                &locality_counter_discoverer, ""},
+            {"/threads/stack-mapped-bytes", counter_type::raw,
+                "returns the number of bytes of address space mapped for "
+                "HPX-thread stacks (in use or pooled) for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&locality_raw_counter_creator, _1,
+                    &threads::coroutines::detail::posix::
+                        get_stack_mapped_bytes,
+                    _2),
+                &locality_counter_discoverer, "bytes"},
+#endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {"/threads/count/pending-misses",
                 counter_type::monotonically_increasing,
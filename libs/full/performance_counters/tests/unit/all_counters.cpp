@@ -7,6 +7,10 @@
 #include <hpx/config.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/hpx_main.hpp>
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
 #include <hpx/include/naming.hpp>
 #include <hpx/include/performance_counters.hpp>
 #include <hpx/include/runtime.hpp>
@@ -21,6 +25,7 @@
 char const* const locality_pool_thread_counter_names[] =
 {
     "/threadqueue/length",
+    "/threadqueue/timer-wheel/occupancy",
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
     "/threads/wait-time/pending",
     "/threads/wait-time/staged",
@@ -83,6 +88,14 @@ char const* const locality_counter_names[] = {
     "/threads/count/stack-unbinds",
 #endif
 #endif
+#if defined(HPX_COROUTINES_HAVE_STACK_POOL)
+    "/threads/count/stack-pool-hits",
+    "/threads/count/stack-pool-misses",
+    "/threads/stack-mapped-bytes",
+#endif
+    "/threads/arena/bytes-in-use", "/threads/count/arena-cross-deallocations",
+    "/threads/count/objects-reused-cross-queue", "/threads/count/objects-freed",
+    "/threads/count/run-to-completion", "/threads/count/promoted",
     "/scheduler/utilization/instantaneous", nullptr};
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8,6 +8,7 @@
 #include <hpx/future.hpp>
 #include <hpx/init.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
 
 #include "worker_timed.hpp"
 
@@ -15,6 +16,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -65,12 +67,8 @@ hpx::future<void> spawn_level(std::size_t num_tasks)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-int hpx_main(hpx::program_options::variables_map& vm)
+void measure(std::size_t num_tasks, std::string const& name)
 {
-    std::size_t num_tasks = 128;
-    if (vm.count("tasks"))
-        num_tasks = vm["tasks"].as<std::size_t>();
-
     double seqential_time_per_task = 0;
 
     {
@@ -88,11 +86,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
         seqential_time_per_task =
             static_cast<double>(end - start) / 1e9 / num_tasks;
-        std::cout << "Elapsed sequential time: "
+        std::cout << "Elapsed sequential time" << name << ": "
                   << static_cast<double>(end - start) / 1e9 << " [s], ("
                   << seqential_time_per_task << " [s])" << std::endl;
         hpx::util::print_cdash_timing(
-            "AsyncSequential", seqential_time_per_task);
+            ("AsyncSequential" + name).c_str(), seqential_time_per_task);
     }
 
     double hierarchical_time_per_task = 0;
@@ -107,19 +105,50 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
         hierarchical_time_per_task =
             static_cast<double>(end - start) / 1e9 / num_tasks;
-        std::cout << "Elapsed hierarchical time: "
+        std::cout << "Elapsed hierarchical time" << name << ": "
                   << static_cast<double>(end - start) / 1e9 << " [s], ("
                   << hierarchical_time_per_task << " [s])" << std::endl;
         hpx::util::print_cdash_timing(
-            "AsyncHierarchical", hierarchical_time_per_task);
+            ("AsyncHierarchical" + name).c_str(), hierarchical_time_per_task);
     }
 
-    std::cout << "Ratio (speedup): "
+    std::cout << "Ratio (speedup)" << name << ": "
               << seqential_time_per_task / hierarchical_time_per_task
               << std::endl;
 
-    hpx::util::print_cdash_timing(
-        "AsyncSpeedup", seqential_time_per_task / hierarchical_time_per_task);
+    hpx::util::print_cdash_timing(("AsyncSpeedup" + name).c_str(),
+        seqential_time_per_task / hierarchical_time_per_task);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t num_tasks = 128;
+    if (vm.count("tasks"))
+        num_tasks = vm["tasks"].as<std::size_t>();
+
+    measure(num_tasks, "");
+
+    if (vm.count("optimistic-stackless"))
+    {
+        using hpx::threads::policies::scheduler_mode;
+
+        // run the tasks on stacks borrowed from the worker threads, tasks
+        // are promoted to stackful threads only if they suspend
+        hpx::threads::add_scheduler_mode(scheduler_mode::optimistic_stackless);
+
+        measure(num_tasks, "OptimisticStackless");
+
+        hpx::threads::remove_scheduler_mode(
+            scheduler_mode::optimistic_stackless);
+
+        auto* pool = hpx::threads::detail::get_self_or_default_pool();
+        std::size_t const all_threads = static_cast<std::size_t>(-1);
+        std::cout << "Tasks run to completion: "
+                  << pool->get_threads_run_to_completion(all_threads, false)
+                  << ", promoted: "
+                  << pool->get_threads_promoted(all_threads, false)
+                  << std::endl;
+    }
 
     return hpx::finalize();
 }
@@ -139,7 +168,10 @@ int main(int argc, char* argv[])
         ("spread,p", value<std::size_t>(&spread)->default_value(2),
          "number of sub-spawns per level (default: 2)")
         ("delay,d", value<std::uint64_t>(&delay_ns)->default_value(0),
-        "time spent in the delay loop [ns]");
+        "time spent in the delay loop [ns]")
+        ("optimistic-stackless",
+         "additionally run all tasks optimistically on stacks borrowed from "
+         "the worker threads");
     // clang-format on
 
     // Initialize and run HPX
@@ -0,0 +1,134 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the overhead of short parallel regions executed
+// back to back, once as bulk operations on a thread_pool_scheduler (which
+// spawns new tasks for every region), once as bulk operations on a
+// thread_pool_scheduler with a persistent bulk_team attached, and once using
+// the fork_join_executor.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/format.hpp>
+#include <hpx/init.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/runtime.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+void print_result(char const* variant, std::size_t n, std::size_t iterations,
+    double elapsed)
+{
+    hpx::util::format_to(std::cout, "{},{},{},{},{}\n", variant,
+        hpx::get_os_thread_count(), n, iterations,
+        elapsed / static_cast<double>(iterations));
+}
+
+template <typename Region>
+double measure(std::size_t n, std::size_t iterations, Region&& region)
+{
+    std::vector<std::uint64_t> v(n, 0);
+
+    hpx::chrono::high_resolution_timer timer;
+    for (std::size_t iter = 0; iter != iterations; ++iter)
+    {
+        region(v);
+    }
+    double const elapsed = timer.elapsed();
+
+    // every element has to be touched exactly once per region
+    for (std::uint64_t const value : v)
+    {
+        if (value != iterations)
+        {
+            std::cout << "Error: wrong result!\n";
+            break;
+        }
+    }
+    return elapsed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const n = vm["vector_size"].as<std::size_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+
+    if (vm.count("no-header") == 0)
+    {
+        std::cout << "variant,threads,vector_size,iterations,"
+                     "time_per_region[s]\n";
+    }
+
+    auto const increment = [](std::vector<std::uint64_t>& v) {
+        return [&v](std::size_t i) { ++v[i]; };
+    };
+
+    print_result("thread_pool_scheduler", n, iterations,
+        measure(n, iterations, [&](std::vector<std::uint64_t>& v) {
+            ex::schedule(ex::thread_pool_scheduler{}) |
+                ex::bulk(n, increment(v)) | tt::sync_wait();
+        }));
+
+    {
+        ex::bulk_team team;
+        auto const sched =
+            ex::with_bulk_team(ex::thread_pool_scheduler{}, team);
+
+        print_result("bulk_team", n, iterations,
+            measure(n, iterations, [&](std::vector<std::uint64_t>& v) {
+                ex::schedule(sched) | ex::bulk(n, increment(v)) |
+                    tt::sync_wait();
+            }));
+    }
+
+    {
+        hpx::execution::experimental::fork_join_executor exec;
+
+        print_result("fork_join_executor", n, iterations,
+            measure(n, iterations, [&](std::vector<std::uint64_t>& v) {
+                hpx::experimental::for_loop(hpx::execution::par.on(exec),
+                    std::size_t(0), n, increment(v));
+            }));
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(1024),
+         "number of elements processed by each region (default: 1024)")
+        ("iterations", value<std::size_t>()->default_value(10000),
+         "number of regions executed for each variant (default: 10000)")
+        ("no-header", "do not print out the csv header row")
+        ;
+    // clang-format on
+
+    // By default this benchmark should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,206 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of the various channel types for
+// varying numbers of concurrent producers and consumers.
+
+#include <hpx/channel.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/format.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/runtime.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// try_set/try_get based channels (hpx::lcos::local::channel_mpmc and friends)
+template <typename Channel>
+void channel_set(Channel& c, std::size_t value)
+{
+    while (!c.set(std::move(value)))    // NOLINT
+    {
+        hpx::this_thread::yield();
+    }
+}
+
+template <typename Channel>
+std::size_t channel_get(Channel& c)
+{
+    std::size_t result = 0;
+    while (!c.get(&result))
+    {
+        hpx::this_thread::yield();
+    }
+    return result;
+}
+
+// future based channels (hpx::lcos::local::channel)
+void channel_set(hpx::lcos::local::channel<std::size_t>& c, std::size_t value)
+{
+    c.set(value);
+}
+
+std::size_t channel_get(hpx::lcos::local::channel<std::size_t>& c)
+{
+    return c.get().get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Channel>
+double measure(Channel& c, std::size_t producers, std::size_t consumers,
+    std::size_t items)
+{
+    std::size_t const total = producers * items;
+
+    std::vector<hpx::future<std::size_t>> tasks;
+    tasks.reserve(producers + consumers);
+
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i != consumers; ++i)
+    {
+        // distribute the items as evenly as possible over the consumers
+        std::size_t const count =
+            total / consumers + (i < total % consumers ? 1 : 0);
+
+        tasks.push_back(hpx::async([&c, count]() {
+            std::size_t sum = 0;
+            for (std::size_t j = 0; j != count; ++j)
+            {
+                sum += channel_get(c);
+            }
+            return sum;
+        }));
+    }
+
+    for (std::size_t i = 0; i != producers; ++i)
+    {
+        tasks.push_back(hpx::async([&c, items]() {
+            for (std::size_t j = 0; j != items; ++j)
+            {
+                channel_set(c, j);
+            }
+            return std::size_t(0);
+        }));
+    }
+
+    std::size_t sum = 0;
+    for (auto& f : tasks)
+    {
+        sum += f.get();
+    }
+
+    std::uint64_t const end = hpx::chrono::high_resolution_clock::now();
+
+    if (sum != producers * (items * (items - 1) / 2))
+    {
+        std::cout << "Error: received unexpected values!\n";
+    }
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+void print_result(char const* name, std::size_t producers,
+    std::size_t consumers, std::size_t items, double elapsed)
+{
+    hpx::util::format_to(std::cout, "{},{},{},{},{},{}\n", name, producers,
+        consumers, items, elapsed,
+        static_cast<double>(producers * items) / elapsed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const items = vm["items"].as<std::size_t>();
+    std::size_t const size = vm["channel-size"].as<std::size_t>();
+
+    std::size_t max_producers = hpx::get_os_thread_count();
+    if (vm.count("max-producers") != 0)
+        max_producers = vm["max-producers"].as<std::size_t>();
+
+    std::size_t max_consumers = hpx::get_os_thread_count();
+    if (vm.count("max-consumers") != 0)
+        max_consumers = vm["max-consumers"].as<std::size_t>();
+
+    if (vm.count("no-header") == 0)
+    {
+        std::cout << "channel,producers,consumers,items_per_producer,"
+                     "time[s],throughput[op/s]\n";
+    }
+
+    for (std::size_t producers = 1; producers <= max_producers;
+         producers *= 2)
+    {
+        for (std::size_t consumers = 1; consumers <= max_consumers;
+             consumers *= 2)
+        {
+            {
+                hpx::lcos::local::bounded_channel<std::size_t, hpx::spinlock>
+                    c(size);
+                print_result("bounded_channel", producers, consumers, items,
+                    measure(c, producers, consumers, items));
+            }
+            {
+                hpx::lcos::local::lockfree_bounded_channel<std::size_t> c(
+                    size);
+                print_result("lockfree_bounded_channel", producers, consumers,
+                    items, measure(c, producers, consumers, items));
+            }
+            {
+                hpx::lcos::local::lockfree_unbounded_channel<std::size_t> c;
+                print_result("lockfree_unbounded_channel", producers,
+                    consumers, items, measure(c, producers, consumers, items));
+            }
+            {
+                hpx::lcos::local::channel<std::size_t> c;
+                print_result("channel", producers, consumers, items,
+                    measure(c, producers, consumers, items));
+            }
+            {
+                hpx::lcos::local::channel<std::size_t> c(
+                    hpx::lcos::local::channel_lockfree);
+                print_result("channel_lockfree", producers, consumers, items,
+                    measure(c, producers, consumers, items));
+            }
+        }
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("items", value<std::size_t>()->default_value(100000),
+         "number of items sent by each producer (default: 100000)")
+        ("channel-size", value<std::size_t>()->default_value(1024),
+         "capacity of the bounded channels (default: 1024)")
+        ("max-producers", value<std::size_t>(),
+         "maximal number of producers (default: number of cores)")
+        ("max-consumers", value<std::size_t>(),
+         "maximal number of consumers (default: number of cores)")
+        ("no-header", "do not print out the csv header row")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,229 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares a row-wise parallelization of the matrix transpose
+// (examples/transpose) and Jacobi (examples/jacobi_smp) kernels with the
+// multi-dimensional for_loop, once with the default executor parameters and
+// once with tiles chosen to fit into the L2 cache.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/format.hpp>
+#include <hpx/init.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/runtime.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+void print_result(char const* kernel, char const* variant, std::size_t n,
+    std::size_t iterations, double elapsed)
+{
+    hpx::util::format_to(std::cout, "{},{},{},{},{},{}\n", kernel, variant,
+        hpx::get_os_thread_count(), n, iterations,
+        elapsed / static_cast<double>(iterations));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// B = A^T
+template <typename Transpose>
+double measure_transpose(std::size_t n, std::size_t iterations,
+    std::vector<double> const& A, std::vector<double>& B, Transpose&& t)
+{
+    hpx::chrono::high_resolution_timer timer;
+    for (std::size_t iter = 0; iter != iterations; ++iter)
+    {
+        t(n, A, B);
+    }
+    double const elapsed = timer.elapsed();
+
+    // verify result
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        for (std::size_t j = 0; j != n; ++j)
+        {
+            if (B[j * n + i] != A[i * n + j])
+            {
+                std::cout << "Error: wrong transpose result!\n";
+                return elapsed;
+            }
+        }
+    }
+    return elapsed;
+}
+
+void run_transpose(std::size_t n, std::size_t iterations)
+{
+    std::vector<double> A(n * n);
+    std::vector<double> B(n * n);
+    for (std::size_t i = 0; i != n * n; ++i)
+    {
+        A[i] = static_cast<double>(i);
+    }
+
+    using hpx::execution::par;
+
+    print_result("transpose", "rows", n, iterations,
+        measure_transpose(n, iterations, A, B,
+            [](std::size_t n, auto const& A, auto& B) {
+                hpx::experimental::for_loop(
+                    par, std::size_t(0), n, [&](std::size_t i) {
+                        for (std::size_t j = 0; j != n; ++j)
+                        {
+                            B[j * n + i] = A[i * n + j];
+                        }
+                    });
+            }));
+
+    std::array<std::size_t, 2> const first = {0, 0};
+    std::array<std::size_t, 2> const last = {n, n};
+
+    print_result("transpose", "md", n, iterations,
+        measure_transpose(n, iterations, A, B,
+            [&](std::size_t n, auto const& A, auto& B) {
+                hpx::experimental::for_loop(
+                    par, first, last, [&](std::size_t i, std::size_t j) {
+                        B[j * n + i] = A[i * n + j];
+                    });
+            }));
+
+    print_result("transpose", "md_tiled", n, iterations,
+        measure_transpose(n, iterations, A, B,
+            [&](std::size_t n, auto const& A, auto& B) {
+                hpx::experimental::for_loop(par.with(ex::cache_tiling()),
+                    first, last, [&](std::size_t i, std::size_t j) {
+                        B[j * n + i] = A[i * n + j];
+                    });
+            }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// 5-point Jacobi iteration
+template <typename Sweep>
+double measure_jacobi(std::size_t n, std::size_t iterations,
+    std::vector<double>& reference, Sweep&& sweep)
+{
+    std::vector<double> grid_new(n * n, 1.0);
+    std::vector<double> grid_old(n * n, 1.0);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        grid_old[i] = grid_new[i] = 0.0;
+    }
+
+    hpx::chrono::high_resolution_timer timer;
+    for (std::size_t iter = 0; iter != iterations; ++iter)
+    {
+        sweep(n, grid_new.data(), grid_old.data());
+        std::swap(grid_new, grid_old);
+    }
+    double const elapsed = timer.elapsed();
+
+    // all variants have to produce the same result
+    if (reference.empty())
+    {
+        reference = std::move(grid_old);
+    }
+    else if (reference != grid_old)
+    {
+        std::cout << "Error: wrong jacobi result!\n";
+    }
+    return elapsed;
+}
+
+inline void jacobi_point(
+    double* dst, double const* src, std::size_t n, std::size_t y, std::size_t x)
+{
+    std::size_t const i = y * n + x;
+    dst[i] = (src[i - n] + src[i + n] + src[i] + src[i - 1] + src[i + 1]) * 0.2;
+}
+
+void run_jacobi(std::size_t n, std::size_t iterations)
+{
+    using hpx::execution::par;
+
+    std::vector<double> reference;
+
+    print_result("jacobi", "rows", n, iterations,
+        measure_jacobi(n, iterations, reference,
+            [](std::size_t n, double* dst, double const* src) {
+                hpx::experimental::for_loop(
+                    par, std::size_t(1), n - 1, [&](std::size_t y) {
+                        for (std::size_t x = 1; x != n - 1; ++x)
+                        {
+                            jacobi_point(dst, src, n, y, x);
+                        }
+                    });
+            }));
+
+    std::array<std::size_t, 2> const first = {1, 1};
+    std::array<std::size_t, 2> const last = {n - 1, n - 1};
+
+    print_result("jacobi", "md", n, iterations,
+        measure_jacobi(n, iterations, reference,
+            [&](std::size_t n, double* dst, double const* src) {
+                hpx::experimental::for_loop(
+                    par, first, last, [&](std::size_t y, std::size_t x) {
+                        jacobi_point(dst, src, n, y, x);
+                    });
+            }));
+
+    print_result("jacobi", "md_tiled", n, iterations,
+        measure_jacobi(n, iterations, reference,
+            [&](std::size_t n, double* dst, double const* src) {
+                hpx::experimental::for_loop(par.with(ex::cache_tiling()),
+                    first, last, [&](std::size_t y, std::size_t x) {
+                        jacobi_point(dst, src, n, y, x);
+                    });
+            }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const n = vm["matrix_size"].as<std::size_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+
+    if (vm.count("no-header") == 0)
+    {
+        std::cout << "kernel,variant,threads,matrix_size,iterations,"
+                     "time_per_iteration[s]\n";
+    }
+
+    run_transpose(n, iterations);
+    run_jacobi(n, iterations);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("matrix_size", value<std::size_t>()->default_value(2048),
+         "number of rows and columns of the matrices (default: 2048)")
+        ("iterations", value<std::size_t>()->default_value(10),
+         "number of iterations of each kernel (default: 10)")
+        ("no-header", "do not print out the csv header row")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -25,8 +25,10 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <new>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -49,27 +51,187 @@ static std::size_t numa_sensitive = 0;
 static std::uint64_t num_threads = 1;
 static std::string info_string = "";
 
+///////////////////////////////////////////////////////////////////////////////
+// Count the number of heap allocations performed by the measured code. All
+// replaceable forms of operator new are counted. Memory taken directly from
+// malloc or from the memory arenas of the thread pools is not counted.
+static std::atomic<std::uint64_t> allocation_count(0);
+
+static void* counted_allocate(std::size_t size) noexcept
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new(std::size_t size)
+{
+    if (void* p = counted_allocate(size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    if (void* p = counted_allocate(size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept
+{
+    return counted_allocate(size);
+}
+
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept
+{
+    return counted_allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::nothrow_t const&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::nothrow_t const&) noexcept
+{
+    std::free(p);
+}
+
+#if defined(HPX_HAVE_CXX17_ALIGNED_NEW)
+// The pointer returned from malloc is stored right in front of the aligned
+// block, this works on all platforms (unlike std::aligned_alloc).
+static void* counted_allocate(std::size_t size, std::align_val_t al) noexcept
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    std::size_t const alignment = static_cast<std::size_t>(al);
+    void* p = std::malloc(size + alignment + sizeof(void*));
+    if (p == nullptr)
+        return nullptr;
+
+    std::uintptr_t const addr =
+        reinterpret_cast<std::uintptr_t>(p) + sizeof(void*);
+    void* aligned =
+        reinterpret_cast<void*>((addr + alignment - 1) & ~(alignment - 1));
+    static_cast<void**>(aligned)[-1] = p;
+    return aligned;
+}
+
+static void counted_deallocate(void* p) noexcept
+{
+    if (p != nullptr)
+        std::free(static_cast<void**>(p)[-1]);
+}
+
+void* operator new(std::size_t size, std::align_val_t al)
+{
+    if (void* p = counted_allocate(size, al))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t al)
+{
+    if (void* p = counted_allocate(size, al))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(
+    std::size_t size, std::align_val_t al, std::nothrow_t const&) noexcept
+{
+    return counted_allocate(size, al);
+}
+
+void* operator new[](
+    std::size_t size, std::align_val_t al, std::nothrow_t const&) noexcept
+{
+    return counted_allocate(size, al);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    counted_deallocate(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept
+{
+    counted_deallocate(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+    counted_deallocate(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept
+{
+    counted_deallocate(p);
+}
+
+void operator delete(
+    void* p, std::align_val_t, std::nothrow_t const&) noexcept
+{
+    counted_deallocate(p);
+}
+
+void operator delete[](
+    void* p, std::align_val_t, std::nothrow_t const&) noexcept
+{
+    counted_deallocate(p);
+}
+#endif
+
+void reset_allocation_count()
+{
+    allocation_count.store(0, std::memory_order_relaxed);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void print_stats(char const* title, char const* wait, char const* exec,
     std::int64_t count, double duration, bool csv)
 {
     std::ostringstream temp;
     double const us = 1e6 * duration / count;
+    double const allocs =
+        static_cast<double>(allocation_count.load(std::memory_order_relaxed)) /
+        count;
     if (csv)
     {
         hpx::util::format_to(temp,
-            "{1}, {:27}, {:15}, {:18}, {:8}, {:8}, {:20}, {:4}, {:4}, "
+            "{1}, {:27}, {:15}, {:18}, {:8}, {:8}, {:8}, {:20}, {:4}, {:4}, "
             "{:20}",
-            count, title, wait, exec, duration, us, queuing, numa_sensitive,
-            num_threads, info_string);
+            count, title, wait, exec, duration, us, allocs, queuing,
+            numa_sensitive, num_threads, info_string);
     }
     else
     {
         hpx::util::format_to(temp,
             "invoked {:1}, futures {:27} {:15} {:18} in {:8} seconds : {:8} "
-            "us/future, queue {:20}, numa {:4}, threads {:4}, info {:20}",
-            count, title, wait, exec, duration, us, queuing, numa_sensitive,
-            num_threads, info_string);
+            "us/future, {:8} allocs/future (operator new, excluding pool "
+            "arenas), queue {:20}, numa {:4}, threads {:4}, info {:20}",
+            count, title, wait, exec, duration, us, allocs, queuing,
+            numa_sensitive, num_threads, info_string);
     }
     std::cout << temp.str() << std::endl;
     // CDash graph plotting
@@ -131,6 +293,7 @@ void measure_action_futures_wait_each(std::uint64_t count, bool csv)
     futures.reserve(count);
 
     // start the clock
+    reset_allocation_count();
     high_resolution_timer const walltime;
     for (std::uint64_t i = 0; i < count; ++i)
         futures.push_back(async<null_action>(here));
@@ -149,6 +312,7 @@ void measure_action_futures_wait_all(std::uint64_t count, bool csv)
     futures.reserve(count);
 
     // start the clock
+    reset_allocation_count();
     high_resolution_timer const walltime;
     for (std::uint64_t i = 0; i < count; ++i)
         futures.push_back(async<null_action>(here));
@@ -169,6 +333,7 @@ void measure_function_futures_wait_each(
     futures.reserve(count);
 
     // start the clock
+    reset_allocation_count();
     high_resolution_timer const walltime;
     for (std::uint64_t i = 0; i < count; ++i)
         futures.push_back(async(exec, &null_function));
@@ -187,6 +352,7 @@ void measure_function_futures_wait_all(
     futures.reserve(count);
 
     // start the clock
+    reset_allocation_count();
     high_resolution_timer const walltime;
     for (std::uint64_t i = 0; i < count; ++i)
         futures.push_back(async(exec, &null_function));
@@ -196,6 +362,28 @@ void measure_function_futures_wait_all(
     print_stats("async", "WaitAll", exec_name(exec), count, duration, csv);
 }
 
+// Time attaching continuations to futures
+template <typename Executor>
+void measure_function_futures_then(
+    std::uint64_t count, bool csv, Executor& exec)
+{
+    std::vector<future<double>> futures;
+    futures.reserve(count);
+
+    // start the clock
+    reset_allocation_count();
+    high_resolution_timer const walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        futures.push_back(async(exec, &null_function).then(
+            exec, [](future<double>&& f) { return f.get(); }));
+    }
+    hpx::wait_all(futures);
+
+    double const duration = walltime.elapsed();
+    print_stats("then", "WaitAll", exec_name(exec), count, duration, csv);
+}
+
 template <typename Executor>
 void measure_function_futures_limiting_executor(
     std::uint64_t count, bool csv, Executor exec)
@@ -227,6 +415,7 @@ void measure_function_futures_limiting_executor(
     hpx::execution::experimental::static_chunk_size fixed(chunk_size);
 
     // start the clock
+    reset_allocation_count();
     high_resolution_timer const walltime;
     {
         hpx::execution::experimental::limiting_executor<Executor> signal_exec(
@@ -257,6 +446,7 @@ void measure_function_futures_sliding_semaphore(
     std::uint64_t count, bool csv, Executor& exec)
 {
     // start the clock
+    reset_allocation_count();
     high_resolution_timer const walltime;
     constexpr int sem_count = 5000;
     auto sem = std::make_shared<hpx::sliding_semaphore>(sem_count);
@@ -298,6 +488,7 @@ void measure_function_futures_for_loop(std::uint64_t count, bool csv,
     Executor& exec, char const* executor_name = nullptr)
 {
     // start the clock
+    reset_allocation_count();
     high_resolution_timer const walltime;
     hpx::experimental::for_loop(
         hpx::execution::par.on(exec).with(
@@ -316,6 +507,7 @@ void measure_function_futures_register_work(std::uint64_t count, bool csv)
     hpx::latch l(count);
 
     // start the clock
+    reset_allocation_count();
     high_resolution_timer const walltime;
     for (std::uint64_t i = 0; i < count; ++i)
     {
@@ -352,6 +544,7 @@ void measure_function_futures_create_thread(std::uint64_t count, bool csv)
     hpx::error_code ec;
 
     // start the clock
+    reset_allocation_count();
     high_resolution_timer const walltime;
     for (std::uint64_t i = 0; i < count; ++i)
     {
@@ -401,6 +594,7 @@ void measure_function_futures_create_thread_hierarchical_placement(
     hpx::error_code ec;
 
     // start the clock
+    reset_allocation_count();
     high_resolution_timer const walltime;
     for (std::size_t t = 0; t < num_threads; ++t)
     {
@@ -450,6 +644,7 @@ void measure_function_futures_apply_hierarchical_placement(
     auto const num_threads = hpx::get_num_worker_threads();
 
     // start the clock
+    reset_allocation_count();
     high_resolution_timer const walltime;
     for (std::size_t t = 0; t < num_threads; ++t)
     {
@@ -525,6 +720,7 @@ int hpx_main(variables_map& vm)
 #endif
                 measure_function_futures_wait_each(count, csv, par);
                 measure_function_futures_wait_all(count, csv, par);
+                measure_function_futures_then(count, csv, par);
                 measure_function_futures_sliding_semaphore(count, csv, par);
                 measure_function_futures_for_loop(count, csv, par);
                 measure_function_futures_for_loop(count, csv, sched_exec_tps);
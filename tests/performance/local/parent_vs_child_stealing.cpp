@@ -11,6 +11,7 @@
 #include <hpx/future.hpp>
 #include <hpx/init.hpp>
 #include <hpx/program_options.hpp>
+#include <hpx/runtime.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -86,13 +87,14 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     if (print_header)
     {
-        std::cout << "num_cores,num_threads,child_stealing_time[s],parent_"
-                     "stealing_time[s]"
+        std::cout << "scheduler,num_cores,num_threads,child_stealing_time[s],"
+                     "parent_stealing_time[s]"
                   << std::endl;
     }
 
-    hpx::util::format_to(std::cout, "{},{},{},{}", num_cores, iterations,
-        child_stealing_time, parent_stealing_time)
+    hpx::util::format_to(std::cout, "{},{},{},{},{}",
+        hpx::get_config_entry("hpx.scheduler", "local-priority-fifo"),
+        num_cores, iterations, child_stealing_time, parent_stealing_time)
         << std::endl;
 
     return hpx::local::finalize();
@@ -20,6 +20,7 @@
 #include <hpx/chrono.hpp>
 #include <hpx/future.hpp>
 #include <hpx/init.hpp>
+#include <hpx/runtime.hpp>
 
 #include <cstdint>
 #include <iostream>
@@ -83,6 +84,11 @@ hpx::future<std::int64_t> skynet_f(
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
+    // report the scheduler in use to allow comparing --hpx:queuing options
+    std::cout << "Scheduler: "
+              << hpx::get_config_entry("hpx.scheduler", "local-priority-fifo")
+              << "\n";
+
     {
         std::uint64_t t = hpx::chrono::high_resolution_clock::now();
 
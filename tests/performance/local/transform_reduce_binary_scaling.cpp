@@ -6,6 +6,7 @@
 
 #include <hpx/algorithm.hpp>
 #include <hpx/chrono.hpp>
+#include <hpx/datapar.hpp>
 #include <hpx/execution.hpp>
 #include <hpx/init.hpp>
 #include <hpx/numeric.hpp>
@@ -15,6 +16,7 @@
 #include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <numeric>
 #include <random>
 #include <stdexcept>
 #include <string>
@@ -41,24 +43,37 @@ struct multiplies
 ///////////////////////////////////////////////////////////////////////////////
 template <typename ExPolicy>
 float measure_inner_product(ExPolicy&& policy, std::vector<float> const& data1,
-    std::vector<float> const& data2)
+    std::vector<float> const& data2, std::size_t offset)
 {
-    return hpx::transform_reduce(policy, std::begin(data1), std::end(data1),
-        std::begin(data2), 0.0f, ::multiplies(), ::plus());
+    // an offset into the second sequence makes it misaligned relative to the
+    // first one
+    return hpx::transform_reduce(policy, std::begin(data1),
+        std::end(data1) - offset, std::begin(data2) + offset, 0.0f,
+        ::multiplies(), ::plus());
 }
 
 template <typename ExPolicy>
 std::int64_t measure_inner_product(int count, ExPolicy&& policy,
-    std::vector<float> const& data1, std::vector<float> const& data2)
+    std::vector<float> const& data1, std::vector<float> const& data2,
+    std::size_t offset = 0)
 {
     std::int64_t start = hpx::chrono::high_resolution_clock::now();
 
     for (int i = 0; i != count; ++i)
-        measure_inner_product(policy, data1, data2);
+        measure_inner_product(policy, data1, data2, offset);
 
     return (hpx::chrono::high_resolution_clock::now() - start) / count;
 }
 
+// throughput in GB/s, both input sequences are read once
+double throughput(std::size_t size, std::uint64_t time)
+{
+    if (time == 0)
+        return 0.;
+    return static_cast<double>(2 * size * sizeof(float)) /
+        static_cast<double>(time);
+}
+
 int hpx_main(hpx::program_options::variables_map& vm)
 {
     unsigned int seed = (unsigned int) std::random_device{}();
@@ -82,30 +97,59 @@ int hpx_main(hpx::program_options::variables_map& vm)
     {
         std::cout << "test_count cannot be less than zero...\n" << std::flush;
     }
+    else if (size < 2)
+    {
+        std::cout << "vector_size cannot be less than two...\n" << std::flush;
+    }
     else
     {
+        using namespace hpx::execution;
+
         // warm up caches
-        measure_inner_product(hpx::execution::par, data1, data2);
+        measure_inner_product(par, data1, data2, 0);
 
         // do measurements
-        std::uint64_t tr_time_datapar = measure_inner_product(
-            test_count, hpx::execution::par_simd, data1, data2);
-        std::uint64_t tr_time_par = measure_inner_product(
-            test_count, hpx::execution::par, data1, data2);
+        std::uint64_t tr_time_seq =
+            measure_inner_product(test_count, seq, data1, data2);
+        std::uint64_t tr_time_simd =
+            measure_inner_product(test_count, simd, data1, data2);
+        std::uint64_t tr_time_datapar =
+            measure_inner_product(test_count, par_simd, data1, data2);
+        std::uint64_t tr_time_par =
+            measure_inner_product(test_count, par, data1, data2);
+
+        std::uint64_t tr_time_simd_misaligned =
+            measure_inner_product(test_count, simd, data1, data2, 1);
+        std::uint64_t tr_time_datapar_misaligned =
+            measure_inner_product(test_count, par_simd, data1, data2, 1);
 
         if (csvoutput)
         {
             std::cout << "," << tr_time_par / 1e9 << ","
-                      << tr_time_datapar / 1e9 << "\n"
+                      << tr_time_datapar / 1e9 << "," << tr_time_seq / 1e9
+                      << "," << tr_time_simd / 1e9 << ","
+                      << tr_time_simd_misaligned / 1e9 << ","
+                      << tr_time_datapar_misaligned / 1e9 << "\n"
                       << std::flush;
         }
         else
         {
-            std::cout << "transform_reduce(execution::par): " << std::right
-                      << std::setw(15) << tr_time_par / 1e9 << "\n"
-                      << "transform_reduce(datapar): " << std::right
-                      << std::setw(15) << tr_time_datapar / 1e9 << "\n"
-                      << std::flush;
+            auto print = [&](char const* name, std::uint64_t time) {
+                std::cout << std::left << std::setw(45) << name << std::right
+                          << std::setw(15) << time / 1e9 << " s"
+                          << std::setw(12) << std::setprecision(4)
+                          << throughput(size, time) << " GB/s\n";
+            };
+
+            print("transform_reduce(execution::seq): ", tr_time_seq);
+            print("transform_reduce(execution::simd): ", tr_time_simd);
+            print("transform_reduce(execution::par): ", tr_time_par);
+            print("transform_reduce(datapar): ", tr_time_datapar);
+            print("transform_reduce(execution::simd, misaligned): ",
+                tr_time_simd_misaligned);
+            print("transform_reduce(datapar, misaligned): ",
+                tr_time_datapar_misaligned);
+            std::cout << std::flush;
         }
     }
 
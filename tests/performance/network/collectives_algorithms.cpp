@@ -0,0 +1,231 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the algorithms available for all_reduce and all_gather and the
+// segmented broadcast for a range of message sizes. The existing
+// communicator based implementation (sending all data through the root
+// site) is measured as a reference. Run this on different numbers of
+// localities, e.g.:
+//
+//    collectives_algorithms --hpx:localities=4 --hpx:parcelport=tcp ...
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace hpx::collectives;
+
+using data_type = std::vector<double>;
+using buffer_type = hpx::serialization::serialize_buffer<char>;
+
+///////////////////////////////////////////////////////////////////////////////
+struct vector_plus
+{
+    data_type operator()(data_type lhs, data_type const& rhs) const
+    {
+        for (std::size_t i = 0; i != lhs.size(); ++i)
+        {
+            lhs[i] += rhs[i];
+        }
+        return lhs;
+    }
+};
+
+char const* algorithm_name(collective_algorithm algorithm)
+{
+    switch (algorithm)
+    {
+    case collective_algorithm::recursive_doubling:
+        return "recursive_doubling";
+    case collective_algorithm::ring:
+        return "ring";
+    default:
+        break;
+    }
+    return "automatic";
+}
+
+void print_result(char const* operation, char const* algorithm,
+    std::size_t num_localities, std::size_t nbytes, double elapsed,
+    std::size_t iterations)
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        std::cout << operation << ", " << algorithm << ", " << num_localities
+                  << ", " << nbytes << ", "
+                  << elapsed * 1e6 / static_cast<double>(iterations)
+                  << " [us]\n";
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const min_bytes = vm["min-bytes"].as<std::size_t>();
+    std::size_t const max_bytes = vm["max-bytes"].as<std::size_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+    std::size_t const segment_size = vm["segment-size"].as<std::size_t>();
+
+    std::size_t const here = hpx::get_locality_id();
+    std::size_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    auto comm = create_communicator("/collectives_algorithms/communicator/",
+        num_sites_arg(num_localities), this_site_arg(here));
+    auto channel_comm = create_channel_communicator(hpx::launch::sync,
+        "/collectives_algorithms/channel_communicator/",
+        num_sites_arg(num_localities), this_site_arg(here));
+
+    std::size_t generation = 0;
+    std::size_t channel_generation = 0;
+
+    for (std::size_t nbytes = min_bytes; nbytes <= max_bytes; nbytes *= 2)
+    {
+        data_type const value(
+            (std::max)(nbytes / sizeof(double), std::size_t(1)), 1.0);
+
+        // reference: all data is sent through the root site
+        {
+            hpx::chrono::high_resolution_timer const t;
+            for (std::size_t i = 0; i != iterations; ++i)
+            {
+                all_reduce(
+                    comm, value, vector_plus{}, generation_arg(++generation))
+                    .get();
+            }
+            print_result("all_reduce", "communicator", num_localities, nbytes,
+                t.elapsed(), iterations);
+        }
+        {
+            hpx::chrono::high_resolution_timer const t;
+            for (std::size_t i = 0; i != iterations; ++i)
+            {
+                all_gather(comm, value, generation_arg(++generation)).get();
+            }
+            print_result("all_gather", "communicator", num_localities, nbytes,
+                t.elapsed(), iterations);
+        }
+
+        for (collective_algorithm const algorithm :
+            {collective_algorithm::automatic,
+                collective_algorithm::recursive_doubling,
+                collective_algorithm::ring})
+        {
+            {
+                hpx::chrono::high_resolution_timer const t;
+                for (std::size_t i = 0; i != iterations; ++i)
+                {
+                    all_reduce(channel_comm, value, vector_plus{}, algorithm,
+                        generation_arg(++channel_generation))
+                        .get();
+                }
+                print_result("all_reduce", algorithm_name(algorithm),
+                    num_localities, nbytes, t.elapsed(), iterations);
+            }
+            {
+                hpx::chrono::high_resolution_timer const t;
+                for (std::size_t i = 0; i != iterations; ++i)
+                {
+                    all_gather(channel_comm, value, algorithm,
+                        generation_arg(++channel_generation))
+                        .get();
+                }
+                print_result("all_gather", algorithm_name(algorithm),
+                    num_localities, nbytes, t.elapsed(), iterations);
+            }
+        }
+
+        // broadcast from site zero
+        if (num_localities > 1)
+        {
+            buffer_type const buffer(nbytes);
+            {
+                hpx::chrono::high_resolution_timer const t;
+                for (std::size_t i = 0; i != iterations; ++i)
+                {
+                    if (here == 0)
+                    {
+                        broadcast_to(comm, buffer, generation_arg(++generation))
+                            .get();
+                    }
+                    else
+                    {
+                        broadcast_from<buffer_type>(
+                            comm, generation_arg(++generation))
+                            .get();
+                    }
+                }
+                print_result("broadcast", "communicator", num_localities,
+                    nbytes, t.elapsed(), iterations);
+            }
+            {
+                hpx::chrono::high_resolution_timer const t;
+                for (std::size_t i = 0; i != iterations; ++i)
+                {
+                    if (here == 0)
+                    {
+                        broadcast_to(channel_comm, buffer,
+                            segment_size_arg(segment_size),
+                            generation_arg(++channel_generation))
+                            .get();
+                    }
+                    else
+                    {
+                        broadcast_from<buffer_type>(channel_comm,
+                            root_site_arg(0),
+                            generation_arg(++channel_generation))
+                            .get();
+                    }
+                }
+                print_result("broadcast", "segmented", num_localities, nbytes,
+                    t.elapsed(), iterations);
+            }
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    namespace po = hpx::program_options;
+
+    po::options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("min-bytes", po::value<std::size_t>()->default_value(8),
+         "smallest amount of data contributed by each locality")
+        ("max-bytes", po::value<std::size_t>()->default_value(4 * 1024 * 1024),
+         "largest amount of data contributed by each locality")
+        ("iterations", po::value<std::size_t>()->default_value(100),
+         "number of times each operation is performed")
+        ("segment-size", po::value<std::size_t>()->default_value(1024 * 1024),
+         "size of the segments used by the segmented broadcast")
+        ;
+    // clang-format on
+
+    // run hpx_main on all localities
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+
+#endif
@@ -15,6 +15,7 @@
 #include <hpx/modules/timing.hpp>
 #include <hpx/serialization.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <iostream>
@@ -34,6 +35,9 @@ const std::size_t niters_default = 1;
 size_t window;
 size_t inject_rate;
 size_t batch_size;
+bool use_serialize_buffer;
+
+using buffer_type = hpx::serialization::serialize_buffer<char>;
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -46,6 +50,10 @@ HPX_PLAIN_ACTION(on_inject, on_inject_action)
 void on_recv(hpx::id_type to, std::vector<char> const& in, std::size_t counter);
 HPX_PLAIN_ACTION(on_recv, on_recv_action)
 
+void on_recv_buffer(
+    hpx::id_type to, buffer_type const& in, std::size_t counter);
+HPX_PLAIN_ACTION(on_recv_buffer, on_recv_buffer_action)
+
 void on_done();
 HPX_PLAIN_ACTION(on_done, on_done_action)
 
@@ -65,17 +73,26 @@ void on_inject(hpx::id_type to, std::size_t nbytes, std::size_t nsteps)
         {
             hpx::this_thread::yield();
         }
-        std::vector<char> data(nbytes, 'a');
-        hpx::post<on_recv_action>(to, hpx::find_here(), data, nsteps);
+        if (use_serialize_buffer)
+        {
+            buffer_type data(nbytes);
+            std::fill(data.begin(), data.end(), 'a');
+            hpx::post<on_recv_buffer_action>(
+                to, hpx::find_here(), data, nsteps);
+        }
+        else
+        {
+            std::vector<char> data(nbytes, 'a');
+            hpx::post<on_recv_action>(to, hpx::find_here(), data, nsteps);
+        }
     }
 }
 
 std::atomic<size_t> done_counter(0);
 
-void on_recv(hpx::id_type to, std::vector<char> const& in, std::size_t counter)
+bool on_last_step(std::size_t counter)
 {
-    // received vector in
-    if (--counter == 0)
+    if (counter == 0)
     {
         size_t result = done_counter.fetch_add(1, std::memory_order_relaxed);
         if (result + 1 == window)
@@ -83,6 +100,16 @@ void on_recv(hpx::id_type to, std::vector<char> const& in, std::size_t counter)
             hpx::post<on_done_action>(hpx::find_root_locality());
             done_counter = 0;
         }
+        return true;
+    }
+    return false;
+}
+
+void on_recv(hpx::id_type to, std::vector<char> const& in, std::size_t counter)
+{
+    // received vector in
+    if (on_last_step(--counter))
+    {
         return;
     }
 
@@ -91,6 +118,19 @@ void on_recv(hpx::id_type to, std::vector<char> const& in, std::size_t counter)
     hpx::post<on_recv_action>(to, hpx::find_here(), std::move(data), counter);
 }
 
+void on_recv_buffer(hpx::id_type to, buffer_type const& in, std::size_t counter)
+{
+    // received buffer in, its data was placed directly into the buffer's
+    // allocation if the parcelport supports zero-copy receive
+    if (on_last_step(--counter))
+    {
+        return;
+    }
+
+    // send it to remote locality (to), no copy is needed
+    hpx::post<on_recv_buffer_action>(to, hpx::find_here(), in, counter);
+}
+
 hpx::counting_semaphore_var<> semaphore;
 
 void on_done()
@@ -109,6 +149,7 @@ int hpx_main(hpx::program_options::variables_map& b_arg)
     batch_size = b_arg["batch-size"].as<std::size_t>();
     std::size_t const nwarmups = b_arg["nwarmups"].as<std::size_t>();
     std::size_t const niters = b_arg["niters"].as<std::size_t>();
+    use_serialize_buffer = b_arg["serialize-buffer"].as<bool>();
 
     if (nsteps == 0)
     {
@@ -181,7 +222,8 @@ int hpx_main(hpx::program_options::variables_map& b_arg)
                   << "msg_rate(K/s)=" << msg_rate << std::endl
                   << "bandwidth(MB/s)=" << bandwidth << std::endl
                   << "localities=" << localities.size() << std::endl
-                  << "nsteps=" << nsteps << std::endl;
+                  << "nsteps=" << nsteps << std::endl
+                  << "serialize_buffer=" << use_serialize_buffer << std::endl;
     }
     else
     {
@@ -193,7 +235,7 @@ int hpx_main(hpx::program_options::variables_map& b_arg)
                   << ":msg_rate(M/s)=" << msg_rate
                   << ":bandwidth(MB/s)=" << bandwidth
                   << ":localities=" << localities.size() << ":nsteps=" << nsteps
-                  << std::endl;
+                  << ":serialize_buffer=" << use_serialize_buffer << std::endl;
     }
 
     hpx::finalize();
@@ -221,7 +263,12 @@ int main(int argc, char* argv[])
         po::value<std::size_t>()->default_value(niters_default),
         "the iteration count of measurement iterations.")("verbose",
         po::value<bool>()->default_value(true),
-        "verbosity of output,if false output is for awk");
+        "verbosity of output,if false output is for awk")("serialize-buffer",
+        po::value<bool>()->default_value(false),
+        "send the data as a serialize_buffer instead of a std::vector, "
+        "combine with "
+        "--hpx:ini=hpx.parcel.<parcelport>.zero_copy_receive_optimization=0 "
+        "to measure the effect of receiving the data in place");
 
     hpx::init_params init_args;
     init_args.desc_cmdline = description;